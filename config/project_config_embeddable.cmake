@@ -74,8 +74,14 @@ endmacro (set_project_versions)
 #  * RUN_GCOV             - Whether or not to perform code coverage
 #
 macro (set_project_options _build_doc _enable_tests _run_gcov)
-  # C++ standard (C++-17)
-  set(CMAKE_CXX_STANDARD 17)
+  # C++ standard (C++-17, or C++-20 for the optional coroutine layer)
+  option (ENABLE_COROUTINES
+    "Set to ON to build with C++-20, for the (optional) coroutine layer" OFF)
+  if (ENABLE_COROUTINES)
+    set(CMAKE_CXX_STANDARD 20)
+  else (ENABLE_COROUTINES)
+    set(CMAKE_CXX_STANDARD 17)
+  endif (ENABLE_COROUTINES)
   set(CMAKE_CXX_STANDARD_REQUIRED ON)
 
   # Shared libraries
@@ -343,6 +349,10 @@ macro (get_external_libs)
       get_boost (${_arg_version})
     endif (${_arg_lower} STREQUAL "boost")
 
+    if (${_arg_lower} STREQUAL "threads")
+      get_threads (${_arg_version})
+    endif (${_arg_lower} STREQUAL "threads")
+
     if (${_arg_lower} STREQUAL "protobuf")
       get_protobuf (${_arg_version})
     endif (${_arg_lower} STREQUAL "protobuf")
@@ -831,6 +841,21 @@ macro (get_readline)
 
 endmacro (get_readline)
 
+# ~~~~~~~~~~ Threads ~~~~~~~~~
+macro (get_threads)
+  message (STATUS "Requires the (system) thread library")
+
+  set (CMAKE_THREAD_PREFER_PTHREAD True)
+  set (THREADS_PREFER_PTHREAD_FLAG True)
+  find_package (Threads REQUIRED)
+
+  if (Threads_FOUND)
+    # Update the list of dependencies for the project
+    list (APPEND PROJ_DEP_LIBS_FOR_LIB Threads::Threads)
+  endif (Threads_FOUND)
+
+endmacro (get_threads)
+
 # ~~~~~~~~~~ (N)Curses ~~~~~~~~~
 macro (get_curses)
   unset (_required_version)
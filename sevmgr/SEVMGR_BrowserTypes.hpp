@@ -0,0 +1,51 @@
+#ifndef __SEVMGR_SEVMGR_BROWSERTYPES_HPP
+#define __SEVMGR_SEVMGR_BROWSERTYPES_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// Boost
+#include <boost/shared_ptr.hpp>
+
+// Forward declarations
+namespace stdair {
+  struct EventStruct;
+}
+
+namespace SEVMGR {
+
+  // //////// Type definitions for the browsing of the event queue /////////
+  /**
+   * @brief Lazy, forward-only iteration over the next coming events of
+   * the event queue, in chronological order, up to a date-time horizon
+   * (see SEVMGR_Service::browseEvents()).
+   *
+   * The events are neither removed nor copied, and the progress
+   * statuses are left untouched: browsing the next k events costs
+   * (roughly) O(k), whatever the size of the queue. That allows, for
+   * instance, a partition to find out how far it can safely advance,
+   * or a user interface to show what comes next.
+   *
+   * \note A browser is no longer valid once the event queue has been
+   *       altered (e.g., an event has been added, popped or cancelled).
+   */
+  class EventBrowser {
+  public:
+    /** Destructor. */
+    virtual ~EventBrowser() {}
+
+    /**
+     * Move on to the next coming event.
+     *
+     * @return const stdair::EventStruct* Pointer on the next event, or
+     *         NULL once all the events up to the horizon have been
+     *         browsed.
+     */
+    virtual const stdair::EventStruct* next() = 0;
+  };
+
+  /** Pointer on a browser (it is released along with its cursor). */
+  typedef boost::shared_ptr<EventBrowser> EventBrowserPtr_T;
+
+}
+#endif // __SEVMGR_SEVMGR_BROWSERTYPES_HPP
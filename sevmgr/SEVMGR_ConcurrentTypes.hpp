@@ -0,0 +1,61 @@
+#ifndef __SEVMGR_SEVMGR_CONCURRENTTYPES_HPP
+#define __SEVMGR_SEVMGR_CONCURRENTTYPES_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <string>
+
+// Forward declarations
+namespace stdair {
+  struct EventStruct;
+}
+
+namespace SEVMGR {
+
+  // //////// Type definitions for the windowed simulations /////////
+  /**
+   * Conflict key of an event (e.g., the key of the flight-date, the
+   * inventory of which is altered when handling the event). Events with
+   * different conflict keys may be handled concurrently.
+   */
+  typedef std::string ConflictKey_T;
+
+  /**
+   * @brief Interface giving the conflict key of each event.
+   */
+  class EventConflictKeyExtractor {
+  public:
+    /** Destructor. */
+    virtual ~EventConflictKeyExtractor() {}
+
+    /**
+     * Get the conflict key of the given event.
+     *
+     * \note That method is only called by the thread driving the
+     *       simulation.
+     */
+    virtual ConflictKey_T getConflictKey (const stdair::EventStruct&) const = 0;
+  };
+
+  /**
+   * @brief Interface of the handlers of the events of a time window.
+   *
+   * The events having the same conflict key are handled one after the
+   * other, in date-time order, by the same thread. The events having
+   * different conflict keys may be handled at the same time, by several
+   * threads: the handler must then only alter state specific to the
+   * conflict key of the event (or protect the shared state).
+   */
+  class ConcurrentEventHandler {
+  public:
+    /** Destructor. */
+    virtual ~ConcurrentEventHandler() {}
+
+    /** Handle the given event. */
+    virtual void handle (const stdair::EventStruct&) = 0;
+  };
+
+}
+#endif // __SEVMGR_SEVMGR_CONCURRENTTYPES_HPP
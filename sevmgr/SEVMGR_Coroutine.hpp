@@ -0,0 +1,491 @@
+#ifndef __SEVMGR_SEVMGR_COROUTINE_HPP
+#define __SEVMGR_SEVMGR_COROUTINE_HPP
+
+/**
+ * @file
+ * Optional layer of simulation processes, written as C++20 coroutines,
+ * on top of the event queue. That header requires a C++20 compiler (see
+ * the ENABLE_COROUTINES CMake option); the SEvMgr library itself does
+ * not depend on it.
+ */
+#if !defined(__cpp_impl_coroutine) || __cpp_impl_coroutine < 201902L
+#error "SEVMGR_Coroutine.hpp requires C++20 coroutines (ENABLE_COROUTINES)"
+#endif
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <utility>
+#include <vector>
+// Boost
+#include <boost/make_shared.hpp>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_date_time_types.hpp>
+#include <stdair/basic/EventType.hpp>
+#include <stdair/bom/EventStruct.hpp>
+#include <stdair/bom/BreakPointStruct.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Service.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Pool of memory blocks for the coroutine frames.
+   *
+   * The frames are allocated by size classes (multiples of 64 bytes, up
+   * to 1 kB), from chunks of 256 frames, and recycled through a free
+   * list per size class: hence, creating and destroying millions of
+   * simulation processes only allocates a few chunks from the heap. The
+   * larger frames are allocated from the heap.
+   *
+   * There is one pool per thread: a frame must be destroyed by the
+   * thread which created it (which is the case when the processes are
+   * driven by the simulation thread).
+   */
+  class CoroutineFramePool {
+  public:
+    // ////////// Business methods /////////
+    /** Allocate a frame of the given size. */
+    static void* allocate (const std::size_t& iSize) {
+      const std::size_t lSizeClass = getSizeClass (iSize);
+      if (lSizeClass >= NB_OF_SIZE_CLASSES) {
+        return ::operator new (iSize);
+      }
+      return instance().allocateBlock (lSizeClass);
+    }
+
+    /** Release a frame of the given size. */
+    static void deallocate (void* ioFrame_ptr, const std::size_t& iSize) {
+      const std::size_t lSizeClass = getSizeClass (iSize);
+      if (lSizeClass >= NB_OF_SIZE_CLASSES) {
+        ::operator delete (ioFrame_ptr);
+        return;
+      }
+      instance().releaseBlock (ioFrame_ptr, lSizeClass);
+    }
+
+  private:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    CoroutineFramePool() {
+      for (std::size_t idx = 0; idx != NB_OF_SIZE_CLASSES; ++idx) {
+        _freeBlockListList[idx] = NULL;
+      }
+    }
+    /** Destructor. The chunks are given back to the heap. */
+    ~CoroutineFramePool() {
+      for (std::vector<void*>::iterator itChunk = _chunkList.begin();
+           itChunk != _chunkList.end(); ++itChunk) {
+        ::operator delete (*itChunk);
+      }
+    }
+    /** Copy constructor (not to be used). */
+    CoroutineFramePool (const CoroutineFramePool&);
+
+    /** Pool of the current thread. */
+    static CoroutineFramePool& instance() {
+      thread_local CoroutineFramePool lPool;
+      return lPool;
+    }
+
+  private:
+    // ////////// Helpers /////////
+    /** Size granularity of the blocks, and number of size classes. */
+    static const std::size_t BLOCK_GRANULARITY = 64;
+    static const std::size_t NB_OF_SIZE_CLASSES = 16;
+
+    /** Number of blocks of each chunk. */
+    static const std::size_t NB_OF_BLOCKS_PER_CHUNK = 256;
+
+    /** Free block, linked to the next one of its size class. */
+    struct FreeBlock {
+      FreeBlock* _next_ptr;
+    };
+
+    /** Size class of the blocks able to hold the given size. */
+    static std::size_t getSizeClass (const std::size_t& iSize) {
+      return (iSize + BLOCK_GRANULARITY - 1) / BLOCK_GRANULARITY - 1;
+    }
+
+    /** Take a block of the given size class, carving a chunk if needed. */
+    void* allocateBlock (const std::size_t& iSizeClass) {
+      if (_freeBlockListList[iSizeClass] == NULL) {
+        const std::size_t lBlockSize = (iSizeClass + 1) * BLOCK_GRANULARITY;
+        char* lChunk_ptr = static_cast<char*>
+          (::operator new (lBlockSize * NB_OF_BLOCKS_PER_CHUNK));
+        _chunkList.push_back (lChunk_ptr);
+        for (std::size_t idx = 0; idx != NB_OF_BLOCKS_PER_CHUNK; ++idx) {
+          releaseBlock (lChunk_ptr + idx * lBlockSize, iSizeClass);
+        }
+      }
+      FreeBlock* lBlock_ptr = _freeBlockListList[iSizeClass];
+      assert (lBlock_ptr != NULL);
+      _freeBlockListList[iSizeClass] = lBlock_ptr->_next_ptr;
+      return lBlock_ptr;
+    }
+
+    /** Give a block back to the free list of its size class. */
+    void releaseBlock (void* ioBlock_ptr, const std::size_t& iSizeClass) {
+      FreeBlock* lBlock_ptr = static_cast<FreeBlock*> (ioBlock_ptr);
+      lBlock_ptr->_next_ptr = _freeBlockListList[iSizeClass];
+      _freeBlockListList[iSizeClass] = lBlock_ptr;
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /** Free blocks, by size class. */
+    FreeBlock* _freeBlockListList[NB_OF_SIZE_CLASSES];
+
+    /** Chunks allocated from the heap. */
+    std::vector<void*> _chunkList;
+  };
+
+
+  /**
+   * @brief Simulation process (e.g., a customer booking, waiting and
+   * then cancelling), written as a coroutine.
+   *
+   * A function returning a SimulationProcess is a coroutine: its body
+   * starts once the process has been spawned (see
+   * ProcessScheduler::spawn()), and it may wait for the simulated time
+   * to elapse with
+   * <tt>co_await lScheduler.sleepUntil (lDateTime)</tt> (or sleepFor()).
+   * Its frame is allocated from the CoroutineFramePool.
+   */
+  class SimulationProcess {
+  public:
+    // ////////// Type definitions ////////////
+    /** Promise of the coroutine. */
+    struct promise_type {
+      SimulationProcess get_return_object() {
+        return SimulationProcess (Handle_T::from_promise (*this));
+      }
+      std::suspend_always initial_suspend() noexcept {
+        return std::suspend_always();
+      }
+      std::suspend_always final_suspend() noexcept {
+        return std::suspend_always();
+      }
+      void return_void() {
+      }
+      void unhandled_exception() {
+        _exception = std::current_exception();
+      }
+
+      /** Allocation of the frame from the pool. */
+      static void* operator new (std::size_t iSize) {
+        return CoroutineFramePool::allocate (iSize);
+      }
+      static void operator delete (void* ioFrame_ptr, std::size_t iSize) {
+        CoroutineFramePool::deallocate (ioFrame_ptr, iSize);
+      }
+
+      /** Exception thrown by the body of the process, if any. */
+      std::exception_ptr _exception;
+    };
+    typedef std::coroutine_handle<promise_type> Handle_T;
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor, taking the ownership of the given coroutine. */
+    explicit SimulationProcess (const Handle_T& iHandle) : _handle (iHandle) {
+    }
+    /** Move constructor. */
+    SimulationProcess (SimulationProcess&& ioProcess)
+      : _handle (ioProcess._handle) {
+      ioProcess._handle = Handle_T();
+    }
+    /** Destructor. The coroutine, unless released, is destroyed. */
+    ~SimulationProcess() {
+      if (_handle) {
+        _handle.destroy();
+      }
+    }
+
+  private:
+    /** Copy constructor (not to be used). */
+    SimulationProcess (const SimulationProcess&);
+
+  public:
+    // ////////// Business methods /////////
+    /** Give the ownership of the coroutine up, to the caller. */
+    Handle_T release() {
+      Handle_T oHandle = _handle;
+      _handle = Handle_T();
+      return oHandle;
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /** Coroutine of the process. */
+    Handle_T _handle;
+  };
+
+
+  /**
+   * @brief Scheduler of the simulation processes, resuming each of them
+   * at the simulated date-time it waits for.
+   *
+   * A waiting process is represented, within the event queue, by a
+   * break point at the date-time it waits for. The scheduler is the
+   * handler of those break points: it must be registered, for the
+   * break point event type, into the EventHandlerRegistry given to
+   * SEVMGR_Service::run(). The break points not scheduled by it are
+   * ignored.
+   *
+   * The processes are held in slots, indexed by process, which are
+   * recycled once their processes complete. Each slot owns two break
+   * points, used in turn by the successive waits of its process: the
+   * break point of a wait is the one handled two waits before, which is
+   * no longer queued. Hence, once the slots have been created, a wait
+   * allocates nothing but the copy of the event within the event queue.
+   *
+   * \note The processes must be spawned, and driven, by the simulation
+   *       thread. The processes still waiting are destroyed along with
+   *       the scheduler.
+   * \note As the break points are recycled, the handled events must
+   *       not be kept beyond their handling.
+   */
+  class ProcessScheduler {
+  public:
+    // ////////// Type definitions ////////////
+    /** Awaitable suspending a process until the given date-time. */
+    class SleepAwaiter {
+    public:
+      SleepAwaiter (ProcessScheduler& ioScheduler,
+                    const stdair::DateTime_T& iDateTime)
+        : _scheduler (ioScheduler), _dateTime (iDateTime) {
+      }
+
+      /** No suspension when the date-time is not in the future. */
+      bool await_ready() const {
+        return (_dateTime <= _scheduler.getCurrentDateTime());
+      }
+      void await_suspend (const SimulationProcess::Handle_T& iHandle) {
+        _scheduler.schedule (iHandle, _dateTime);
+      }
+      void await_resume() const {
+      }
+
+    private:
+      ProcessScheduler& _scheduler;
+      const stdair::DateTime_T _dateTime;
+    };
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     *
+     * @param const SEVMGR_Service& Service, into the event queue of which
+     *        the break points of the waiting processes are added.
+     * @param const stdair::DateTime_T& Initial simulated date-time.
+     */
+    ProcessScheduler (const SEVMGR_Service& iSEVMGR_Service,
+                      const stdair::DateTime_T& iStartDateTime)
+      : _sevmgrService (iSEVMGR_Service), _currentDateTime (iStartDateTime),
+        _resumedSlotIndex (0), _nbOfProcesses (0) {
+      // The break points are popped, hence their progress status
+      if (_sevmgrService.hasProgressStatus (stdair::EventType::BRK_PT)
+          == false) {
+        _sevmgrService.addStatus (stdair::EventType::BRK_PT, 0);
+      }
+    }
+    /** Destructor. The processes still waiting are destroyed. */
+    ~ProcessScheduler() {
+      for (ProcessSlotList_T::iterator itSlot = _processSlotList.begin();
+           itSlot != _processSlotList.end(); ++itSlot) {
+        if (itSlot->_handle) {
+          itSlot->_handle.destroy();
+        }
+      }
+    }
+
+  private:
+    /** Copy constructor (not to be used). */
+    ProcessScheduler (const ProcessScheduler&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the simulated date-time, i.e., the one of the last resumption. */
+    const stdair::DateTime_T& getCurrentDateTime() const {
+      return _currentDateTime;
+    }
+
+    /** Get the number of processes not completed yet. */
+    const stdair::Count_T& getNbOfProcesses() const {
+      return _nbOfProcesses;
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /** Start the given process at the given simulated date-time. */
+    void spawn (SimulationProcess&& ioProcess,
+                const stdair::DateTime_T& iStartDateTime) {
+      // Take a free slot, if any, or create one
+      ProcessSlotIndex_T lSlotIndex = _processSlotList.size();
+      if (_freeSlotIndexList.empty() == false) {
+        lSlotIndex = _freeSlotIndexList.back();
+        _freeSlotIndexList.pop_back();
+      } else {
+        ProcessSlot lSlot;
+        for (unsigned short idx = 0; idx != 2; ++idx) {
+          lSlot._breakPointList[idx] =
+            boost::make_shared<ProcessBreakPoint> (iStartDateTime, this,
+                                                   lSlotIndex);
+        }
+        lSlot._currentBreakPoint = 0;
+        lSlot._isWaiting = false;
+        _processSlotList.push_back (lSlot);
+      }
+
+      ProcessSlot& lSlot = _processSlotList[lSlotIndex];
+      lSlot._handle = ioProcess.release();
+      scheduleSlot (lSlot, iStartDateTime);
+      ++_nbOfProcesses;
+    }
+
+    /** Suspend the calling process until the given date-time. */
+    SleepAwaiter sleepUntil (const stdair::DateTime_T& iDateTime) {
+      return SleepAwaiter (*this, iDateTime);
+    }
+
+    /** Suspend the calling process for the given duration. */
+    SleepAwaiter sleepFor (const stdair::Duration_T& iDuration) {
+      return SleepAwaiter (*this, _currentDateTime + iDuration);
+    }
+
+    /**
+     * Resume the process waiting for the given break point, if any. When
+     * the process throws an exception, that latter is thrown again.
+     */
+    void operator() (const stdair::EventStruct& iEventStruct) {
+      // Retrieve the process waiting for the break point, if it is still
+      // the current one of its slot
+      const ProcessBreakPoint* lBreakPoint_ptr =
+        dynamic_cast<const ProcessBreakPoint*> (&iEventStruct.getBreakPoint());
+      if (lBreakPoint_ptr == NULL || lBreakPoint_ptr->_scheduler_ptr != this
+          || lBreakPoint_ptr->_slotIndex >= _processSlotList.size()) {
+        return;
+      }
+      const ProcessSlotIndex_T lSlotIndex = lBreakPoint_ptr->_slotIndex;
+      ProcessSlot& lSlot = _processSlotList[lSlotIndex];
+      if (!lSlot._handle || lSlot._isWaiting == false
+          || lSlot._breakPointList[lSlot._currentBreakPoint].get()
+          != lBreakPoint_ptr) {
+        return;
+      }
+      lSlot._isWaiting = false;
+
+      _currentDateTime = iEventStruct.getEventTime();
+      _resumedSlotIndex = lSlotIndex;
+      const SimulationProcess::Handle_T lHandle = lSlot._handle;
+      lHandle.resume();
+      if (lHandle.done() == false) {
+        return;
+      }
+
+      // The process has completed: its slot is recycled
+      --_nbOfProcesses;
+      const std::exception_ptr lException = lHandle.promise()._exception;
+      lHandle.destroy();
+      _processSlotList[lSlotIndex]._handle = SimulationProcess::Handle_T();
+      _freeSlotIndexList.push_back (lSlotIndex);
+      if (lException != NULL) {
+        std::rethrow_exception (lException);
+      }
+    }
+
+  private:
+    // ////////// Helpers /////////
+    /** Index of a process slot. */
+    typedef std::size_t ProcessSlotIndex_T;
+
+    /**
+     * Break point of a waiting process, referring to the slot of that
+     * process.
+     */
+    struct ProcessBreakPoint : public stdair::BreakPointStruct {
+      ProcessBreakPoint (const stdair::DateTime_T& iDateTime,
+                         const ProcessScheduler* iScheduler_ptr,
+                         const ProcessSlotIndex_T& iSlotIndex)
+        : stdair::BreakPointStruct (iDateTime),
+          _scheduler_ptr (iScheduler_ptr), _slotIndex (iSlotIndex) {
+      }
+
+      const ProcessScheduler* _scheduler_ptr;
+      const ProcessSlotIndex_T _slotIndex;
+    };
+    typedef boost::shared_ptr<ProcessBreakPoint> ProcessBreakPointPtr_T;
+
+    /**
+     * Slot of a process, i.e., its coroutine (none when the slot is
+     * free), and its two break points, used in turn. The break points
+     * are held by the slot, so that their addresses are not reused
+     * (e.g., after a reset of the event queue) while the processes wait.
+     */
+    struct ProcessSlot {
+      SimulationProcess::Handle_T _handle;
+      ProcessBreakPointPtr_T _breakPointList[2];
+      unsigned short _currentBreakPoint;
+      bool _isWaiting;
+    };
+    typedef std::vector<ProcessSlot> ProcessSlotList_T;
+
+    /**
+     * Resume the given process (coroutine) at the given date-time. That
+     * process is the one being resumed (the processes only run when
+     * resumed by the scheduler).
+     */
+    void schedule (const SimulationProcess::Handle_T& iHandle,
+                   const stdair::DateTime_T& iDateTime) {
+      assert (_resumedSlotIndex < _processSlotList.size());
+      ProcessSlot& lSlot = _processSlotList[_resumedSlotIndex];
+      assert (lSlot._handle == iHandle);
+      scheduleSlot (lSlot, iDateTime);
+    }
+
+    /** Resume the process of the given slot at the given date-time. */
+    void scheduleSlot (ProcessSlot& ioSlot,
+                       const stdair::DateTime_T& iDateTime) {
+      // Switch to the other break point of the slot, and move it to the
+      // given date-time
+      ioSlot._currentBreakPoint = 1 - ioSlot._currentBreakPoint;
+      const ProcessBreakPointPtr_T& lBreakPoint_ptr =
+        ioSlot._breakPointList[ioSlot._currentBreakPoint];
+      static_cast<stdair::BreakPointStruct&> (*lBreakPoint_ptr) =
+        stdair::BreakPointStruct (iDateTime);
+      ioSlot._isWaiting = true;
+
+      const stdair::BreakPointPtr_T lPayload_ptr = lBreakPoint_ptr;
+      _sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lPayload_ptr);
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /** Service holding the event queue. */
+    const SEVMGR_Service& _sevmgrService;
+
+    /** Simulated date-time. */
+    stdair::DateTime_T _currentDateTime;
+
+    /** Slots of the processes, and indexes of the free ones. */
+    ProcessSlotList_T _processSlotList;
+    std::vector<ProcessSlotIndex_T> _freeSlotIndexList;
+
+    /** Slot of the process being resumed. */
+    ProcessSlotIndex_T _resumedSlotIndex;
+
+    /** Number of processes not completed yet. */
+    stdair::Count_T _nbOfProcesses;
+  };
+
+}
+#endif // __SEVMGR_SEVMGR_COROUTINE_HPP
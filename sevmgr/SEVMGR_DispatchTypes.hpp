@@ -0,0 +1,111 @@
+#ifndef __SEVMGR_SEVMGR_DISPATCHTYPES_HPP
+#define __SEVMGR_SEVMGR_DISPATCHTYPES_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cstddef>
+// StdAir
+#include <stdair/basic/EventType.hpp>
+#include <stdair/bom/EventStruct.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Registry of the event handlers, one (at most) per event type,
+   * to which the events are dispatched by SEVMGR_Service::run().
+   *
+   * An event handler may be any function object (class instance or
+   * lambda expression) callable with a <tt>const stdair::EventStruct&</tt>.
+   * It is neither copied nor owned by the registry: it must therefore
+   * outlive the latter.
+   *
+   * For each registered handler, a small function, calling the
+   * function object of the exact handler type, is generated. Hence,
+   * dispatching an event costs one array look-up and one direct
+   * function call: no virtual call, and no copy of the event structure.
+   */
+  class EventHandlerRegistry {
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. No handler is registered. */
+    EventHandlerRegistry() {
+      for (unsigned int idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+        _delegateList[idx]._handler_ptr = NULL;
+        _delegateList[idx]._function_ptr = NULL;
+      }
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Register the handler of the given event type, replacing the one
+     * registered so far, if any.
+     *
+     * @param const stdair::EventType::EN_EventType& Type of the events
+     *        to be handled.
+     * @param HANDLER& Function object, called with each event of the
+     *        given type.
+     */
+    template <typename HANDLER>
+    void registerHandler (const stdair::EventType::EN_EventType& iType,
+                          HANDLER& ioHandler) {
+      assert (iType < stdair::EventType::LAST_VALUE);
+      Delegate& lDelegate = _delegateList[iType];
+      lDelegate._handler_ptr = static_cast<void*> (&ioHandler);
+      lDelegate._function_ptr = &EventHandlerRegistry::invoke<HANDLER>;
+    }
+
+    /** Unregister the handler of the given event type, if any. */
+    void unregisterHandler (const stdair::EventType::EN_EventType& iType) {
+      assert (iType < stdair::EventType::LAST_VALUE);
+      Delegate& lDelegate = _delegateList[iType];
+      lDelegate._handler_ptr = NULL;
+      lDelegate._function_ptr = NULL;
+    }
+
+    /** State whether a handler is registered for the given event type. */
+    bool hasHandler (const stdair::EventType::EN_EventType& iType) const {
+      assert (iType < stdair::EventType::LAST_VALUE);
+      return (_delegateList[iType]._function_ptr != NULL);
+    }
+
+    /**
+     * Give the given event to the handler of its type, which must have
+     * been registered (see hasHandler()).
+     */
+    void dispatch (const stdair::EventStruct& iEventStruct) const {
+      const Delegate& lDelegate = _delegateList[iEventStruct.getEventType()];
+      assert (lDelegate._function_ptr != NULL);
+      lDelegate._function_ptr (lDelegate._handler_ptr, iEventStruct);
+    }
+
+  private:
+    // ////////// Helpers /////////
+    /** Type of the functions calling the handlers. */
+    typedef void (*HandlerFunction_T) (void*, const stdair::EventStruct&);
+
+    /** Handler, and the function calling it. */
+    struct Delegate {
+      void* _handler_ptr;
+      HandlerFunction_T _function_ptr;
+    };
+
+    /** Call the given handler, of the given type, with the given event. */
+    template <typename HANDLER>
+    static void invoke (void* ioHandler_ptr,
+                        const stdair::EventStruct& iEventStruct) {
+      HANDLER& lHandler = *static_cast<HANDLER*> (ioHandler_ptr);
+      lHandler (iEventStruct);
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /** Handlers, indexed by event type. */
+    Delegate _delegateList[stdair::EventType::LAST_VALUE];
+  };
+
+}
+#endif // __SEVMGR_SEVMGR_DISPATCHTYPES_HPP
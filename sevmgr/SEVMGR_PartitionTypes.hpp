@@ -0,0 +1,147 @@
+#ifndef __SEVMGR_SEVMGR_PARTITIONTYPES_HPP
+#define __SEVMGR_SEVMGR_PARTITIONTYPES_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <map>
+#include <vector>
+// StdAir
+#include <stdair/stdair_date_time_types.hpp>
+#include <stdair/basic/EventType.hpp>
+
+// Forward declarations
+namespace stdair {
+  struct EventStruct;
+}
+
+namespace SEVMGR {
+
+  // //////// Type definitions for the partitioned simulations /////////
+  /** Index of a partition of the events. */
+  typedef unsigned int PartitionIndex_T;
+
+  /**
+   * Lookahead of each event type: handling an event of that type never
+   * schedules an event into another partition earlier than the
+   * date-time of the handled event plus the lookahead. The lookahead
+   * must be strictly positive.
+   */
+  typedef std::map<stdair::EventType::EN_EventType,
+                   stdair::Duration_T> EventLookaheadMap_T;
+
+  /**
+   * @brief Interface assigning each event to a partition (e.g., by
+   * origin market of the booking requests).
+   */
+  class EventPartitioner {
+  public:
+    /** Destructor. */
+    virtual ~EventPartitioner() {}
+
+    /**
+     * Get the partition of the given event. It must be lower than the
+     * number of partitions.
+     *
+     * \note That method is called concurrently by the workers of the
+     *       partitions: it must not alter any shared state.
+     */
+    virtual PartitionIndex_T
+    getPartition (const stdair::EventStruct&) const = 0;
+  };
+
+  /**
+   * @brief Interface given to the event handlers, so that they can
+   * schedule new events.
+   */
+  class PartitionEventScheduler {
+  public:
+    /** Destructor. */
+    virtual ~PartitionEventScheduler() {}
+
+    /** Get the index of the partition of the handled event. */
+    virtual const PartitionIndex_T& getPartitionIndex() const = 0;
+
+    /** Get the date-time of the handled event. */
+    virtual stdair::DateTime_T getCurrentTime() const = 0;
+
+    /**
+     * Schedule the given event into its partition (see EventPartitioner).
+     *
+     * The event must not occur before the handled event. With the
+     * conservative synchronisation, when it goes into another partition,
+     * it must also respect the lookahead of the type of the handled
+     * event. Otherwise, an EventQueueException exception is thrown.
+     */
+    virtual void scheduleEvent (const stdair::EventStruct&) = 0;
+  };
+
+  /**
+   * @brief Interface of the handlers of the events of a partition.
+   *
+   * Each partition has its own handler, which is only called by the
+   * worker (thread) of that partition, with the events in date-time
+   * order. Hence, a handler only touching the state of its partition
+   * needs no synchronisation.
+   */
+  class PartitionEventHandler {
+  public:
+    /** Destructor. */
+    virtual ~PartitionEventHandler() {}
+
+    /** Handle the given event. */
+    virtual void handle (const stdair::EventStruct&,
+                         PartitionEventScheduler&) = 0;
+  };
+
+  /** List of event handlers, one per partition. */
+  typedef std::vector<PartitionEventHandler*> PartitionEventHandlerList_T;
+
+  /** Identifier of a checkpoint of the state of a partition. */
+  typedef unsigned long CheckpointID_T;
+
+  /**
+   * @brief Interface saving and restoring the state of the event handler
+   * of a partition, for the optimistic simulations.
+   *
+   * The state is saved, under increasing identifiers, before some of
+   * the events are handled. When an event turns out to have been handled
+   * too early, the state is restored from a checkpoint, and the events
+   * handled since then are handled again. Hence, the event handler must
+   * be deterministic: given the same state and event, it must schedule
+   * the same events.
+   *
+   * As the event handler, that interface is only called by the worker
+   * (thread) of the partition.
+   */
+  class PartitionStateHandler {
+  public:
+    /** Destructor. */
+    virtual ~PartitionStateHandler() {}
+
+    /** Save the current state, under the given checkpoint identifier. */
+    virtual void saveState (const CheckpointID_T&) = 0;
+
+    /**
+     * Restore the state saved under the given checkpoint identifier. The
+     * checkpoint stays valid, and may be restored again.
+     */
+    virtual void restoreState (const CheckpointID_T&) = 0;
+
+    /**
+     * Discard the state saved under the given checkpoint identifier: it
+     * will never be restored.
+     */
+    virtual void discardState (const CheckpointID_T&) = 0;
+  };
+
+  /**
+   * List of state handlers, one per partition. A NULL state handler
+   * stands for an event handler without any state (which never needs to
+   * be restored).
+   */
+  typedef std::vector<PartitionStateHandler*> PartitionStateHandlerList_T;
+
+}
+#endif // __SEVMGR_SEVMGR_PARTITIONTYPES_HPP
@@ -0,0 +1,48 @@
+#ifndef __SEVMGR_SEVMGR_PIPELINETYPES_HPP
+#define __SEVMGR_SEVMGR_PIPELINETYPES_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <vector>
+
+// Forward declarations
+namespace stdair {
+  struct EventStruct;
+}
+
+namespace SEVMGR {
+
+  // //////// Type definitions for the pipelined simulations /////////
+  /**
+   * @brief Interface of the generators of events (e.g., the demand
+   * streams drawing their next booking request), called by the
+   * background generation thread of the pipelined simulations.
+   */
+  class PipelineEventGenerator {
+  public:
+    /** Destructor. */
+    virtual ~PipelineEventGenerator() {}
+
+    /**
+     * Generate the next event, if any. The events of a generator must
+     * be generated in chronological order.
+     *
+     * \note That method is called by the generation thread, while the
+     *       events already generated are handled by the simulation
+     *       thread: it must not alter any state shared with the event
+     *       handlers (or protect it).
+     *
+     * @param stdair::EventStruct& Generated event.
+     * @return bool Whether an event has been generated, i.e., false once
+     *         the generator is exhausted.
+     */
+    virtual bool generateNextEvent (stdair::EventStruct&) = 0;
+  };
+
+  /** List of event generators. */
+  typedef std::vector<PipelineEventGenerator*> PipelineEventGeneratorList_T;
+
+}
+#endif // __SEVMGR_SEVMGR_PIPELINETYPES_HPP
@@ -0,0 +1,253 @@
+#ifndef __SEVMGR_SEVMGR_RUNTYPES_HPP
+#define __SEVMGR_SEVMGR_RUNTYPES_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <bitset>
+#include <cassert>
+#include <limits>
+#include <string>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_date_time_types.hpp>
+#include <stdair/basic/EventType.hpp>
+#include <stdair/bom/EventStruct.hpp>
+
+namespace SEVMGR {
+
+  // //////// Type definitions for the runs with stop conditions /////////
+  /** Define a set of event types. */
+  typedef std::bitset<stdair::EventType::LAST_VALUE> EventTypeSet_T;
+
+  /**
+   * Enumeration of the reasons for which a run has stopped.
+   * <ul>
+   *   <li>QUEUE_DONE: all the events have been played.</li>
+   *   <li>DATE_TIME: the next event is later than the given date-time.</li>
+   *   <li>EVENT_COUNT: the given number of events has been played.</li>
+   *   <li>EVENT_TYPE: an event of one of the given types has been
+   *       played.</li>
+   *   <li>PREDICATE: the given predicate has held for the last played
+   *       event.</li>
+   * </ul>
+   */
+  struct RunStopReason {
+    typedef enum {
+      QUEUE_DONE = 0,
+      DATE_TIME,
+      EVENT_COUNT,
+      EVENT_TYPE,
+      PREDICATE,
+      LAST_VALUE
+    } EN_RunStopReason;
+
+    /** Get the label as a string (e.g., "QueueDone" or "DateTime"). */
+    static const std::string& getLabel (const EN_RunStopReason& iReason) {
+      static const std::string _labels[LAST_VALUE + 1] =
+        { "QueueDone", "DateTime", "EventCount", "EventType", "Predicate",
+          "Unknown" };
+      return _labels[iReason];
+    }
+  };
+
+  /**
+   * @brief Conditions on which a run (see SEVMGR_Service::run()) stops,
+   * before the event queue is done. Any combination of them may be
+   * set; the run stops as soon as one of them is met:
+   * <ul>
+   *   <li>the next event is later than a given date-time (it is left
+   *       within the event queue);</li>
+   *   <li>a given number of events has been played;</li>
+   *   <li>an event of a given type has been played (e.g., a break
+   *       point);</li>
+   *   <li>a user predicate, called with each played event, returns
+   *       true.</li>
+   * </ul>
+   *
+   * As for the event handlers (see EventHandlerRegistry), the predicate
+   * may be any function object; it is called through a small function
+   * generated for its exact type, i.e., without any virtual call. It is
+   * not copied: it must outlive the condition.
+   */
+  class RunStopCondition {
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. The run stops only when the event queue is done. */
+    RunStopCondition()
+      : _hasUntilDateTime (false),
+        _maxNbOfEvents (std::numeric_limits<stdair::Count_T>::max()),
+        _predicate_ptr (NULL), _predicateFunction_ptr (NULL) {
+    }
+
+  public:
+    // /////////// Getters ///////////////
+    /** State whether the run stops at a given date-time. */
+    bool hasUntilDateTime() const {
+      return _hasUntilDateTime;
+    }
+
+    /** Get the date-time after which the events are not played. */
+    const stdair::DateTime_T& getUntilDateTime() const {
+      assert (_hasUntilDateTime == true);
+      return _untilDateTime;
+    }
+
+    /** Get the maximum number of events to be played. */
+    const stdair::Count_T& getMaxNbOfEvents() const {
+      return _maxNbOfEvents;
+    }
+
+    /** Get the event types, an event of which stops the run. */
+    const EventTypeSet_T& getStopEventTypeSet() const {
+      return _stopEventTypeSet;
+    }
+
+    /** State whether an event of the given type stops the run. */
+    bool isStopEventType (const stdair::EventType::EN_EventType& iType) const {
+      assert (iType < stdair::EventType::LAST_VALUE);
+      return _stopEventTypeSet.test (iType);
+    }
+
+    /** State whether a predicate has been set. */
+    bool hasPredicate() const {
+      return (_predicateFunction_ptr != NULL);
+    }
+
+  public:
+    // /////////// Setters ///////////////
+    /**
+     * Set the date-time up to which (included) the events are played.
+     * The first later event, if any, is left within the event queue.
+     */
+    void setUntilDateTime (const stdair::DateTime_T& iDateTime) {
+      _untilDateTime = iDateTime;
+      _hasUntilDateTime = true;
+    }
+
+    /** Set the maximum number of events to be played. */
+    void setMaxNbOfEvents (const stdair::Count_T& iMaxNbOfEvents) {
+      _maxNbOfEvents = iMaxNbOfEvents;
+    }
+
+    /** Set the event types, an event of which stops the run. */
+    void setStopEventTypeSet (const EventTypeSet_T& iEventTypeSet) {
+      _stopEventTypeSet = iEventTypeSet;
+    }
+
+    /** Add an event type, an event of which stops the run. */
+    void addStopEventType (const stdair::EventType::EN_EventType& iType) {
+      assert (iType < stdair::EventType::LAST_VALUE);
+      _stopEventTypeSet.set (iType);
+    }
+
+    /**
+     * Set the predicate, called with each played event (once given to
+     * its handler, if any): the run stops as soon as it returns true.
+     *
+     * @param PREDICATE& Function object, callable with a
+     *        <tt>const stdair::EventStruct&</tt>, and returning a bool.
+     */
+    template <typename PREDICATE>
+    void setPredicate (PREDICATE& ioPredicate) {
+      _predicate_ptr = static_cast<void*> (&ioPredicate);
+      _predicateFunction_ptr = &RunStopCondition::evaluate<PREDICATE>;
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Call the predicate, which must have been set (see hasPredicate()),
+     * with the given event.
+     */
+    bool checkPredicate (const stdair::EventStruct& iEventStruct) const {
+      assert (_predicateFunction_ptr != NULL);
+      return _predicateFunction_ptr (_predicate_ptr, iEventStruct);
+    }
+
+  private:
+    // ////////// Helpers /////////
+    /** Type of the functions calling the predicates. */
+    typedef bool (*PredicateFunction_T) (void*, const stdair::EventStruct&);
+
+    /** Call the given predicate, of the given type, with the given event. */
+    template <typename PREDICATE>
+    static bool evaluate (void* ioPredicate_ptr,
+                          const stdair::EventStruct& iEventStruct) {
+      PREDICATE& lPredicate = *static_cast<PREDICATE*> (ioPredicate_ptr);
+      return lPredicate (iEventStruct);
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /** Date-time up to which (included) the events are played, if any. */
+    bool _hasUntilDateTime;
+    stdair::DateTime_T _untilDateTime;
+
+    /** Maximum number of events to be played. */
+    stdair::Count_T _maxNbOfEvents;
+
+    /** Event types, an event of which stops the run. */
+    EventTypeSet_T _stopEventTypeSet;
+
+    /** Predicate, if any, and the function calling it. */
+    void* _predicate_ptr;
+    PredicateFunction_T _predicateFunction_ptr;
+  };
+
+  /**
+   * @brief Report of a run (see SEVMGR_Service::run()): number of played
+   * events, time it took, and reason for which it stopped.
+   */
+  class RunReport {
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    RunReport (const stdair::Count_T& iNbOfEvents,
+               const stdair::Count_T& iNbOfHandledEvents,
+               const double& iElapsedTime,
+               const RunStopReason::EN_RunStopReason& iStopReason)
+      : _nbOfEvents (iNbOfEvents), _nbOfHandledEvents (iNbOfHandledEvents),
+        _elapsedTime (iElapsedTime), _stopReason (iStopReason) {
+    }
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the number of played (i.e., removed from the queue) events. */
+    const stdair::Count_T& getNbOfEvents() const {
+      return _nbOfEvents;
+    }
+
+    /** Get the number of events given to the handlers. */
+    const stdair::Count_T& getNbOfHandledEvents() const {
+      return _nbOfHandledEvents;
+    }
+
+    /** Get the (wall-clock) duration of the run, in seconds. */
+    const double& getElapsedTime() const {
+      return _elapsedTime;
+    }
+
+    /** Get the reason for which the run has stopped. */
+    const RunStopReason::EN_RunStopReason& getStopReason() const {
+      return _stopReason;
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /** Number of played events. */
+    stdair::Count_T _nbOfEvents;
+
+    /** Number of events given to the handlers. */
+    stdair::Count_T _nbOfHandledEvents;
+
+    /** Duration of the run, in seconds. */
+    double _elapsedTime;
+
+    /** Reason for which the run has stopped. */
+    RunStopReason::EN_RunStopReason _stopReason;
+  };
+
+}
+#endif // __SEVMGR_SEVMGR_RUNTYPES_HPP
@@ -10,9 +10,18 @@
 #include <stdair/stdair_service_types.hpp>
 #include <stdair/bom/EventTypes.hpp>
 #include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Types.hpp>
+#include <sevmgr/SEVMGR_PartitionTypes.hpp>
+#include <sevmgr/SEVMGR_ConcurrentTypes.hpp>
+#include <sevmgr/SEVMGR_DispatchTypes.hpp>
+#include <sevmgr/SEVMGR_PipelineTypes.hpp>
+#include <sevmgr/SEVMGR_RunTypes.hpp>
+#include <sevmgr/SEVMGR_BrowserTypes.hpp>
 
 // Forward declarations
 namespace stdair {
+  struct ProgressStatus;
   struct ProgressStatusSet;
   struct BasLogParams;
   struct BasDBParams;
@@ -46,8 +55,12 @@ namespace SEVMGR {
      *
      * @param const stdair::BasLogParams& Parameters for the output log stream.
      * @param const stdair::BasDBParams& Parameters for the database access.
+     * @param const EventQueueBackendType::EN_EventQueueBackendType&
+     *        Type of the storage backend of the event queue.
      */
-    SEVMGR_Service (const stdair::BasLogParams&, const stdair::BasDBParams&);
+    SEVMGR_Service (const stdair::BasLogParams&, const stdair::BasDBParams&,
+                    const EventQueueBackendType::EN_EventQueueBackendType& =
+                    EventQueueBackendType::MAP);
 
     /**
      * Constructor.
@@ -59,8 +72,12 @@ namespace SEVMGR {
      * can be directed onto that stream.
      *
      * @param const stdair::BasLogParams& Parameters for the output log stream.
+     * @param const EventQueueBackendType::EN_EventQueueBackendType&
+     *        Type of the storage backend of the event queue.
      */
-    SEVMGR_Service (const stdair::BasLogParams&);
+    SEVMGR_Service (const stdair::BasLogParams&,
+                    const EventQueueBackendType::EN_EventQueueBackendType& =
+                    EventQueueBackendType::MAP);
 
     /**
      * Constructor.
@@ -76,8 +93,12 @@ namespace SEVMGR {
      * initialised by another library service such as TVLSIM_Service).
      *
      * @param stdair::STDAIR_ServicePtr_T Handler on the STDAIR_Service.
+     * @param const EventQueueBackendType::EN_EventQueueBackendType&
+     *        Type of the storage backend of the event queue.
      */
-    SEVMGR_Service (stdair::STDAIR_ServicePtr_T);
+    SEVMGR_Service (stdair::STDAIR_ServicePtr_T,
+                    const EventQueueBackendType::EN_EventQueueBackendType& =
+                    EventQueueBackendType::MAP);
     
     /**
      * Destructor.
@@ -142,6 +163,180 @@ namespace SEVMGR {
      */
     stdair::ProgressStatusSet popEvent (stdair::EventStruct&) const;
 
+    /**
+     * Remove the next coming (in time) event from the event queue, and
+     * give access to it without copying it.
+     *
+     * Contrary to popEvent(), the event structure is neither copied
+     * nor erased: it stays within the event queue until the next call
+     * altering that latter (adding, popping or extracting events, or
+     * resetting the queue). The reference counters of its payload are
+     * thus not altered. The progress statuses are updated as with
+     * popEvent().
+     *
+     * @param const stdair::EventStruct*& Pointer, set on the extracted
+     *   event structure. It is valid only until the next call altering
+     *   the event queue: copy the event structure to keep it longer.
+     * @return stdair::ProgressStatusSet The progress statuses, updated
+     *   to account for the extracted event.
+     */
+    stdair::ProgressStatusSet extractEvent (const stdair::EventStruct*&) const;
+
+    /**
+     * Give access to the next coming (in time) event, without removing
+     * it from the event queue, nor altering the progress statuses.
+     *
+     * @return const stdair::EventStruct* Pointer on the next event, or
+     *   NULL when the event queue is empty. It is valid only until the
+     *   next call altering the event queue.
+     */
+    const stdair::EventStruct* peekNextEvent() const;
+
+    /**
+     * Get the date-time of the next coming (in time) event, without
+     * removing it from the event queue, nor altering the progress
+     * statuses.
+     *
+     * @return stdair::DateTime_T Date-time of the next event, or
+     *   not-a-date-time when the event queue is empty.
+     */
+    stdair::DateTime_T getNextEventDateTime() const;
+
+    /**
+     * Browse lazily the next coming (in time) events, up to (and
+     * including) the given date-time.
+     * <ul>
+     *   <li>The events are given in the order they would be popped,
+     *     the cancelled ones being skipped.</li>
+     *   <li>They are neither removed nor copied, and the progress
+     *     statuses are left untouched.</li>
+     *   <li>Browsing the k next events costs (roughly) O(k), whatever
+     *     the number of events within the queue.</li>
+     * </ul>
+     *
+     * @param const stdair::DateTime_T& Horizon of the browsing.
+     * @return EventBrowserPtr_T Browser of the events. It is valid only
+     *   until the next call altering the event queue.
+     */
+    EventBrowserPtr_T browseEvents (const stdair::DateTime_T&) const;
+
+    /**
+     * Browse lazily, in chronological order, the events the date-times
+     * of which are within the given range [from, to), the cancelled
+     * ones being skipped.
+     *
+     * @param const stdair::DateTime_T& Start (included) of the range.
+     * @param const stdair::DateTime_T& End (excluded) of the range.
+     * @return EventBrowserPtr_T Browser of the events. It is valid only
+     *   until the next call altering the event queue.
+     */
+    EventBrowserPtr_T browseEvents (const stdair::DateTime_T&,
+                                    const stdair::DateTime_T&) const;
+
+    /**
+     * Browse lazily, in chronological order, the events of the given
+     * type, the date-times of which are within the given range
+     * [from, to).
+     */
+    EventBrowserPtr_T browseEvents (const stdair::DateTime_T&,
+                                    const stdair::DateTime_T&,
+                                    const stdair::EventType::EN_EventType&) const;
+
+    /**
+     * Get the number of events of the queue, the date-times of which are
+     * within the given range [from, to). The cancelled events are not
+     * counted.
+     *
+     * The cost is logarithmic when the events are indexed by date-time
+     * (see setQueueTimeIndexed()), and linear in the number of events of
+     * the range otherwise.
+     *
+     * @param const stdair::DateTime_T& Start (included) of the range.
+     * @param const stdair::DateTime_T& End (excluded) of the range.
+     * @return stdair::Count_T Number of events.
+     */
+    stdair::Count_T countEvents (const stdair::DateTime_T&,
+                                 const stdair::DateTime_T&) const;
+
+    /**
+     * Get the number of events of the given type (e.g., booking
+     * requests), the date-times of which are within the given range
+     * [from, to).
+     */
+    stdair::Count_T countEvents (const stdair::DateTime_T&,
+                                 const stdair::DateTime_T&,
+                                 const stdair::EventType::EN_EventType&) const;
+
+    /**
+     * Pop (at most) the given number of next coming (in time) events,
+     * and remove them from the event queue.
+     * <ul>
+     *   <li>The popped events are appended, in chronological order, to
+     *     the given list. Events having the same date-time are kept in
+     *     the order they were added.</li>
+     *   <li>The progress statuses are updated once per batch, rather
+     *     than once per event.</li>
+     *   <li>When the event queue is empty, no event is popped.</li>
+     * </ul>
+     *
+     * @param EventStructList_T& List to which the popped events are
+     *        appended.
+     * @param const stdair::Count_T& Maximum number of events to be popped.
+     * @return stdair::ProgressStatusSet The progress statuses after the
+     *   batch, i.e., the same as popEvent() would have returned for the
+     *   last popped event.
+     */
+    stdair::ProgressStatusSet popEvents (EventStructList_T&,
+                                         const stdair::Count_T&) const;
+
+    /**
+     * Pop all the events occurring at, or before, the given date-time,
+     * and remove them from the event queue.
+     *
+     * \see popEvents() for more details.
+     *
+     * @param EventStructList_T& List to which the popped events are
+     *        appended.
+     * @param const stdair::DateTime_T& Date-time up to which (included)
+     *        the events are popped.
+     * @return stdair::ProgressStatusSet The progress statuses after the
+     *   batch.
+     */
+    stdair::ProgressStatusSet popEventsUntil (EventStructList_T&,
+                                              const stdair::DateTime_T&) const;
+
+    /**
+     * Remove all the events occurring strictly before the given
+     * date-time from the event queue, without copying them.
+     * <ul>
+     *   <li>With the map and sharded backends, the events are removed as
+     *     one range, found by a logarithmic search, rather than popped
+     *     one by one.</li>
+     *   <li>The progress statuses are updated once per event type, for
+     *     the whole range.</li>
+     * </ul>
+     *
+     * @param const stdair::DateTime_T& Date-time before which (excluded)
+     *        the events are removed.
+     * @return stdair::Count_T Number of removed events.
+     */
+    stdair::Count_T skipEventsBefore (const stdair::DateTime_T&) const;
+
+    /**
+     * Pop all the events occurring strictly before the given date-time,
+     * and append them, in chronological order, to the given list.
+     *
+     * \see skipEventsBefore() for more details.
+     *
+     * @param EventStructList_T& List to which the popped events are
+     *        appended.
+     * @param const stdair::DateTime_T& Date-time before which (excluded)
+     *        the events are popped.
+     * @return stdair::Count_T Number of popped events.
+     */
+    stdair::Count_T popEventsBefore (EventStructList_T&,
+                                     const stdair::DateTime_T&) const;
+
 
     /**
      * Played all events and stopped when the first break point was encountered.
@@ -152,6 +347,191 @@ namespace SEVMGR {
      */
     void run (stdair::EventStruct&) const;
 
+    /**
+     * Play the events, each one being given, in place (i.e., without
+     * any copy), to the handler registered for its type, until all the
+     * events have been played, or a break point without handler has been
+     * encountered. The events without handler are played, but dropped.
+     *
+     * The handlers may add events to the event queue (e.g., the next
+     * booking request of a demand stream): those events are played
+     * within the same run. They must not pop events, though.
+     *
+     * @param const EventHandlerRegistry& Handlers, by event type.
+     * @return stdair::Count_T Number of events given to the handlers.
+     */
+    stdair::Count_T run (const EventHandlerRegistry&) const;
+
+    /**
+     * Play the events, as with run(const EventHandlerRegistry&), until
+     * the event queue is done, or the given stop condition is met (e.g.,
+     * a simulated date-time has been reached, a number of events has
+     * been played). Contrary to the former, a break point without
+     * handler does not stop the run, unless requested by the condition.
+     *
+     * @param const EventHandlerRegistry& Handlers, by event type.
+     * @param const RunStopCondition& Conditions on which the run stops.
+     * @return RunReport Number of played (and handled) events, duration
+     *         of the run, and reason for which it stopped.
+     */
+    RunReport run (const EventHandlerRegistry&,
+                   const RunStopCondition&) const;
+
+    /**
+     * Play the events occurring up to the given date-time (included),
+     * without having to add a break point.
+     *
+     * \see run(const EventHandlerRegistry&, const RunStopCondition&).
+     */
+    RunReport runUntil (const stdair::DateTime_T&,
+                        const EventHandlerRegistry&) const;
+
+    /**
+     * Play (at most) the given number of events.
+     *
+     * \see run(const EventHandlerRegistry&, const RunStopCondition&).
+     */
+    RunReport runFor (const stdair::Count_T&,
+                      const EventHandlerRegistry&) const;
+
+    /**
+     * Play the events, until an event of one of the given types has
+     * been played (that event included).
+     *
+     * \see run(const EventHandlerRegistry&, const RunStopCondition&).
+     */
+    RunReport runUntil (const EventTypeSet_T&,
+                        const EventHandlerRegistry&) const;
+
+    /**
+     * Play the events, until the given predicate, called with each
+     * played event, returns true (that event included). The predicate
+     * is called through a function generated for its exact type (no
+     * virtual call).
+     *
+     * \see run(const EventHandlerRegistry&, const RunStopCondition&).
+     */
+    template <typename PREDICATE>
+    RunReport runUntilPredicate (PREDICATE& ioPredicate,
+                                 const EventHandlerRegistry& iRegistry) const {
+      RunStopCondition lStopCondition;
+      lStopCondition.setPredicate (ioPredicate);
+      return run (iRegistry, lStopCondition);
+    }
+
+    /**
+     * Play the events in a pipelined way: the generators are called by
+     * a background thread, which keeps the event queue filled up to the
+     * given horizon ahead of the simulated date-time, while the calling
+     * thread plays the events, each one being given, in place, to the
+     * handler registered for its type (the events without handler are
+     * played, but dropped). The events are handed over through a
+     * lock-free buffer, so that generation and handling overlap.
+     *
+     * The events already in the event queue are played as well. The
+     * event types must all have a progress status (see addStatus()).
+     * The run ends once all the generators are exhausted and all the
+     * events have been played.
+     *
+     * @param const PipelineEventGeneratorList_T& Event generators.
+     * @param const stdair::Duration_T& Horizon of the generation, ahead
+     *        of the simulated date-time.
+     * @param const EventHandlerRegistry& Handlers, by event type.
+     * @return stdair::Count_T Number of events given to the handlers.
+     */
+    stdair::Count_T runPipelined (const PipelineEventGeneratorList_T&,
+                                  const stdair::Duration_T& iHorizon,
+                                  const EventHandlerRegistry&) const;
+
+    /**
+     * Simulate all the events of the queue in parallel: the events are
+     * spread over partitions (e.g., by origin market), each partition
+     * being handled by its own thread and its own event handler.
+     *
+     * The partitions are synchronised conservatively: each handler gets
+     * the events of its partition in date-time order, as with a single
+     * event queue, including the events scheduled (see
+     * PartitionEventScheduler) by the handlers of the other partitions.
+     * For that, handling an event of a given type must never schedule an
+     * event into another partition earlier than the lookahead of that
+     * type; the larger the lookaheads, the more events are handled
+     * concurrently.
+     *
+     * The event types of the handled events must all have a progress
+     * status (see addStatus()) and a lookahead. The progress statuses
+     * are updated once all the events have been handled. When a handler
+     * throws an exception, the events not handled yet are put back
+     * into the queue, and the exception is thrown again.
+     *
+     * @param const EventPartitioner& Assignment of the events to the
+     *        partitions.
+     * @param const PartitionEventHandlerList_T& Event handlers, one per
+     *        partition (hence, their number gives the number of
+     *        partitions).
+     * @param const EventLookaheadMap_T& Lookahead of each event type.
+     * @return stdair::Count_T Number of handled events.
+     */
+    stdair::Count_T runPartitioned (const EventPartitioner&,
+                                    const PartitionEventHandlerList_T&,
+                                    const EventLookaheadMap_T&) const;
+
+    /**
+     * Simulate all the events of the event queue over several partitions,
+     * each one on its own thread, under an optimistic (Time Warp)
+     * synchronisation protocol. That mode is to be preferred when the
+     * partitions seldom interact, but no useful lookahead can be given.
+     *
+     * The events are handled speculatively: when a partition receives an
+     * event older than the ones it has already handled, it rolls back.
+     * The state of the event handlers is then restored through the given
+     * state handlers, and the events they had scheduled are cancelled.
+     * Hence, the event handlers must be deterministic, and must only
+     * alter the state saved by their state handler.
+     *
+     * @param const EventPartitioner& Assignment of the events to the
+     *        partitions.
+     * @param const PartitionEventHandlerList_T& Event handlers, one per
+     *        partition.
+     * @param const PartitionStateHandlerList_T& State handlers, either one
+     *        per partition, or none when the event handlers have no state.
+     * @param const stdair::Count_T& Number of handled events between two
+     *        checkpoints of the state of a partition.
+     * @param const stdair::Count_T& Number of handled events (per
+     *        partition) between two computations of the global virtual
+     *        time, after which the checkpoints are discarded.
+     * @return stdair::Count_T Number of handled events.
+     */
+    stdair::Count_T runOptimistic (const EventPartitioner&,
+                                   const PartitionEventHandlerList_T&,
+                                   const PartitionStateHandlerList_T&,
+                                   const stdair::Count_T& iCheckpointPeriod,
+                                   const stdair::Count_T& iGVTPeriod) const;
+
+    /**
+     * Simulate all the events of the event queue by time windows. All
+     * the events of a window (starting at the date-time of its first
+     * event) are popped, and grouped by conflict key; the groups are then
+     * handled concurrently, on a work-stealing thread pool, the events of
+     * a group being handled in date-time order. Once the window is
+     * complete, the simulation goes on with the next one.
+     *
+     * The events added to the event queue while a window is simulated
+     * (in multi-producer mode, see setQueueMultiProducer()) are handled
+     * from the next window onwards.
+     *
+     * @param const stdair::Duration_T& Length of the time windows.
+     * @param const EventConflictKeyExtractor& Conflict key of the events.
+     * @param ConcurrentEventHandler& Event handler, called concurrently
+     *        for events having different conflict keys.
+     * @param const unsigned int& Number of threads (including the calling
+     *        one).
+     * @return stdair::Count_T Number of handled events.
+     */
+    stdair::Count_T runWindowed (const stdair::Duration_T& iWindowLength,
+                                 const EventConflictKeyExtractor&,
+                                 ConcurrentEventHandler&,
+                                 const unsigned int& iNbOfThreads) const;
+
     /**
      * Selected the event with the given date time, if such event existed.
      *
@@ -169,6 +549,21 @@ namespace SEVMGR {
     bool select (stdair::EventStruct&,
                  const stdair::DateTime_T&) const;
 
+    /**
+     * Select the first event occurring at, or after, the given date
+     * time, if any.
+     *
+     * @return stdair::EventStruct A copy of the selected event, if any.
+     * @param const stdair::DateTime_T Date time from which the event is
+     *   selected.
+     * @return bool States whether an event has been selected.
+     *
+     * /Note All the events occuring before the given date time are
+     *   removed in one go (see skipEventsBefore()), and the selected one
+     *   is popped.
+     */
+    bool seek (stdair::EventStruct&, const stdair::DateTime_T&) const;
+
     /**
      * Add an event generator to the map holding the children of the queue.
      * Be careful, this method is not implemented: its implementation is
@@ -182,8 +577,84 @@ namespace SEVMGR {
     
     /**
      * Add an event to the queue.
+     *
+     * Events having the same date-time are popped in the order they
+     * were added. The date-time of the event is never altered.
+     *
+     * When the queue is in multi-producer mode (see
+     * setQueueMultiProducer()), that method may be called from several
+     * threads (e.g., demand generators, schedule change feeds), while
+     * the simulation thread pops the events.
+     *
+     * @return EventHandle Handle on the added event, allowing to cancel
+     *         it, or to reschedule it, later on (see cancelEvent()).
      */
-    void addEvent(stdair::EventStruct&) const;
+    EventHandle addEvent(const stdair::EventStruct&) const;
+
+    /**
+     * Build an event of the given type, for the given payload (e.g.,
+     * booking request, break point), and add it to the queue.
+     *
+     * That is a mere convenience wrapper over addEvent(): the event
+     * structure is built on the stack, and then copied by addEvent().
+     */
+    template <typename PAYLOAD_PTR>
+    EventHandle emplaceEvent (const stdair::EventType::EN_EventType& iEventType,
+                              const PAYLOAD_PTR& iPayload_ptr) const {
+      const stdair::EventStruct lEventStruct (iEventType, iPayload_ptr);
+      return addEvent (lEventStruct);
+    }
+
+    /**
+     * Cancel a queued event, e.g., a booking request for a cancelled
+     * flight, or a superseded optimisation notification, so that it is
+     * never popped.
+     *
+     * The cancellation costs a logarithmic time: the event is flagged,
+     * and dropped when it comes at the front of the queue (the queue is
+     * compacted when the cancelled events outnumber the other ones).
+     * The progress statuses are not altered.
+     *
+     * \note The events added later than the date-time already reached
+     *       by the simulation (late events) cannot be cancelled.
+     *
+     * @param const EventHandle& Handle, given when the event was added.
+     * @return bool Whether the event has been cancelled, i.e., whether
+     *         it was still queued.
+     */
+    bool cancelEvent (const EventHandle&) const;
+
+    /**
+     * Move a queued event to another date-time: as the date-time of an
+     * event is given by its payload, the event is replaced by the given
+     * one (e.g., built from an updated payload), in logarithmic time.
+     *
+     * @param const EventHandle& Handle on the event to be replaced.
+     * @param const stdair::EventStruct& Replacing event.
+     * @return EventHandle Handle on the replacing event. It refers to no
+     *         event when the replaced one was no longer queued, in which
+     *         case the given event is not added.
+     */
+    EventHandle rescheduleEvent (const EventHandle&,
+                                 const stdair::EventStruct&) const;
+
+    /**
+     * State whether the event referred to by the given handle is still
+     * queued, i.e., it has been neither played nor cancelled.
+     */
+    bool isEventQueued (const EventHandle&) const;
+
+    /**
+     * Add a list (batch) of events to the queue, e.g., the first event
+     * of every demand stream at the start of the simulation.
+     *
+     * The events are ordered as if they had been added one by one with
+     * addEvent(), in the list order; but the event queue is built in
+     * one go, in O(n log n) (or linear) time, rather than event by event.
+     * As with addEvent(), the progress statuses are not altered: they
+     * are declared with addStatus(), once per event type.
+     */
+    void addEvents(const EventStructList_T&) const;
 
     /**
      * Reset the context of the event generators for another event generation
@@ -191,6 +662,60 @@ namespace SEVMGR {
      */
     void reset() const;
 
+    /**
+     * Set the type of the storage backend of the event queue (e.g.,
+     * map, d-ary heap).
+     *
+     * The events already in the queue, if any, are kept. The map
+     * backend is the reference one; the d-ary heap backend is more
+     * cache-friendly when the queue holds a lot of events; the
+     * calendar backend is the fastest one when the events are rather
+     * evenly spread over time. The pooled map backend draws its nodes
+     * from slabs owned by the event queue, which are recycled when the
+     * queue is reset: it fits simulations replicated many times. The
+     * compact heap backend only orders small entries, the event
+     * structures being kept aside, per event type. The
+     * backend may also be chosen when the service is constructed.
+     *
+     * @param const EventQueueBackendType::EN_EventQueueBackendType&
+     *        Type of the storage backend.
+     */
+    void setQueueBackendType (const EventQueueBackendType::EN_EventQueueBackendType&) const;
+
+    /**
+     * Get the type of the storage backend of the event queue.
+     */
+    EventQueueBackendType::EN_EventQueueBackendType getQueueBackendType() const;
+
+    /**
+     * Set whether the events may be added (with addEvent() or
+     * addEvents()) from several threads, while the simulation thread
+     * pops them (multi-producer, single-consumer mode).
+     *
+     * Any event added before a pop is taken into account by that pop.
+     * Hence, the events are popped in chronological order, as long as
+     * the producers do not add events older than the ones already
+     * popped (such late events are popped next). All the other methods
+     * must be called from the simulation thread, and the mode must be
+     * set before the producers start.
+     */
+    void setQueueMultiProducer (const bool&) const;
+
+    /**
+     * State whether the events may be added from several threads.
+     */
+    bool isQueueMultiProducer() const;
+
+    /**
+     * Set whether the events of the queue are indexed by date-time, for
+     * each event type, so that the number of events within a date-time
+     * range (see countEvents()) be given in logarithmic time.
+     *
+     * The index costs a logarithmic time at each addition, removal or
+     * cancellation of an event. It is off by default.
+     */
+    void setQueueTimeIndexed (const bool&) const;
+
     /**
      * Update the progress status for the given event type (e.g., booking
      * request, optimisation notification, schedule change, break point).
@@ -234,11 +759,62 @@ namespace SEVMGR {
      */
     EventQueue& getEventQueue() const;
 
+    /**
+     * Add another (empty) event queue, with the given ID, on top of the
+     * given storage backend.
+     *
+     * A service may hold several independent event queues, e.g., one
+     * per market or per simulation scenario, all sharing the same StdAir
+     * service. The other methods of the service (e.g., addEvent(),
+     * popEvent(), addStatus()) work on the selected event queue (see
+     * selectEventQueue()). The event queue created at the construction
+     * of the service has the "EQ01" ID, and is selected by default.
+     *
+     * \note An EventQueueException exception is thrown when there is
+     *       already an event queue with the given ID.
+     *
+     * @param const EventQueueID_T& ID of the event queue.
+     * @param const EventQueueBackendType::EN_EventQueueBackendType&
+     *        Type of the storage backend of the event queue.
+     */
+    void addEventQueue (const EventQueueID_T&,
+                        const EventQueueBackendType::EN_EventQueueBackendType& =
+                        EventQueueBackendType::MAP) const;
+
+    /**
+     * State whether there is an event queue with the given ID.
+     */
+    bool hasEventQueue (const EventQueueID_T&) const;
+
+    /**
+     * Select the event queue with the given ID, so that the other
+     * methods of the service work on it.
+     *
+     * \note An EventQueueException exception is thrown when there is
+     *       no event queue with the given ID.
+     */
+    void selectEventQueue (const EventQueueID_T&) const;
+
+    /**
+     * Get a reference on the event queue with the given ID.
+     *
+     * \note An EventQueueException exception is thrown when there is
+     *       no event queue with the given ID.
+     */
+    EventQueue& getEventQueue (const EventQueueID_T&) const;
+
     /**
      * Get the size of the queue.
      */
     const stdair::Count_T getQueueSize() const;
 
+    /**
+     * Get the number of events of the given type within the queue. With
+     * the sharded backend (see setQueueBackendType()), only the events
+     * of that type are counted, in constant time.
+     */
+    stdair::Count_T getQueueSize (const stdair::EventType::EN_EventType&) const;
+
     /**
      * Extract an event generator from the map holding the children of the
      * queue.
@@ -366,6 +942,27 @@ namespace SEVMGR {
      */
     const stdair::ProgressStatus& getStatus (const stdair::EventType::EN_EventType&) const;
 
+    /**
+     * Get (a consistent copy of) the overall progress status.
+     *
+     * Contrary to getStatus(), that method may be called from any
+     * thread (e.g., a monitoring one), while the events are popped by
+     * another one. It never blocks the popping thread: it reads the
+     * counters last published by that latter (after each pop, or once
+     * per batch of pops). The progress percentage may be obtained by
+     * calling progress() on the returned object.
+     */
+    stdair::ProgressStatus getMonitoredStatus () const;
+
+    /**
+     * Get (a consistent copy of) both the overall progress status and the
+     * one specific to the given event type, taken at the same point in
+     * time. That method may be called from any thread, like
+     * getMonitoredStatus() above.
+     */
+    stdair::ProgressStatusSet
+    getMonitoredStatus (const stdair::EventType::EN_EventType&) const;
+
   public:
     // //////////////// Display support methods /////////////////
 
@@ -435,8 +1032,11 @@ namespace SEVMGR {
     /**
      * Initialise the (SEVMGR) service context (i.e., the
      * SEVMGR_ServiceContext object).
+     *
+     * @param const EventQueueBackendType::EN_EventQueueBackendType&
+     *        Type of the storage backend of the event queue.
      */
-    void initServiceContext();
+    void initServiceContext (const EventQueueBackendType::EN_EventQueueBackendType&);
 
     /**
      * Initialise the STDAIR service (including the log service).
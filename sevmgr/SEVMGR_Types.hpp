@@ -4,14 +4,24 @@
 // //////////////////////////////////////////////////////////////////////
 // Import section
 // //////////////////////////////////////////////////////////////////////
+// STL
+#include <map>
+#include <string>
+#include <vector>
 // Boost
 #include <boost/shared_ptr.hpp>
 // Stdair
+#include <stdair/stdair_date_time_types.hpp>
 #include <stdair/basic/ProgressStatusSet.hpp>
 #include <stdair/basic/EventType.hpp>
 // Sevmgr
 #include <sevmgr/SEVMGR_Exceptions.hpp>
 
+// Forward declarations
+namespace stdair {
+  struct EventStruct;
+}
+
 namespace SEVMGR {
 
   // Forward declarations
@@ -26,6 +36,80 @@ namespace SEVMGR {
   /** Define an ID for an EventQueue object. */
   typedef std::string EventQueueID_T;  
 
+  /**
+   * Define a list (batch) of event structures, e.g., to be added in
+   * one go into the event queue.
+   */
+  typedef std::vector<stdair::EventStruct> EventStructList_T;
+
+  /**
+   * Define the insertion sequence number of an event, which orders the
+   * events having the same date-time stamp.
+   */
+  typedef unsigned long long EventSequence_T;
+
+  /**
+   * @brief Handle on an event added to an event queue, allowing to
+   * cancel it, or to reschedule it, later on (see
+   * SEVMGR_Service::cancelEvent()).
+   *
+   * The handle identifies the event by its position within the queue,
+   * i.e., (date-time stamp, insertion sequence number): it remains
+   * valid as long as the event is queued, whatever the storage backend
+   * and however many events are added or removed in the meantime. A
+   * default-constructed handle refers to no event.
+   */
+  class EventHandle {
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor of a handle referring to no event. */
+    EventHandle()
+      : _timeStamp (0), _sequence (0),
+        _eventType (stdair::EventType::LAST_VALUE) {
+    }
+
+    /** Constructor. */
+    EventHandle (const stdair::LongDuration_T& iTimeStamp,
+                 const EventSequence_T& iSequence,
+                 const stdair::EventType::EN_EventType& iEventType)
+      : _timeStamp (iTimeStamp), _sequence (iSequence),
+        _eventType (iEventType) {
+    }
+
+  public:
+    // /////////// Getters ///////////////
+    /** State whether the handle refers to an event. */
+    bool isValid() const {
+      return (_eventType != stdair::EventType::LAST_VALUE);
+    }
+
+    /** Get the date-time stamp of the event. */
+    const stdair::LongDuration_T& getTimeStamp() const {
+      return _timeStamp;
+    }
+
+    /** Get the insertion sequence number of the event. */
+    const EventSequence_T& getSequence() const {
+      return _sequence;
+    }
+
+    /** Get the type of the event. */
+    const stdair::EventType::EN_EventType& getEventType() const {
+      return _eventType;
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /** Date-time stamp of the event. */
+    stdair::LongDuration_T _timeStamp;
+
+    /** Insertion sequence number of the event. */
+    EventSequence_T _sequence;
+
+    /** Type of the event (LAST_VALUE when referring to no event). */
+    stdair::EventType::EN_EventType _eventType;
+  };
+
   /**
    * Definition of the (STL) map of ProgressStatus structures, one
    * for each event type (e.g., booking request, optimisation
@@ -33,7 +117,63 @@ namespace SEVMGR {
    */
   typedef std::map<stdair::EventType::EN_EventType,
 		   stdair::ProgressStatus> ProgressStatusMap_T;
-  
+
+  /**
+   * Enumeration of the storage backends on which an EventQueue object
+   * may keep its events ordered by date-time.
+   * <ul>
+   *   <li>MAP: (STL) map keyed by the date-time stamp. That is the
+   *       reference implementation.</li>
+   *   <li>DARY_HEAP: 4-ary implicit heap, stored in a contiguous
+   *       array.</li>
+   *   <li>CALENDAR: calendar queue, i.e., an array of time buckets,
+   *       the width and number of which tune themselves.</li>
+   *   <li>POOLED_MAP: same as MAP, but the tree nodes are drawn from
+   *       slabs owned by the event queue, which are kept (and recycled
+   *       in constant time) when the queue is reset.</li>
+   *   <li>COMPACT_HEAP: 4-ary implicit heap of compact entries (date-time
+   *       stamp, event type and payload index), the event structures
+   *       being stored aside, in per event type arenas.</li>
+   *   <li>SHARDED: one ordered sub-queue per event type, merged by a
+   *       tournament tree; the events of a given type are then counted
+   *       and listed without browsing the other ones.</li>
+   * </ul>
+   */
+  struct EventQueueBackendType {
+    typedef enum {
+      MAP = 0,
+      DARY_HEAP,
+      CALENDAR,
+      POOLED_MAP,
+      COMPACT_HEAP,
+      SHARDED,
+      LAST_VALUE
+    } EN_EventQueueBackendType;
+
+    /** Get the label as a string (e.g., "Map" or "DAryHeap"). */
+    static const std::string& getLabel (const EN_EventQueueBackendType& iType) {
+      static const std::string _labels[LAST_VALUE + 1] =
+        { "Map", "DAryHeap", "Calendar", "PooledMap", "CompactHeap",
+          "Sharded", "Unknown" };
+      return _labels[iType];
+    }
+
+    /**
+     * Get the backend type corresponding to the given label. When the
+     * label is not known, LAST_VALUE is returned.
+     */
+    static EN_EventQueueBackendType getType (const std::string& iLabel) {
+      for (unsigned short idx = 0; idx != LAST_VALUE; ++idx) {
+        const EN_EventQueueBackendType lType =
+          static_cast<EN_EventQueueBackendType> (idx);
+        if (iLabel == getLabel (lType)) {
+          return lType;
+        }
+      }
+      return LAST_VALUE;
+    }
+  };
+
 }
 #endif // __SEVMGR_SEVMGR_TYPES_HPP
 
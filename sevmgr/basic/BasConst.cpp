@@ -15,4 +15,13 @@ namespace SEVMGR {
   /** Default ID for the event queue. */
   const EventQueueID_T DEFAULT_EVENT_QUEUE_ID ("EQ01");
 
+  /** Default storage backend for the event queue: the reference (STL)
+      map. */
+  const EventQueueBackendType::EN_EventQueueBackendType
+  DEFAULT_EVENT_QUEUE_BACKEND (EventQueueBackendType::MAP);
+
+  /** Default capacity of the buffer between the generation thread and
+      the simulation thread, for the pipelined simulations. */
+  const unsigned int DEFAULT_EVENT_PIPELINE_BUFFER_CAPACITY (4096);
+
 }
@@ -14,5 +14,13 @@ namespace SEVMGR {
   /** Default ID for the event queue. */
   extern const EventQueueID_T DEFAULT_EVENT_QUEUE_ID;
 
+  /** Default storage backend for the event queue. */
+  extern const EventQueueBackendType::EN_EventQueueBackendType
+  DEFAULT_EVENT_QUEUE_BACKEND;
+
+  /** Default capacity of the buffer between the generation thread and
+      the simulation thread, for the pipelined simulations. */
+  extern const unsigned int DEFAULT_EVENT_PIPELINE_BUFFER_CAPACITY;
+
 }
 #endif // __SEVMGR_BAS_BASCONST_EVENTQUEUEMANAGER_HPP
@@ -0,0 +1,417 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <random>
+//  //// Boost (Extended STL) ////
+// Boost Program Options
+#include <boost/program_options.hpp>
+#include <boost/make_shared.hpp>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_date_time_types.hpp>
+#include <stdair/basic/BasLogParams.hpp>
+#include <stdair/basic/BasChronometer.hpp>
+#include <stdair/basic/BasConst_Event.hpp>
+#include <stdair/basic/EventType.hpp>
+#include <stdair/bom/EventStruct.hpp>
+#include <stdair/bom/BreakPointStruct.hpp>
+#include <stdair/service/Logger.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Service.hpp>
+#include <sevmgr/bom/EventQueue.hpp>
+#include <sevmgr/config/sevmgr-paths.hpp>
+
+// //////// Type definitions //////
+/** List of queue sizes. */
+typedef std::vector<unsigned int> QueueSizeList_T;
+
+/** List of (hold) increments, in milliseconds. */
+typedef std::vector<stdair::LongDuration_T> IncrementList_T;
+
+/**
+ * Distributions of the increments between the date-time of a popped
+ * event and the date-time of the event re-inserted in its place. The
+ * mean increment is proportional to the size of the queue, so that
+ * there is one event per minute on average, whatever that size.
+ * <ul>
+ *   <li>UNIFORM: uniform on [0, 2 x mean]. That is the sweet spot of the
+ *       calendar queue.</li>
+ *   <li>EXPONENTIAL: exponential with the given mean, as for Poisson
+ *       arrivals (e.g., booking requests).</li>
+ *   <li>BIMODAL: most of the events are very close in time, a few of
+ *       them being far away in the future. No bucket width fits both,
+ *       which is the worst case for the calendar queue.</li>
+ *   <li>TIED: exponential, rounded to whole hours, so that a lot of
+ *       events share the same date-time stamp (e.g., snapshots, RM
+ *       events).</li>
+ * </ul>
+ */
+struct Distribution {
+  typedef enum {
+    UNIFORM = 0,
+    EXPONENTIAL,
+    BIMODAL,
+    TIED,
+    LAST_VALUE
+  } EN_Distribution;
+
+  static const std::string& getLabel (const EN_Distribution& iDistribution) {
+    static const std::string _labels[LAST_VALUE + 1] =
+      { "uniform", "exponential", "bimodal", "tied", "unknown" };
+    return _labels[iDistribution];
+  }
+};
+
+// //////// Constants //////
+/** Default name and location for the log file. */
+const stdair::Filename_T K_SEVMGR_DEFAULT_LOG_FILENAME ("sevmgr_benchmark.log");
+
+/** Default number of hold operations (pop and re-insert) per run. */
+const unsigned int K_SEVMGR_DEFAULT_NB_OF_HOLDS = 1000000;
+
+/** Default seed for the random generator. */
+const unsigned long K_SEVMGR_DEFAULT_RANDOM_SEED = 120765987;
+
+/** Mean spacing of the events: one minute, in milliseconds. */
+const double K_SEVMGR_MEAN_SPACING = 60000.0;
+
+/** One hour, in milliseconds. */
+const double K_SEVMGR_ONE_HOUR = 3600000.0;
+
+/** Early return status (so that it can be differentiated from an error). */
+const int K_SEVMGR_EARLY_RETURN_STATUS = 99;
+
+
+// ///////// Parsing of Options & Configuration /////////
+/** Read and parse the command line options. */
+int readConfiguration (int argc, char* argv[],
+                       QueueSizeList_T& ioQueueSizeList,
+                       unsigned int& ioNbOfHolds,
+                       unsigned long& ioRandomSeed,
+                       stdair::Filename_T& ioLogFilename) {
+
+  // Declare a group of options that will be allowed only on command line
+  boost::program_options::options_description generic ("Generic options");
+  generic.add_options()
+    ("prefix", "print installation prefix")
+    ("version,v", "print version string")
+    ("help,h", "produce help message");
+
+  // Declare a group of options that will be allowed both on command
+  // line and in config file
+  boost::program_options::options_description config ("Configuration");
+  config.add_options()
+    ("sizes,s",
+     boost::program_options::value< QueueSizeList_T >(&ioQueueSizeList)->multitoken(),
+     "Queue sizes (number of events held by the queue), e.g., -s 1000 100000")
+    ("holds,n",
+     boost::program_options::value< unsigned int >(&ioNbOfHolds)->default_value(K_SEVMGR_DEFAULT_NB_OF_HOLDS),
+     "Number of hold operations (pop and re-insert) per run")
+    ("seed,r",
+     boost::program_options::value< unsigned long >(&ioRandomSeed)->default_value(K_SEVMGR_DEFAULT_RANDOM_SEED),
+     "Seed for the random generator")
+    ("log,l",
+     boost::program_options::value< std::string >(&ioLogFilename)->default_value(K_SEVMGR_DEFAULT_LOG_FILENAME),
+     "Filepath for the logs")
+    ;
+
+  boost::program_options::options_description cmdline_options;
+  cmdline_options.add(generic).add(config);
+
+  boost::program_options::options_description visible ("Allowed options");
+  visible.add(generic).add(config);
+
+  boost::program_options::variables_map vm;
+  boost::program_options::
+    store (boost::program_options::command_line_parser (argc, argv).
+           options (cmdline_options).run(), vm);
+  boost::program_options::notify (vm);
+
+  if (vm.count ("help")) {
+    std::cout << visible << std::endl;
+    return K_SEVMGR_EARLY_RETURN_STATUS;
+  }
+
+  if (vm.count ("version")) {
+    std::cout << PACKAGE_NAME << ", version " << PACKAGE_VERSION << std::endl;
+    return K_SEVMGR_EARLY_RETURN_STATUS;
+  }
+
+  if (vm.count ("prefix")) {
+    std::cout << "Installation prefix: " << PREFIXDIR << std::endl;
+    return K_SEVMGR_EARLY_RETURN_STATUS;
+  }
+
+  if (ioQueueSizeList.empty() == true) {
+    ioQueueSizeList.push_back (1000);
+    ioQueueSizeList.push_back (10000);
+    ioQueueSizeList.push_back (100000);
+    ioQueueSizeList.push_back (1000000);
+  }
+
+  return 0;
+}
+
+// //////////////////////////////////////////////////////////////////////
+/**
+ * Draw the given number of increments, following the given distribution
+ * with the given mean (in milliseconds).
+ */
+void drawIncrements (const Distribution::EN_Distribution& iDistribution,
+                     const double iMeanIncrement,
+                     const unsigned int iNbOfIncrements,
+                     std::mt19937& ioGenerator,
+                     IncrementList_T& ioIncrementList) {
+  std::uniform_real_distribution<double> lUniform (0.0, 1.0);
+  std::exponential_distribution<double> lExponential (1.0);
+
+  ioIncrementList.clear();
+  ioIncrementList.reserve (iNbOfIncrements);
+  for (unsigned int idx = 0; idx != iNbOfIncrements; ++idx) {
+    double lIncrement = 0.0;
+    switch (iDistribution) {
+    case Distribution::UNIFORM:
+      lIncrement = 2.0 * iMeanIncrement * lUniform (ioGenerator);
+      break;
+    case Distribution::EXPONENTIAL:
+      lIncrement = iMeanIncrement * lExponential (ioGenerator);
+      break;
+    case Distribution::BIMODAL:
+      // 99% within a thousandth of the mean, 1% within a hundred times
+      // the mean
+      if (lUniform (ioGenerator) < 0.99) {
+        lIncrement = 1e-3 * iMeanIncrement * lUniform (ioGenerator);
+      } else {
+        lIncrement = 2e2 * iMeanIncrement * lUniform (ioGenerator);
+      }
+      break;
+    case Distribution::TIED:
+      lIncrement = K_SEVMGR_ONE_HOUR
+        * std::floor (iMeanIncrement * lExponential (ioGenerator)
+                      / K_SEVMGR_ONE_HOUR);
+      break;
+    default:
+      assert (false);
+      break;
+    }
+    ioIncrementList.push_back (static_cast<stdair::LongDuration_T> (lIncrement));
+  }
+}
+
+// //////////////////////////////////////////////////////////////////////
+/** Build a (break point) event for the given date-time stamp. */
+stdair::EventStruct buildEvent (const stdair::LongDuration_T& iTimeStamp) {
+  const stdair::DateTime_T lDateTime = stdair::DEFAULT_EVENT_OLDEST_DATETIME
+    + boost::posix_time::milliseconds (iTimeStamp);
+  const stdair::BreakPointPtr_T lBreakPoint_ptr =
+    boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+  return stdair::EventStruct (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+}
+
+/**
+ * Timings (in nanoseconds per operation) of a run.
+ */
+struct Timings {
+  double _fill;
+  double _hold;
+  double _drain;
+  double _refill;
+};
+
+// //////////////////////////////////////////////////////////////////////
+/**
+ * Run the hold model on the given event queue:
+ * <ul>
+ *   <li>fill the queue with the given number of events;</li>
+ *   <li>pop the next event and insert a new one, later by the next
+ *       increment, as many times as there are increments;</li>
+ *   <li>drain the queue;</li>
+ *   <li>reset the queue, and fill it again with the same events, as
+ *       for another replication of the same simulation.</li>
+ * </ul>
+ */
+Timings runHoldModel (SEVMGR::EventQueue& ioEventQueue,
+                      const unsigned int iQueueSize,
+                      const IncrementList_T& iFillIncrementList,
+                      const IncrementList_T& iHoldIncrementList) {
+  Timings oTimings;
+  stdair::BasChronometer lChronometer;
+
+  ioEventQueue.reset();
+  ioEventQueue.addStatus (stdair::EventType::BRK_PT,
+                          iQueueSize + iHoldIncrementList.size());
+
+  // Fill
+  lChronometer.start();
+  for (unsigned int idx = 0; idx != iQueueSize; ++idx) {
+    stdair::EventStruct lEventStruct = buildEvent (iFillIncrementList[idx]);
+    ioEventQueue.addEvent (lEventStruct);
+  }
+  oTimings._fill = 1e9 * lChronometer.elapsed() / iQueueSize;
+
+  // Hold
+  lChronometer.start();
+  stdair::EventStruct lPoppedEventStruct;
+  for (IncrementList_T::const_iterator itIncrement = iHoldIncrementList.begin();
+       itIncrement != iHoldIncrementList.end(); ++itIncrement) {
+    ioEventQueue.popEvent (lPoppedEventStruct);
+    stdair::EventStruct lEventStruct =
+      buildEvent (lPoppedEventStruct.getEventTimeStamp() + *itIncrement);
+    ioEventQueue.addEvent (lEventStruct);
+  }
+  oTimings._hold = 1e9 * lChronometer.elapsed() / iHoldIncrementList.size();
+
+  // Drain
+  lChronometer.start();
+  while (ioEventQueue.isQueueDone() == false) {
+    ioEventQueue.popEvent (lPoppedEventStruct);
+  }
+  oTimings._drain = 1e9 * lChronometer.elapsed() / iQueueSize;
+
+  // Refill, leaving the queue full, so that the timing includes the reset
+  lChronometer.start();
+  ioEventQueue.reset();
+  for (unsigned int idx = 0; idx != iQueueSize; ++idx) {
+    stdair::EventStruct lEventStruct = buildEvent (iFillIncrementList[idx]);
+    ioEventQueue.addEvent (lEventStruct);
+  }
+  oTimings._refill = 1e9 * lChronometer.elapsed() / iQueueSize;
+
+  return oTimings;
+}
+
+// //////////////////////////////////////////////////////////////////////
+/**
+ * Measure the cost of building the events alone, so that it can be
+ * deduced from the timings of the queues.
+ */
+double measureEventBuilding (const IncrementList_T& iIncrementList) {
+  stdair::BasChronometer lChronometer;
+  lChronometer.start();
+  stdair::LongDuration_T lTimeStamp = 0;
+  for (IncrementList_T::const_iterator itIncrement = iIncrementList.begin();
+       itIncrement != iIncrementList.end(); ++itIncrement) {
+    const stdair::EventStruct lEventStruct =
+      buildEvent (lTimeStamp + *itIncrement);
+    lTimeStamp = lEventStruct.getEventTimeStamp();
+  }
+  return 1e9 * lChronometer.elapsed() / iIncrementList.size();
+}
+
+
+// /////////////// M A I N /////////////////
+int main (int argc, char* argv[]) {
+
+  // Queue sizes, number of hold operations and random seed
+  QueueSizeList_T lQueueSizeList;
+  unsigned int lNbOfHolds = K_SEVMGR_DEFAULT_NB_OF_HOLDS;
+  unsigned long lRandomSeed = K_SEVMGR_DEFAULT_RANDOM_SEED;
+
+  // Output log File
+  stdair::Filename_T lLogFilename;
+
+  // Call the command-line option parser
+  const int lOptionParserStatus =
+    readConfiguration (argc, argv, lQueueSizeList, lNbOfHolds, lRandomSeed,
+                       lLogFilename);
+
+  if (lOptionParserStatus == K_SEVMGR_EARLY_RETURN_STATUS) {
+    return 0;
+  }
+  if (lNbOfHolds == 0) {
+    std::cerr << "The number of hold operations must be positive" << std::endl;
+    return -1;
+  }
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // Open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Set up the log parameters. The queue operations are not logged.
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+
+  std::cout << "Event queue benchmark (hold model, " << lNbOfHolds
+            << " holds per run; timings in nanoseconds per operation, "
+            << "including the building of the event structures)"
+            << std::endl;
+  std::cout << std::setw (12) << "increments" << std::setw (10) << "size"
+            << std::setw (13) << "backend" << std::setw (10) << "fill"
+            << std::setw (10) << "hold" << std::setw (10) << "drain"
+            << std::setw (10) << "refill" << std::endl;
+
+  for (unsigned short lDistIdx = 0; lDistIdx != Distribution::LAST_VALUE;
+       ++lDistIdx) {
+    const Distribution::EN_Distribution lDistribution =
+      static_cast<Distribution::EN_Distribution> (lDistIdx);
+
+    for (QueueSizeList_T::const_iterator itSize = lQueueSizeList.begin();
+         itSize != lQueueSizeList.end(); ++itSize) {
+      const unsigned int lQueueSize = *itSize;
+      if (lQueueSize == 0) {
+        continue;
+      }
+
+      // All the backends are given the same events. The initial events
+      // are spread as if they had been inserted at the origin of time.
+      const double lMeanIncrement = lQueueSize * K_SEVMGR_MEAN_SPACING;
+      std::mt19937 lGenerator (lRandomSeed);
+      IncrementList_T lFillIncrementList;
+      drawIncrements (lDistribution, lMeanIncrement, lQueueSize, lGenerator,
+                      lFillIncrementList);
+      IncrementList_T lHoldIncrementList;
+      drawIncrements (lDistribution, lMeanIncrement, lNbOfHolds, lGenerator,
+                      lHoldIncrementList);
+
+      for (unsigned short lBackendIdx = 0;
+           lBackendIdx != SEVMGR::EventQueueBackendType::LAST_VALUE;
+           ++lBackendIdx) {
+        const SEVMGR::EventQueueBackendType::EN_EventQueueBackendType lBackend =
+          static_cast<SEVMGR::EventQueueBackendType::EN_EventQueueBackendType> (lBackendIdx);
+
+        // Initialise the Sevmgr service object, on top of the backend
+        // to be measured
+        SEVMGR::SEVMGR_Service sevmgrService (lLogParams, lBackend);
+        SEVMGR::EventQueue& lEventQueue = sevmgrService.getEventQueue();
+
+        const Timings lTimings = runHoldModel (lEventQueue, lQueueSize,
+                                               lFillIncrementList,
+                                               lHoldIncrementList);
+
+        std::cout << std::setw (12) << Distribution::getLabel (lDistribution)
+                  << std::setw (10) << lQueueSize
+                  << std::setw (13)
+                  << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                  << std::fixed << std::setprecision (0)
+                  << std::setw (10) << lTimings._fill
+                  << std::setw (10) << lTimings._hold
+                  << std::setw (10) << lTimings._drain
+                  << std::setw (10) << lTimings._refill << std::endl;
+      }
+    }
+  }
+
+  std::mt19937 lGenerator (lRandomSeed);
+  IncrementList_T lIncrementList;
+  drawIncrements (Distribution::EXPONENTIAL, K_SEVMGR_MEAN_SPACING,
+                  lNbOfHolds, lGenerator, lIncrementList);
+  std::cout << "Building of an event structure alone: " << std::fixed
+            << std::setprecision (0) << measureEventBuilding (lIncrementList)
+            << " ns" << std::endl;
+
+  // Close the Log outputFile
+  logOutputFile.close();
+
+  return 0;
+}
@@ -34,8 +34,16 @@ namespace SEVMGR {
 			const EventQueue& iEventQueue,
 			const stdair::EventType::EN_EventType& iEventType) { 
 
-    // Retrieve the event list
-    const stdair::EventList_T& lEventList = iEventQueue.getEventList();
+    // Retrieve the event list (of the given type, if any), sorted by
+    // date-time stamps
+    const bool isEventTypeLastValue = 
+      (iEventType == stdair::EventType::LAST_VALUE);
+    EventStructPtrList_T lEventList;
+    if (isEventTypeLastValue == true) {
+      iEventQueue.getSortedEventList (lEventList);
+    } else {
+      iEventQueue.getSortedEventList (lEventList, iEventType);
+    }
  
 #if BOOST_VERSION_MACRO >= 104100  
     // Create empty property tree objects
@@ -43,31 +51,24 @@ namespace SEVMGR {
     bpt::ptree pt;  
 
     // Browse the events
-    for (stdair::EventList_T::const_iterator itEvent = lEventList.begin();
+    for (EventStructPtrList_T::const_iterator itEvent = lEventList.begin();
 	 itEvent != lEventList.end(); ++itEvent) {
-      const stdair::EventStruct& lEvent = itEvent->second;   
-      const stdair::EventType::EN_EventType& lEventType = 
-	lEvent.getEventType();
-
-      const bool isEventTypeLastValue = 
-	(iEventType == stdair::EventType::LAST_VALUE);
-      if (lEventType == iEventType || isEventTypeLastValue == true) {
+      const stdair::EventStruct& lEvent = **itEvent;   
  
-	// Delegate the JSON export to the dedicated service
-	const std::string lCurrentEvent = 
-	  ioSTDAIR_ServicePtr->jsonExportEventObject (lEvent);  
+      // Delegate the JSON export to the dedicated service
+      const std::string lCurrentEvent = 
+	ioSTDAIR_ServicePtr->jsonExportEventObject (lEvent);  
 	
-	// Load the JSON formatted string into the property tree.
-	// If reading fails (cannot open stream, parse error), an
-	// exception is thrown. 
-	if (lCurrentEvent.empty () == false) {
-	  bpt::ptree ptCurrentEvent;  
-	  std::istringstream lStrCurrentEvent(lCurrentEvent);
-	  read_json (lStrCurrentEvent, ptCurrentEvent);	
+      // Load the JSON formatted string into the property tree.
+      // If reading fails (cannot open stream, parse error), an
+      // exception is thrown. 
+      if (lCurrentEvent.empty () == false) {
+	bpt::ptree ptCurrentEvent;  
+	std::istringstream lStrCurrentEvent(lCurrentEvent);
+	read_json (lStrCurrentEvent, ptCurrentEvent);	
 	
-	  // Put the current inventory tree in the events array
-	  ptEvents.push_back(std::make_pair("", ptCurrentEvent));
-	}
+	// Put the current inventory tree in the events array
+	ptEvents.push_back(std::make_pair("", ptCurrentEvent));
       }
     }
 
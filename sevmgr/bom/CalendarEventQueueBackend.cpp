@@ -0,0 +1,610 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <algorithm>
+#include <map>
+#include <utility>
+// SEvMgr
+#include <sevmgr/bom/CalendarEventQueueBackend.hpp>
+#include <sevmgr/bom/EventQueueCursor.hpp>
+
+namespace SEVMGR {
+
+  namespace {
+    /** Initial width (in milliseconds) of the buckets: one hour. */
+    const stdair::LongDuration_T DEFAULT_BUCKET_WIDTH = 3600000;
+
+    /**
+     * Number of removed entries at the head of a bucket, beyond which
+     * those latter are erased (provided that they are the majority).
+     */
+    const CalendarEventQueueBackend::CalendarEntryList_T::size_type
+    MIN_NB_OF_ERASED_ENTRIES = 16;
+
+    /** Compare two calendar entries, given by pointer. */
+    struct CalendarEntryPtrLess {
+      bool operator() (const CalendarEventQueueBackend::CalendarEntry* iLHS,
+                       const CalendarEventQueueBackend::CalendarEntry* iRHS) const {
+        return (*iLHS < *iRHS);
+      }
+    };
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const unsigned int CalendarEventQueueBackend::MIN_NB_OF_BUCKETS;
+  const unsigned int CalendarEventQueueBackend::NB_OF_SAMPLED_EVENTS;
+  const unsigned int CalendarEventQueueBackend::MAX_AVG_NB_OF_WALKED_BUCKETS;
+  const unsigned int CalendarEventQueueBackend::MAX_AVG_NB_OF_MET_EVENTS;
+
+  // //////////////////////////////////////////////////////////////////////
+  CalendarEventQueueBackend::CalendarEventQueueBackend()
+    : _bucketList (MIN_NB_OF_BUCKETS), _bucketWidth (DEFAULT_BUCKET_WIDTH),
+      _size (0), _currentDay (0), _extractedSlot (0),
+      _hasExtractedSlot (false), _nbOfPops (0), _nbOfWalkedBuckets (0),
+      _nbOfInserts (0), _nbOfMetEvents (0) {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  CalendarEventQueueBackend::
+  CalendarEventQueueBackend (const CalendarEventQueueBackend& iBackend)
+    : _bucketWidth (DEFAULT_BUCKET_WIDTH), _size (0), _currentDay (0),
+      _extractedSlot (0), _hasExtractedSlot (false),
+      _nbOfPops (0), _nbOfWalkedBuckets (0),
+      _nbOfInserts (0), _nbOfMetEvents (0) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  CalendarEventQueueBackend::~CalendarEventQueueBackend() {
+    _bucketList.clear();
+    _eventList.clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  long long CalendarEventQueueBackend::
+  getDay (const stdair::LongDuration_T& iTimeStamp) const {
+    assert (_bucketWidth > 0);
+
+    // Round towards minus infinity, as the date-time stamps may be
+    // negative (i.e., before the reference date-time)
+    long long oDay = iTimeStamp / _bucketWidth;
+    if (iTimeStamp % _bucketWidth != 0 && iTimeStamp < 0) {
+      --oDay;
+    }
+    return oDay;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  CalendarEventQueueBackend::BucketList_T::size_type
+  CalendarEventQueueBackend::getBucketIndex (const long long& iDay) const {
+    // The number of buckets is a power of two
+    const unsigned long long lMask = _bucketList.size() - 1;
+    return static_cast<BucketList_T::size_type> (iDay & lMask);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  CalendarEventQueueBackend::BucketList_T::size_type
+  CalendarEventQueueBackend::locateNext() const {
+    assert (_size > 0);
+
+    // Walk the buckets, one day at a time, for (at most) one "year"
+    const BucketList_T::size_type lNbOfBuckets = _bucketList.size();
+    for (BucketList_T::size_type idx = 0; idx != lNbOfBuckets; ++idx) {
+      const long long lDay = _currentDay + idx;
+      const BucketList_T::size_type lBucketIdx = getBucketIndex (lDay);
+      const Bucket& lBucket = _bucketList[lBucketIdx];
+      if (lBucket.empty() == false
+          && getDay (lBucket.front()._timeStamp) <= lDay) {
+        _currentDay = lDay;
+        _nbOfWalkedBuckets += idx + 1;
+        return lBucketIdx;
+      }
+    }
+
+    // No event within one year from the current day: search directly
+    // for the earliest event among the buckets
+    BucketList_T::size_type oBucketIdx = lNbOfBuckets;
+    for (BucketList_T::size_type idx = 0; idx != lNbOfBuckets; ++idx) {
+      const Bucket& lBucket = _bucketList[idx];
+      if (lBucket.empty() == false
+          && (oBucketIdx == lNbOfBuckets
+              || lBucket.front() < _bucketList[oBucketIdx].front())) {
+        oBucketIdx = idx;
+      }
+    }
+    assert (oBucketIdx != lNbOfBuckets);
+
+    _currentDay = getDay (_bucketList[oBucketIdx].front()._timeStamp);
+    _nbOfWalkedBuckets += 2 * lNbOfBuckets;
+    return oBucketIdx;
+  }
+
+  /**
+   * Cursor walking the days from the current one (or from the one of
+   * the given date-time stamp, if later), exactly as the removals do.
+   * Rather than moving the heads of the buckets, the cursor keeps its
+   * own read positions, for the buckets it has met: the read position
+   * within a bucket starts at the first entry not earlier than the
+   * given date-time stamp.
+   */
+  class CalendarEventQueueBackend::CalendarCursor : public EventQueueCursor {
+  public:
+    CalendarCursor (const CalendarEventQueueBackend& iCalendar,
+                    const stdair::LongDuration_T& iFromTimeStamp)
+      : _calendar (iCalendar), _fromTimeStamp (iFromTimeStamp),
+        _day (iCalendar._currentDay), _isExhausted (iCalendar._size == 0) {
+      if (_isExhausted == false) {
+        _day = std::max (_day, _calendar.getDay (_fromTimeStamp));
+      }
+    }
+
+    const stdair::EventStruct* next (EventSequence_T& oSequence) {
+      if (_isExhausted == true) {
+        return NULL;
+      }
+
+      // Walk the buckets, one day at a time, for (at most) one "year"
+      const BucketList_T& lBucketList = _calendar._bucketList;
+      const BucketList_T::size_type lNbOfBuckets = lBucketList.size();
+      BucketList_T::size_type lBucketIdx = lNbOfBuckets;
+      for (BucketList_T::size_type idx = 0; idx != lNbOfBuckets; ++idx) {
+        const long long lDay = _day + idx;
+        const BucketList_T::size_type lDayBucketIdx =
+          _calendar.getBucketIndex (lDay);
+        const CalendarEntry* lEntry_ptr = getFront (lDayBucketIdx);
+        if (lEntry_ptr != NULL
+            && _calendar.getDay (lEntry_ptr->_timeStamp) <= lDay) {
+          _day = lDay;
+          lBucketIdx = lDayBucketIdx;
+          break;
+        }
+      }
+
+      // No event within one year: search directly for the earliest one
+      if (lBucketIdx == lNbOfBuckets) {
+        for (BucketList_T::size_type idx = 0; idx != lNbOfBuckets; ++idx) {
+          const CalendarEntry* lEntry_ptr = getFront (idx);
+          if (lEntry_ptr != NULL
+              && (lBucketIdx == lNbOfBuckets
+                  || *lEntry_ptr < *getFront (lBucketIdx))) {
+            lBucketIdx = idx;
+          }
+        }
+
+        // All the events have been browsed
+        if (lBucketIdx == lNbOfBuckets) {
+          _isExhausted = true;
+          return NULL;
+        }
+        _day = _calendar.getDay (getFront (lBucketIdx)->_timeStamp);
+      }
+
+      const CalendarEntry* lEntry_ptr = getFront (lBucketIdx);
+      assert (lEntry_ptr != NULL);
+      ++_positionList[lBucketIdx];
+      oSequence = lEntry_ptr->_sequence;
+      return &_calendar._eventList[lEntry_ptr->_slot];
+    }
+
+  private:
+    /**
+     * Get the first entry of the given bucket not browsed yet, if any.
+     */
+    const CalendarEntry* getFront (const BucketList_T::size_type& iBucketIdx) {
+      const Bucket& lBucket = _calendar._bucketList[iBucketIdx];
+      std::map<BucketList_T::size_type,
+               CalendarEntryList_T::size_type>::iterator itPosition =
+        _positionList.find (iBucketIdx);
+      if (itPosition == _positionList.end()) {
+        // The first entry with that date-time stamp would have the
+        // lowest possible sequence number
+        const CalendarEntry lFromEntry = { _fromTimeStamp, 0, 0 };
+        const CalendarEntryList_T::const_iterator itFirstEntry =
+          std::lower_bound (lBucket._entryList.begin() + lBucket._head,
+                            lBucket._entryList.end(), lFromEntry);
+        itPosition = _positionList.
+          insert (std::make_pair (iBucketIdx,
+                                  itFirstEntry - lBucket._entryList.begin())).first;
+      }
+      if (itPosition->second == lBucket._entryList.size()) {
+        return NULL;
+      }
+      return &lBucket._entryList[itPosition->second];
+    }
+
+    /** Browsed calendar. */
+    const CalendarEventQueueBackend& _calendar;
+
+    /** Date-time stamp, before which the events are skipped. */
+    const stdair::LongDuration_T _fromTimeStamp;
+
+    /** Day of the last browsed event. */
+    long long _day;
+
+    /** Read positions within the buckets met so far. */
+    std::map<BucketList_T::size_type,
+             CalendarEntryList_T::size_type> _positionList;
+
+    /** Whether all the events have been browsed. */
+    bool _isExhausted;
+  };
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueCursor* CalendarEventQueueBackend::
+  createCursor (const stdair::LongDuration_T& iFromTimeStamp) const {
+    return new CalendarCursor (*this, iFromTimeStamp);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct& CalendarEventQueueBackend::top() const {
+    const BucketList_T::size_type lBucketIdx = locateNext();
+    return _eventList[_bucketList[lBucketIdx].front()._slot];
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventSequence_T CalendarEventQueueBackend::getTopSequence() const {
+    const BucketList_T::size_type lBucketIdx = locateNext();
+    return _bucketList[lBucketIdx].front()._sequence;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool CalendarEventQueueBackend::
+  hasTimeStamp (const stdair::LongDuration_T& iDateTimeStamp) const {
+    const Bucket& lBucket =
+      _bucketList[getBucketIndex (getDay (iDateTimeStamp))];
+
+    // The first entry with that date-time stamp would have the lowest
+    // possible sequence number
+    const CalendarEntry lEntry = { iDateTimeStamp, 0, 0 };
+    CalendarEntryList_T::const_iterator itEntry =
+      std::lower_bound (lBucket._entryList.begin() + lBucket._head,
+                        lBucket._entryList.end(), lEntry);
+    return (itEntry != lBucket._entryList.end()
+            && itEntry->_timeStamp == iDateTimeStamp);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CalendarEventQueueBackend::
+  getSortedEventList (EventStructPtrList_T& ioEventList,
+                      EventSequenceList_T* ioSequenceList_ptr) const {
+    std::vector<const CalendarEntry*> lEntryList;
+    lEntryList.reserve (_size);
+    for (BucketList_T::const_iterator itBucket = _bucketList.begin();
+         itBucket != _bucketList.end(); ++itBucket) {
+      for (CalendarEntryList_T::const_iterator itEntry =
+             itBucket->_entryList.begin() + itBucket->_head;
+           itEntry != itBucket->_entryList.end(); ++itEntry) {
+        lEntryList.push_back (&(*itEntry));
+      }
+    }
+    std::sort (lEntryList.begin(), lEntryList.end(), CalendarEntryPtrLess());
+
+    ioEventList.reserve (ioEventList.size() + lEntryList.size());
+    for (std::vector<const CalendarEntry*>::const_iterator itEntry =
+           lEntryList.begin(); itEntry != lEntryList.end(); ++itEntry) {
+      ioEventList.push_back (&_eventList[(*itEntry)->_slot]);
+      if (ioSequenceList_ptr != NULL) {
+        ioSequenceList_ptr->push_back ((*itEntry)->_sequence);
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CalendarEventQueueBackend::insertEntry (const CalendarEntry& iEntry) {
+    Bucket& lBucket = _bucketList[getBucketIndex (getDay (iEntry._timeStamp))];
+    CalendarEntryList_T& lEntryList = lBucket._entryList;
+
+    const CalendarEntryList_T::iterator itFirst =
+      lEntryList.begin() + lBucket._head;
+    const CalendarEntryList_T::iterator itPosition =
+      std::upper_bound (itFirst, lEntryList.end(), iEntry);
+
+    if (itPosition == itFirst && lBucket._head != 0) {
+      // Re-use the room left by the last removed entry
+      --lBucket._head;
+      lEntryList[lBucket._head] = iEntry;
+
+    } else {
+      _nbOfMetEvents += lEntryList.end() - itPosition;
+      lEntryList.insert (itPosition, iEntry);
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  unsigned int CalendarEventQueueBackend::
+  storeEvent (const stdair::EventStruct& iEventStruct) {
+    releaseExtractedSlot();
+
+    // Store the event structure into a (possibly recycled) slot
+    unsigned int oSlot = 0;
+    if (_freeSlotList.empty() == false) {
+      oSlot = _freeSlotList.back();
+      _freeSlotList.pop_back();
+      _eventList[oSlot] = iEventStruct;
+
+    } else {
+      oSlot = _eventList.size();
+      _eventList.push_back (iEventStruct);
+    }
+    return oSlot;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool CalendarEventQueueBackend::
+  insert (const stdair::EventStruct& iEventStruct,
+          const EventSequence_T& iSequence) {
+    const CalendarEntry lEntry = { iEventStruct.getEventTimeStamp(),
+                                   iSequence, storeEvent (iEventStruct) };
+
+    // No event may belong to a day before the current one
+    const long long lDay = getDay (lEntry._timeStamp);
+    if (_size == 0 || lDay < _currentDay) {
+      _currentDay = lDay;
+    }
+
+    insertEntry (lEntry);
+    ++_size;
+    ++_nbOfInserts;
+
+    tune();
+
+    return true;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CalendarEventQueueBackend::
+  bulkInsert (const EventStructList_T& iEventStructList,
+              const EventSequence_T& iFirstSequence) {
+    EventSequence_T lSequence = iFirstSequence;
+    if (iEventStructList.size() < static_cast<EventStructList_T::size_type> (_size)) {
+      for (EventStructList_T::const_iterator itEvent =
+             iEventStructList.begin(); itEvent != iEventStructList.end();
+           ++itEvent) {
+        insert (*itEvent, lSequence);
+        ++lSequence;
+      }
+      return;
+    }
+
+    // Drop the entries into their buckets, without sorting them: the
+    // calendar is re-built (and its buckets sorted) afterwards
+    _eventList.reserve (_eventList.size() + iEventStructList.size());
+    for (EventStructList_T::const_iterator itEvent = iEventStructList.begin();
+         itEvent != iEventStructList.end(); ++itEvent) {
+      const CalendarEntry lEntry = { itEvent->getEventTimeStamp(),
+                                     lSequence, storeEvent (*itEvent) };
+      ++lSequence;
+      Bucket& lBucket =
+        _bucketList[getBucketIndex (getDay (lEntry._timeStamp))];
+      lBucket._entryList.push_back (lEntry);
+      ++_size;
+    }
+
+    // Keep between one half and two events per bucket, on average
+    BucketList_T::size_type lNbOfBuckets = _bucketList.size();
+    while (static_cast<BucketList_T::size_type> (_size) > 2 * lNbOfBuckets) {
+      lNbOfBuckets *= 2;
+    }
+    resize (lNbOfBuckets);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CalendarEventQueueBackend::releaseExtractedSlot() {
+    if (_hasExtractedSlot == true) {
+      _eventList[_extractedSlot] = stdair::EventStruct();
+      _freeSlotList.push_back (_extractedSlot);
+      _hasExtractedSlot = false;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CalendarEventQueueBackend::pop (stdair::EventStruct& ioEventStruct) {
+    releaseExtractedSlot();
+    const unsigned int lSlot = removeNext();
+
+    // Extract (a copy of) the event structure, and recycle its slot
+    ioEventStruct = _eventList[lSlot];
+    _eventList[lSlot] = stdair::EventStruct();
+    _freeSlotList.push_back (lSlot);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct& CalendarEventQueueBackend::extract() {
+    releaseExtractedSlot();
+
+    // The event structure stays in its slot, until the next call
+    // altering the calendar
+    _extractedSlot = removeNext();
+    _hasExtractedSlot = true;
+    return _eventList[_extractedSlot];
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  unsigned int CalendarEventQueueBackend::removeNext() {
+    assert (_size > 0);
+
+    Bucket& lBucket = _bucketList[locateNext()];
+    const unsigned int oSlot = lBucket.front()._slot;
+
+    // Remove the entry from the bucket
+    CalendarEntryList_T& lEntryList = lBucket._entryList;
+    ++lBucket._head;
+    if (lBucket._head == lEntryList.size()) {
+      lEntryList.clear();
+      lBucket._head = 0;
+
+    } else if (lBucket._head >= MIN_NB_OF_ERASED_ENTRIES
+               && 2 * lBucket._head >= lEntryList.size()) {
+      lEntryList.erase (lEntryList.begin(),
+                        lEntryList.begin() + lBucket._head);
+      lBucket._head = 0;
+    }
+
+    --_size;
+    ++_nbOfPops;
+
+    tune();
+
+    return oSlot;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CalendarEventQueueBackend::clear() {
+    for (BucketList_T::iterator itBucket = _bucketList.begin();
+         itBucket != _bucketList.end(); ++itBucket) {
+      itBucket->_entryList.clear();
+      itBucket->_head = 0;
+    }
+    _eventList.clear();
+    _freeSlotList.clear();
+    _hasExtractedSlot = false;
+    _size = 0;
+    _currentDay = 0;
+    _nbOfPops = 0;
+    _nbOfWalkedBuckets = 0;
+    _nbOfInserts = 0;
+    _nbOfMetEvents = 0;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CalendarEventQueueBackend::tune() {
+    const BucketList_T::size_type lNbOfBuckets = _bucketList.size();
+
+    // Keep between one half and two events per bucket, on average
+    if (static_cast<BucketList_T::size_type> (_size) > 2 * lNbOfBuckets) {
+      resize (2 * lNbOfBuckets);
+      return;
+    }
+    if (lNbOfBuckets > MIN_NB_OF_BUCKETS
+        && static_cast<BucketList_T::size_type> (2 * _size) < lNbOfBuckets) {
+      resize (lNbOfBuckets / 2);
+      return;
+    }
+
+    // Check the costs of the operations, once every "year" of operations
+    if (_nbOfPops + _nbOfInserts < lNbOfBuckets) {
+      return;
+    }
+    const bool areBucketsTooNarrow =
+      (_nbOfWalkedBuckets > MAX_AVG_NB_OF_WALKED_BUCKETS * _nbOfPops);
+    const bool areBucketsTooWide =
+      (_nbOfMetEvents > MAX_AVG_NB_OF_MET_EVENTS * _nbOfInserts);
+    if (areBucketsTooNarrow == true || areBucketsTooWide == true) {
+      resize (lNbOfBuckets);
+      return;
+    }
+    _nbOfPops = 0;
+    _nbOfWalkedBuckets = 0;
+    _nbOfInserts = 0;
+    _nbOfMetEvents = 0;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CalendarEventQueueBackend::
+  resize (const BucketList_T::size_type& iNbOfBuckets) {
+    assert (iNbOfBuckets >= MIN_NB_OF_BUCKETS);
+
+    // Gather all the entries
+    CalendarEntryList_T lEntryList;
+    lEntryList.reserve (_size);
+    for (BucketList_T::const_iterator itBucket = _bucketList.begin();
+         itBucket != _bucketList.end(); ++itBucket) {
+      lEntryList.insert (lEntryList.end(),
+                         itBucket->_entryList.begin() + itBucket->_head,
+                         itBucket->_entryList.end());
+    }
+    assert (lEntryList.size() == static_cast<CalendarEntryList_T::size_type> (_size));
+
+    /**
+     * Sort the earliest entries, which are sampled to compute the
+     * width. As the events having the same date-time stamp fall into
+     * the same bucket whatever the width, only the distinct date-time
+     * stamps matter: the sample is extended until it holds enough of
+     * them (or all the entries).
+     */
+    CalendarEntryList_T::size_type lNbOfSamples =
+      std::min (lEntryList.size(),
+                static_cast<CalendarEntryList_T::size_type> (NB_OF_SAMPLED_EVENTS));
+    std::vector<double> lSpacingList;
+    while (lNbOfSamples != 0) {
+      std::nth_element (lEntryList.begin(),
+                        lEntryList.begin() + (lNbOfSamples - 1),
+                        lEntryList.end());
+      std::sort (lEntryList.begin(), lEntryList.begin() + lNbOfSamples);
+
+      lSpacingList.clear();
+      for (CalendarEntryList_T::size_type idx = 1; idx != lNbOfSamples;
+           ++idx) {
+        const stdair::LongDuration_T lSpacing =
+          lEntryList[idx]._timeStamp - lEntryList[idx - 1]._timeStamp;
+        if (lSpacing != 0) {
+          lSpacingList.push_back (static_cast<double> (lSpacing));
+        }
+      }
+
+      if (lSpacingList.size() + 1 >= NB_OF_SAMPLED_EVENTS
+          || lNbOfSamples == lEntryList.size()) {
+        break;
+      }
+      lNbOfSamples = std::min (lEntryList.size(), 4 * lNbOfSamples);
+    }
+
+    /**
+     * Following R. Brown, the width is three times the average
+     * spacing of the sampled (distinct) date-time stamps, that average
+     * being re-computed without the spacings greater than twice the
+     * first average. When all the sampled events occur at the same
+     * time, the width is kept as is.
+     */
+    if (lSpacingList.empty() == false) {
+      double lTotalSpacing = 0.0;
+      for (std::vector<double>::const_iterator itSpacing =
+             lSpacingList.begin(); itSpacing != lSpacingList.end();
+           ++itSpacing) {
+        lTotalSpacing += *itSpacing;
+      }
+      const double lAvgSpacing = lTotalSpacing / lSpacingList.size();
+
+      double lTrimmedTotalSpacing = 0.0;
+      unsigned int lNbOfSpacings = 0;
+      for (std::vector<double>::const_iterator itSpacing =
+             lSpacingList.begin(); itSpacing != lSpacingList.end();
+           ++itSpacing) {
+        if (*itSpacing <= 2.0 * lAvgSpacing) {
+          lTrimmedTotalSpacing += *itSpacing;
+          ++lNbOfSpacings;
+        }
+      }
+      assert (lNbOfSpacings != 0);
+      const stdair::LongDuration_T lWidth = static_cast<stdair::LongDuration_T>
+        (3.0 * lTrimmedTotalSpacing / lNbOfSpacings + 0.5);
+      _bucketWidth = std::max (lWidth, static_cast<stdair::LongDuration_T> (1));
+    }
+
+    // Re-build the buckets
+    _bucketList.clear();
+    _bucketList.resize (iNbOfBuckets);
+    for (CalendarEntryList_T::const_iterator itEntry = lEntryList.begin();
+         itEntry != lEntryList.end(); ++itEntry) {
+      _bucketList[getBucketIndex (getDay (itEntry->_timeStamp))]
+        ._entryList.push_back (*itEntry);
+    }
+    for (BucketList_T::iterator itBucket = _bucketList.begin();
+         itBucket != _bucketList.end(); ++itBucket) {
+      std::sort (itBucket->_entryList.begin(), itBucket->_entryList.end());
+    }
+
+    // The earliest entry, if any, comes first in the list
+    if (lEntryList.empty() == false) {
+      _currentDay = getDay (lEntryList.front()._timeStamp);
+    }
+
+    _nbOfPops = 0;
+    _nbOfWalkedBuckets = 0;
+    _nbOfInserts = 0;
+    _nbOfMetEvents = 0;
+  }
+
+}
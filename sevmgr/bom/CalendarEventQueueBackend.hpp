@@ -0,0 +1,322 @@
+#ifndef __SEVMGR_BOM_CALENDAREVENTQUEUEBACKEND_HPP
+#define __SEVMGR_BOM_CALENDAREVENTQUEUEBACKEND_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <vector>
+// StdAir
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/bom/EventQueueBackend.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Event queue backend relying on a calendar queue (R. Brown,
+   * 1988), with self-tuning bucket widths.
+   *
+   * The time line is cut into "days" of a given width, and the day of
+   * an event is hashed into one of the "buckets" (the number of buckets
+   * being a power of two). Each bucket keeps its events sorted. Popping
+   * an event amounts to walking the buckets from the current day on,
+   * until a bucket is found whose first event belongs to the day being
+   * walked. When the bucket width fits the spacing of the events, both
+   * insertion and removal are O(1) on average.
+   *
+   * The calendar tunes itself:
+   * <ul>
+   *   <li>the number of buckets is doubled (resp. halved) when the
+   *       number of events goes beyond twice (resp. below half) the
+   *       number of buckets;</li>
+   *   <li>at each resize, the bucket width is re-computed from the
+   *       average spacing of the earliest events;</li>
+   *   <li>when the average number of buckets walked by a removal, or
+   *       the average number of events met by an insertion, drifts
+   *       beyond a threshold, the calendar is re-built with a new
+   *       bucket width (the number of buckets being kept).</li>
+   * </ul>
+   *
+   * The calendar does not fit well the event sets having a highly
+   * skewed spacing (e.g., a dense cluster of events along with a few
+   * events far away in the future): a single bucket width cannot fit
+   * both, and the queue degrades towards a linear list.
+   *
+   * The buckets only hold small (date-time stamp, sequence, slot)
+   * entries; the event structures themselves are stored in a slot
+   * array, the slots of the removed events being recycled.
+   *
+   * Events having the same date-time stamp are ordered by insertion
+   * sequence, so that they are popped in the order they were added.
+   * Their date-time stamp is never altered.
+   */
+  class CalendarEventQueueBackend : public EventQueueBackend {
+  public:
+    // ////////// Type definitions ////////////
+    /** Minimal (and initial) number of buckets. */
+    static const unsigned int MIN_NB_OF_BUCKETS = 16;
+
+    /** Number of the earliest events sampled to compute the bucket width. */
+    static const unsigned int NB_OF_SAMPLED_EVENTS = 25;
+
+    /**
+     * Average number of buckets walked per removal beyond which the
+     * bucket width is re-computed (buckets too narrow).
+     */
+    static const unsigned int MAX_AVG_NB_OF_WALKED_BUCKETS = 4;
+
+    /**
+     * Average number of events met per insertion beyond which the
+     * bucket width is re-computed (buckets too wide).
+     */
+    static const unsigned int MAX_AVG_NB_OF_MET_EVENTS = 8;
+
+    /**
+     * Entry of a bucket: the ordering key, i.e., (date-time stamp,
+     * insertion sequence), along with the slot of the event structure.
+     */
+    struct CalendarEntry {
+      stdair::LongDuration_T _timeStamp;
+      EventSequence_T _sequence;
+      unsigned int _slot;
+
+      /** Strict ordering on (date-time stamp, insertion sequence). */
+      bool operator< (const CalendarEntry& iEntry) const {
+        return (_timeStamp < iEntry._timeStamp
+                || (_timeStamp == iEntry._timeStamp
+                    && _sequence < iEntry._sequence));
+      }
+    };
+
+    /** List of entries. */
+    typedef std::vector<CalendarEntry> CalendarEntryList_T;
+
+    /**
+     * Bucket of the calendar. The entries are sorted; the ones before
+     * the head have already been removed.
+     */
+    struct Bucket {
+      CalendarEntryList_T _entryList;
+      CalendarEntryList_T::size_type _head;
+
+      Bucket() : _head (0) {}
+
+      /** State whether the bucket holds no (remaining) entry. */
+      bool empty() const {
+        return (_head == _entryList.size());
+      }
+
+      /** Get the number of (remaining) entries. */
+      CalendarEntryList_T::size_type size() const {
+        return (_entryList.size() - _head);
+      }
+
+      /** Get the first (remaining) entry. */
+      const CalendarEntry& front() const {
+        return _entryList[_head];
+      }
+    };
+
+    /** List of buckets. */
+    typedef std::vector<Bucket> BucketList_T;
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    CalendarEventQueueBackend();
+    /** Destructor. */
+    ~CalendarEventQueueBackend();
+
+  private:
+    /** Copy constructor (not to be used). */
+    CalendarEventQueueBackend (const CalendarEventQueueBackend&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the type of the backend. */
+    EventQueueBackendType::EN_EventQueueBackendType getType() const {
+      return EventQueueBackendType::CALENDAR;
+    }
+
+    /** Get the number of events. */
+    stdair::Count_T size() const {
+      return _size;
+    }
+
+    /** State whether there is no event. */
+    bool empty() const {
+      return (_size == 0);
+    }
+
+    /** Get the next coming (in time) event. */
+    const stdair::EventStruct& top() const;
+
+    /** Get the insertion sequence number of the next coming event. */
+    EventSequence_T getTopSequence() const;
+
+    /** State whether there is an event with the given date-time stamp. */
+    bool hasTimeStamp (const stdair::LongDuration_T&) const;
+
+    /**
+     * Fill the given list with all the events, sorted by date-time.
+     *
+     * \note The buckets are not sorted with respect to each other: the
+     *       list is sorted on the fly.
+     */
+    void getSortedEventList (EventStructPtrList_T&,
+                             EventSequenceList_T*) const;
+
+    /**
+     * Create a cursor walking the days from the current one, as the
+     * removals do, without altering the buckets. Within each bucket,
+     * the events earlier than the given date-time stamp are skipped by
+     * a logarithmic search.
+     */
+    EventQueueCursor* createCursor (const stdair::LongDuration_T&) const;
+
+    /** Get the number of buckets. */
+    BucketList_T::size_type getNbOfBuckets() const {
+      return _bucketList.size();
+    }
+
+    /** Get the width (in milliseconds) of the buckets. */
+    const stdair::LongDuration_T& getBucketWidth() const {
+      return _bucketWidth;
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /** Insert the given event. */
+    bool insert (const stdair::EventStruct&, const EventSequence_T&);
+
+    /**
+     * Insert all the events of the given list. When the list is at
+     * least as long as the calendar, the entries are dropped into their
+     * buckets and the calendar is re-built once (re-computing the
+     * bucket width); otherwise, they are inserted one by one.
+     */
+    void bulkInsert (const EventStructList_T&, const EventSequence_T&);
+
+    /** Extract the next coming (in time) event. */
+    void pop (stdair::EventStruct&);
+
+    /**
+     * Extract the next coming (in time) event, without copying it: its
+     * event structure stays in its slot until the next call altering
+     * the calendar.
+     */
+    const stdair::EventStruct& extract();
+
+    /**
+     * Remove all the events. The number of buckets and their width
+     * are kept.
+     */
+    void clear();
+
+  private:
+    /** Cursor walking the calendar (it accesses the calendar helpers). */
+    class CalendarCursor;
+
+    // ////////// Calendar helpers /////////
+    /** Get the day (i.e., the virtual bucket) of the given time stamp. */
+    long long getDay (const stdair::LongDuration_T&) const;
+
+    /** Get the bucket, in which the events of the given day are stored. */
+    BucketList_T::size_type getBucketIndex (const long long&) const;
+
+    /**
+     * Find the bucket holding the next coming (in time) event. The
+     * current day is moved forward accordingly.
+     *
+     * \note The calendar must not be empty.
+     */
+    BucketList_T::size_type locateNext() const;
+
+    /** Store the given event structure, and return its slot. */
+    unsigned int storeEvent (const stdair::EventStruct&);
+
+    /**
+     * Remove the entry of the next coming (in time) event from its
+     * bucket, and return the slot of its event structure (which is
+     * left to the caller).
+     */
+    unsigned int removeNext();
+
+    /** Recycle the slot of the last extracted event, if any. */
+    void releaseExtractedSlot();
+
+    /** Insert the given entry into its bucket, keeping that latter sorted. */
+    void insertEntry (const CalendarEntry&);
+
+    /**
+     * Re-build the calendar with the given number of buckets. The
+     * bucket width is re-computed from the spacing of the earliest
+     * events.
+     */
+    void resize (const BucketList_T::size_type&);
+
+    /**
+     * Check the size and the costs of the recent operations, and
+     * re-build the calendar if needed.
+     */
+    void tune();
+
+  private:
+    // ////////// Attributes /////////
+    /**
+     * Buckets of the calendar (their number is a power of two).
+     */
+    BucketList_T _bucketList;
+
+    /**
+     * Width (in milliseconds) of the buckets, i.e., of the days.
+     */
+    stdair::LongDuration_T _bucketWidth;
+
+    /**
+     * Number of events.
+     */
+    stdair::Count_T _size;
+
+    /**
+     * Day of the last located event. No event belongs to an earlier day.
+     * \note Moved forward when the next event is located, which may be
+     *       done by a const method (top()).
+     */
+    mutable long long _currentDay;
+
+    /**
+     * Event structures, indexed by slot.
+     */
+    std::vector<stdair::EventStruct> _eventList;
+
+    /**
+     * Slots of the event structures which have been removed.
+     */
+    std::vector<unsigned int> _freeSlotList;
+
+    /**
+     * Slot of the last extracted event, which has not been recycled yet
+     * (if any).
+     */
+    unsigned int _extractedSlot;
+    bool _hasExtractedSlot;
+
+    /**
+     * Number of removals and of buckets walked by those removals, since
+     * the last time the calendar was re-built.
+     */
+    unsigned long long _nbOfPops;
+    mutable unsigned long long _nbOfWalkedBuckets;
+
+    /**
+     * Number of insertions and of events met by those insertions, since
+     * the last time the calendar was re-built.
+     */
+    unsigned long long _nbOfInserts;
+    unsigned long long _nbOfMetEvents;
+  };
+
+}
+#endif // __SEVMGR_BOM_CALENDAREVENTQUEUEBACKEND_HPP
@@ -0,0 +1,224 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <algorithm>
+#include <vector>
+// SEvMgr
+#include <sevmgr/bom/CompactHeapEventQueueBackend.hpp>
+#include <sevmgr/bom/EventQueueCursor.hpp>
+
+namespace SEVMGR {
+
+  namespace {
+    /** Compare two compact entries, given by pointer. */
+    struct CompactEntryPtrLess {
+      bool operator() (const CompactHeapEventQueueBackend::CompactEntry* iLHS,
+                       const CompactHeapEventQueueBackend::CompactEntry* iRHS) const {
+        return (*iLHS < *iRHS);
+      }
+    };
+
+    /**
+     * Cursor browsing the heap best-first, and resolving the event
+     * structures from the payload store.
+     */
+    class CompactHeapEventCursor : public EventQueueCursor {
+    public:
+      CompactHeapEventCursor (const CompactHeapEventQueueBackend::CompactEntryHeap_T& iHeap,
+                              const EventPayloadStore& iPayloadStore,
+                              const stdair::LongDuration_T& iFromTimeStamp)
+        : _entryList (iHeap.getEntryList()), _browser (iHeap),
+          _payloadStore (iPayloadStore), _fromTimeStamp (iFromTimeStamp) {
+      }
+
+      const stdair::EventStruct* next (EventSequence_T& oSequence) {
+        CompactHeapEventQueueBackend::CompactEntryHeap_T::EntryList_T::size_type lIndex;
+        do {
+          if (_browser.next (lIndex) == false) {
+            return NULL;
+          }
+        } while (_entryList[lIndex]._timeStamp < _fromTimeStamp);
+        const CompactHeapEventQueueBackend::CompactEntry& lEntry =
+          _entryList[lIndex];
+        oSequence = lEntry._sequence;
+        return &_payloadStore.get (lEntry._eventType, lEntry._payloadIndex);
+      }
+
+    private:
+      const CompactHeapEventQueueBackend::CompactEntryHeap_T::EntryList_T& _entryList;
+      CompactHeapEventQueueBackend::CompactEntryHeap_T::Browser _browser;
+      const EventPayloadStore& _payloadStore;
+      const stdair::LongDuration_T _fromTimeStamp;
+    };
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const unsigned int CompactHeapEventQueueBackend::ARITY;
+
+  // //////////////////////////////////////////////////////////////////////
+  CompactHeapEventQueueBackend::CompactHeapEventQueueBackend()
+    : _hasExtractedEntry (false) {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  CompactHeapEventQueueBackend::
+  CompactHeapEventQueueBackend (const CompactHeapEventQueueBackend& iBackend)
+    : _hasExtractedEntry (false) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  CompactHeapEventQueueBackend::~CompactHeapEventQueueBackend() {
+    clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct& CompactHeapEventQueueBackend::top() const {
+    const CompactEntry& lEntry = _heap.front();
+    return _payloadStore.get (lEntry._eventType, lEntry._payloadIndex);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventSequence_T CompactHeapEventQueueBackend::getTopSequence() const {
+    return _heap.front()._sequence;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool CompactHeapEventQueueBackend::
+  hasTimeStamp (const stdair::LongDuration_T& iDateTimeStamp) const {
+    const CompactEntryHeap_T::EntryList_T& lEntryList = _heap.getEntryList();
+    for (CompactEntryHeap_T::EntryList_T::const_iterator itEntry =
+           lEntryList.begin(); itEntry != lEntryList.end(); ++itEntry) {
+      if (itEntry->_timeStamp == iDateTimeStamp) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CompactHeapEventQueueBackend::
+  getSortedEventList (EventStructPtrList_T& ioEventList,
+                      EventSequenceList_T* ioSequenceList_ptr) const {
+    // Sort (pointers on) the entries, as the heap is only partially ordered
+    const CompactEntryHeap_T::EntryList_T& lHeapEntryList =
+      _heap.getEntryList();
+    std::vector<const CompactEntry*> lEntryList;
+    lEntryList.reserve (lHeapEntryList.size());
+    for (CompactEntryHeap_T::EntryList_T::const_iterator itEntry =
+           lHeapEntryList.begin(); itEntry != lHeapEntryList.end(); ++itEntry) {
+      lEntryList.push_back (&(*itEntry));
+    }
+    std::sort (lEntryList.begin(), lEntryList.end(), CompactEntryPtrLess());
+
+    ioEventList.reserve (ioEventList.size() + lEntryList.size());
+    for (std::vector<const CompactEntry*>::const_iterator itEntry =
+           lEntryList.begin(); itEntry != lEntryList.end(); ++itEntry) {
+      ioEventList.push_back (&_payloadStore.get ((*itEntry)->_eventType,
+                                                 (*itEntry)->_payloadIndex));
+      if (ioSequenceList_ptr != NULL) {
+        ioSequenceList_ptr->push_back ((*itEntry)->_sequence);
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueCursor* CompactHeapEventQueueBackend::
+  createCursor (const stdair::LongDuration_T& iFromTimeStamp) const {
+    return new CompactHeapEventCursor (_heap, _payloadStore, iFromTimeStamp);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  CompactHeapEventQueueBackend::CompactEntry CompactHeapEventQueueBackend::
+  storeEvent (const stdair::EventStruct& iEventStruct,
+              const EventSequence_T& iSequence) {
+    releaseExtractedEvent();
+
+    const CompactEntry oEntry = { iEventStruct.getEventTimeStamp(),
+                                  iSequence,
+                                  _payloadStore.store (iEventStruct),
+                                  iEventStruct.getEventType() };
+    return oEntry;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool CompactHeapEventQueueBackend::
+  insert (const stdair::EventStruct& iEventStruct,
+          const EventSequence_T& iSequence) {
+    CompactEntry lEntry = storeEvent (iEventStruct, iSequence);
+    _heap.push (lEntry);
+
+    return true;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CompactHeapEventQueueBackend::
+  bulkInsert (const EventStructList_T& iEventStructList,
+              const EventSequence_T& iFirstSequence) {
+    // When the list is at least as long as the heap, append all the
+    // entries and re-heapify the whole array; otherwise, insert them
+    // one by one
+    const bool isHeapToBeRebuilt = (iEventStructList.size() >= _heap.size());
+
+    _heap.reserve (_heap.size() + iEventStructList.size());
+    EventSequence_T lSequence = iFirstSequence;
+    for (EventStructList_T::const_iterator itEvent = iEventStructList.begin();
+         itEvent != iEventStructList.end(); ++itEvent) {
+      CompactEntry lEntry = storeEvent (*itEvent, lSequence);
+      ++lSequence;
+      if (isHeapToBeRebuilt == true) {
+        _heap.append (lEntry);
+      } else {
+        _heap.push (lEntry);
+      }
+    }
+
+    if (isHeapToBeRebuilt == true) {
+      _heap.rebuild();
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CompactHeapEventQueueBackend::releaseExtractedEvent() {
+    if (_hasExtractedEntry == true) {
+      _payloadStore.release (_extractedEntry._eventType,
+                             _extractedEntry._payloadIndex);
+      _hasExtractedEntry = false;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CompactHeapEventQueueBackend::pop (stdair::EventStruct& ioEventStruct) {
+    assert (_heap.empty() == false);
+    releaseExtractedEvent();
+
+    // Extract (a copy of) the event structure of the root entry, and
+    // remove that latter
+    const CompactEntry& lEntry = _heap.front();
+    _payloadStore.extract (lEntry._eventType, lEntry._payloadIndex,
+                           ioEventStruct);
+    _heap.pop();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct& CompactHeapEventQueueBackend::extract() {
+    assert (_heap.empty() == false);
+    releaseExtractedEvent();
+
+    // Remove the root entry, leaving its event structure in its arena
+    _heap.pop (_extractedEntry);
+    _hasExtractedEntry = true;
+    return _payloadStore.get (_extractedEntry._eventType,
+                              _extractedEntry._payloadIndex);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void CompactHeapEventQueueBackend::clear() {
+    _hasExtractedEntry = false;
+    _heap.clear();
+    _payloadStore.clear();
+  }
+
+}
@@ -0,0 +1,174 @@
+#ifndef __SEVMGR_BOM_COMPACTHEAPEVENTQUEUEBACKEND_HPP
+#define __SEVMGR_BOM_COMPACTHEAPEVENTQUEUEBACKEND_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// StdAir
+#include <stdair/basic/EventType.hpp>
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/bom/EventQueueBackend.hpp>
+#include <sevmgr/bom/DAryHeap.hpp>
+#include <sevmgr/bom/EventPayloadStore.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Event queue backend relying on a 4-ary implicit heap of
+   * compact entries, the event structures being kept aside, in per
+   * event type arenas.
+   *
+   * A heap entry is only made of the ordering key, i.e., (date-time
+   * stamp, insertion sequence), along with the event type and the
+   * (32-bit) index of the event structure within the arena of that
+   * type. An entry takes 24 bytes, against more than a hundred bytes
+   * for an event structure (which holds a shared pointer for each kind
+   * of payload). Hence, a cache line holds almost three entries, and
+   * the ordering operations (sift up and down) never touch the event
+   * structures, nor their reference counters.
+   *
+   * Events having the same date-time stamp are ordered by insertion
+   * sequence, so that they are popped in the order they were added.
+   * Their date-time stamp is never altered.
+   */
+  class CompactHeapEventQueueBackend : public EventQueueBackend {
+  public:
+    // ////////// Type definitions ////////////
+    /** Arity of the heap (number of children per node). */
+    static const unsigned int ARITY = 4;
+
+    /**
+     * Entry of the heap: the ordering key, i.e., (date-time stamp,
+     * insertion sequence), along with the reference to the event
+     * structure, i.e., (event type, payload index).
+     */
+    struct CompactEntry {
+      stdair::LongDuration_T _timeStamp;
+      EventSequence_T _sequence;
+      EventPayloadIndex_T _payloadIndex;
+      stdair::EventType::EN_EventType _eventType;
+
+      /** Strict ordering on (date-time stamp, insertion sequence). */
+      bool operator< (const CompactEntry& iEntry) const {
+        return (_timeStamp < iEntry._timeStamp
+                || (_timeStamp == iEntry._timeStamp
+                    && _sequence < iEntry._sequence));
+      }
+    };
+
+    /** Heap of entries, stored in a contiguous array. */
+    typedef DAryHeap<CompactEntry, ARITY> CompactEntryHeap_T;
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    CompactHeapEventQueueBackend();
+    /** Destructor. */
+    ~CompactHeapEventQueueBackend();
+
+  private:
+    /** Copy constructor (not to be used). */
+    CompactHeapEventQueueBackend (const CompactHeapEventQueueBackend&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the type of the backend. */
+    EventQueueBackendType::EN_EventQueueBackendType getType() const {
+      return EventQueueBackendType::COMPACT_HEAP;
+    }
+
+    /** Get the number of events. */
+    stdair::Count_T size() const {
+      return _heap.size();
+    }
+
+    /** State whether there is no event. */
+    bool empty() const {
+      return _heap.empty();
+    }
+
+    /** Get the next coming (in time) event. */
+    const stdair::EventStruct& top() const;
+
+    /** Get the insertion sequence number of the next coming event. */
+    EventSequence_T getTopSequence() const;
+
+    /**
+     * State whether there is an event with the given date-time stamp.
+     *
+     * \note The heap is not sorted: that method browses all the entries
+     *       (but not the event structures).
+     */
+    bool hasTimeStamp (const stdair::LongDuration_T&) const;
+
+    /**
+     * Fill the given list with all the events, sorted by date-time.
+     *
+     * \note The heap is not sorted: the list is sorted on the fly.
+     */
+    void getSortedEventList (EventStructPtrList_T&,
+                             EventSequenceList_T*) const;
+
+    /** Create a cursor browsing the heap best-first. */
+    EventQueueCursor* createCursor (const stdair::LongDuration_T&) const;
+
+  public:
+    // ////////// Business methods /////////
+    /** Insert the given event. */
+    bool insert (const stdair::EventStruct&, const EventSequence_T&);
+
+    /**
+     * Insert all the events of the given list. When the list is at
+     * least as long as the heap, the entries are appended and the whole
+     * array is re-heapified bottom-up (Floyd), in linear time.
+     */
+    void bulkInsert (const EventStructList_T&, const EventSequence_T&);
+
+    /** Extract the next coming (in time) event. */
+    void pop (stdair::EventStruct&);
+
+    /**
+     * Extract the next coming (in time) event, without copying it: its
+     * event structure stays in its arena until the next call altering
+     * the backend.
+     */
+    const stdair::EventStruct& extract();
+
+    /** Remove all the events. The array and arena capacities are kept. */
+    void clear();
+
+  private:
+    // ////////// Heap helpers /////////
+    /**
+     * Store the given event structure, and build its heap entry, with
+     * the given insertion sequence number.
+     */
+    CompactEntry storeEvent (const stdair::EventStruct&,
+                             const EventSequence_T&);
+
+    /** Release the event structure of the last extracted event, if any. */
+    void releaseExtractedEvent();
+
+  private:
+    // ////////// Attributes /////////
+    /**
+     * Heap of (compact) entries.
+     */
+    CompactEntryHeap_T _heap;
+
+    /**
+     * Event structures, referred to by the entries.
+     */
+    EventPayloadStore _payloadStore;
+
+    /**
+     * Entry of the last extracted event, the event structure of which
+     * has not been released yet (if any).
+     */
+    CompactEntry _extractedEntry;
+    bool _hasExtractedEntry;
+  };
+
+}
+#endif // __SEVMGR_BOM_COMPACTHEAPEVENTQUEUEBACKEND_HPP
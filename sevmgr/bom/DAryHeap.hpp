@@ -0,0 +1,258 @@
+#ifndef __SEVMGR_BOM_DARYHEAP_HPP
+#define __SEVMGR_BOM_DARYHEAP_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Implicit d-ary min-heap, stored in a contiguous array.
+   *
+   * The entries are compared with their operator<(). The entries are
+   * moved, rather than swapped, along the paths from/to the root (hole
+   * technique), so that each level costs a single assignment.
+   *
+   * That is the storage shared by the heap-based event queue backends,
+   * which differ by the entries they keep in the heap.
+   */
+  template <typename ENTRY, unsigned int ARITY>
+  class DAryHeap {
+  public:
+    // ////////// Type definitions ////////////
+    /** Contiguous array holding the heap. */
+    typedef std::vector<ENTRY> EntryList_T;
+
+    /**
+     * @brief Browser of the entries of a heap, in (total) order, without
+     * removing them.
+     *
+     * The browsing is lazy and best-first: the next entry is the
+     * smallest one of a frontier, initialised with the root, and to
+     * which the children of each browsed entry are added. Browsing the
+     * k smallest entries hence costs O(k log k), whatever the size of
+     * the heap.
+     *
+     * \note The browser is no longer valid once the heap has been
+     *       altered.
+     */
+    class Browser {
+    public:
+      /** Constructor. The browser is positioned before the root. */
+      explicit Browser (const DAryHeap& iHeap)
+        : _entryList (iHeap._entryList) {
+        if (_entryList.empty() == false) {
+          _frontier.push_back (0);
+        }
+      }
+
+      /**
+       * Move on to the next entry.
+       *
+       * @param typename EntryList_T::size_type& Index of that entry,
+       *        within the array of the heap.
+       * @return bool Whether there was an entry left to be browsed.
+       */
+      bool next (typename EntryList_T::size_type& oIndex) {
+        if (_frontier.empty() == true) {
+          return false;
+        }
+        const FrontierGreater lGreater (_entryList);
+        std::pop_heap (_frontier.begin(), _frontier.end(), lGreater);
+        oIndex = _frontier.back();
+        _frontier.pop_back();
+
+        // The children of that entry are the next candidates
+        const typename EntryList_T::size_type lFirstChild = ARITY * oIndex + 1;
+        const typename EntryList_T::size_type lLastChild =
+          std::min (lFirstChild + ARITY, _entryList.size());
+        for (typename EntryList_T::size_type lChild = lFirstChild;
+             lChild < lLastChild; ++lChild) {
+          _frontier.push_back (lChild);
+          std::push_heap (_frontier.begin(), _frontier.end(), lGreater);
+        }
+        return true;
+      }
+
+    private:
+      /**
+       * Order of the frontier: the (STL) heap being a max-heap, the
+       * comparison is reversed, so that the smallest entry comes first.
+       */
+      struct FrontierGreater {
+        explicit FrontierGreater (const EntryList_T& iEntryList)
+          : _entryList (iEntryList) {}
+        bool operator() (const typename EntryList_T::size_type& iLHS,
+                         const typename EntryList_T::size_type& iRHS) const {
+          return (_entryList[iRHS] < _entryList[iLHS]);
+        }
+        const EntryList_T& _entryList;
+      };
+
+      /** Entries of the browsed heap. */
+      const EntryList_T& _entryList;
+
+      /** Indices of the candidate entries, in (STL) heap order. */
+      std::vector<typename EntryList_T::size_type> _frontier;
+    };
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the number of entries. */
+    typename EntryList_T::size_type size() const {
+      return _entryList.size();
+    }
+
+    /** State whether there is no entry. */
+    bool empty() const {
+      return _entryList.empty();
+    }
+
+    /** Get the smallest entry. */
+    const ENTRY& front() const {
+      assert (_entryList.empty() == false);
+      return _entryList.front();
+    }
+
+    /** Get all the entries, in heap (i.e., partial) order. */
+    const EntryList_T& getEntryList() const {
+      return _entryList;
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Insert the given entry. The entry is moved (only once) to its
+     * place.
+     */
+    void push (ENTRY& ioEntry) {
+      // Append an empty slot at the end of the array (it is the hole),
+      // and let the new entry climb up from there to its place
+      _entryList.push_back (ENTRY());
+      siftUp (_entryList.size() - 1, ioEntry);
+    }
+
+    /**
+     * Append the given entry at the end of the array, without restoring
+     * the heap order: rebuild() must be called once all the entries
+     * have been appended.
+     */
+    void append (ENTRY& ioEntry) {
+      _entryList.push_back (std::move (ioEntry));
+    }
+
+    /** Reserve room for the given number of entries. */
+    void reserve (const typename EntryList_T::size_type& iNbOfEntries) {
+      _entryList.reserve (iNbOfEntries);
+    }
+
+    /**
+     * Restore the heap order of the whole array bottom-up (Floyd), in
+     * linear time.
+     */
+    void rebuild() {
+      if (_entryList.size() < 2) {
+        return;
+      }
+
+      // Let each internal node go down to its place, from the last one
+      // up to the root
+      typename EntryList_T::size_type lNode =
+        (_entryList.size() - 2) / ARITY + 1;
+      while (lNode != 0) {
+        --lNode;
+        ENTRY lEntry = std::move (_entryList[lNode]);
+        siftDown (lNode, lEntry);
+      }
+    }
+
+    /** Remove the smallest entry. */
+    void pop() {
+      assert (_entryList.empty() == false);
+
+      // The last entry takes the place of the root, and goes down
+      ENTRY lLastEntry = std::move (_entryList.back());
+      _entryList.pop_back();
+      if (_entryList.empty() == false) {
+        siftDown (0, lLastEntry);
+      }
+    }
+
+    /** Move the smallest entry into the given one, and remove it. */
+    void pop (ENTRY& ioEntry) {
+      assert (_entryList.empty() == false);
+      ioEntry = std::move (_entryList.front());
+      pop();
+    }
+
+    /** Remove all the entries. The array capacity is kept. */
+    void clear() {
+      _entryList.clear();
+    }
+
+  private:
+    // ////////// Heap helpers /////////
+    /**
+     * Move the given entry up from the given (hole) position, until
+     * its parent comes before it.
+     */
+    void siftUp (typename EntryList_T::size_type iHole, ENTRY& ioEntry) {
+      while (iHole != 0) {
+        const typename EntryList_T::size_type lParent = (iHole - 1) / ARITY;
+        if ((ioEntry < _entryList[lParent]) == false) {
+          break;
+        }
+        _entryList[iHole] = std::move (_entryList[lParent]);
+        iHole = lParent;
+      }
+      _entryList[iHole] = std::move (ioEntry);
+    }
+
+    /**
+     * Move the given entry down from the given (hole) position, until
+     * all its children come after it.
+     */
+    void siftDown (typename EntryList_T::size_type iHole, ENTRY& ioEntry) {
+      const typename EntryList_T::size_type lSize = _entryList.size();
+      while (true) {
+        const typename EntryList_T::size_type lFirstChild = ARITY * iHole + 1;
+        if (lFirstChild >= lSize) {
+          break;
+        }
+
+        // Find the smallest among the (up to ARITY) children
+        const typename EntryList_T::size_type lLastChild =
+          std::min (lFirstChild + ARITY, lSize);
+        typename EntryList_T::size_type lMinChild = lFirstChild;
+        for (typename EntryList_T::size_type lChild = lFirstChild + 1;
+             lChild != lLastChild; ++lChild) {
+          if (_entryList[lChild] < _entryList[lMinChild]) {
+            lMinChild = lChild;
+          }
+        }
+
+        if ((_entryList[lMinChild] < ioEntry) == false) {
+          break;
+        }
+        _entryList[iHole] = std::move (_entryList[lMinChild]);
+        iHole = lMinChild;
+      }
+      _entryList[iHole] = std::move (ioEntry);
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /**
+     * Entries, in heap order.
+     */
+    EntryList_T _entryList;
+  };
+
+}
+#endif // __SEVMGR_BOM_DARYHEAP_HPP
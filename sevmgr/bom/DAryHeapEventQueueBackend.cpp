@@ -0,0 +1,185 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <algorithm>
+#include <utility>
+// SEvMgr
+#include <sevmgr/bom/DAryHeapEventQueueBackend.hpp>
+#include <sevmgr/bom/EventQueueCursor.hpp>
+
+namespace SEVMGR {
+
+  namespace {
+    /** Compare two heap entries, given by pointer. */
+    struct HeapEntryPtrLess {
+      bool operator() (const DAryHeapEventQueueBackend::HeapEntry* iLHS,
+                       const DAryHeapEventQueueBackend::HeapEntry* iRHS) const {
+        return (*iLHS < *iRHS);
+      }
+    };
+
+    /**
+     * Cursor browsing the heap best-first. The events earlier than the
+     * given date-time stamp are browsed, and skipped.
+     */
+    class HeapEventCursor : public EventQueueCursor {
+    public:
+      HeapEventCursor (const DAryHeapEventQueueBackend::EventHeap_T& iHeap,
+                       const stdair::LongDuration_T& iFromTimeStamp)
+        : _entryList (iHeap.getEntryList()), _browser (iHeap),
+          _fromTimeStamp (iFromTimeStamp) {
+      }
+
+      const stdair::EventStruct* next (EventSequence_T& oSequence) {
+        DAryHeapEventQueueBackend::EventHeap_T::EntryList_T::size_type lIndex;
+        do {
+          if (_browser.next (lIndex) == false) {
+            return NULL;
+          }
+        } while (_entryList[lIndex]._timeStamp < _fromTimeStamp);
+        const DAryHeapEventQueueBackend::HeapEntry& lEntry =
+          _entryList[lIndex];
+        oSequence = lEntry._sequence;
+        return &lEntry._event;
+      }
+
+    private:
+      const DAryHeapEventQueueBackend::EventHeap_T::EntryList_T& _entryList;
+      DAryHeapEventQueueBackend::EventHeap_T::Browser _browser;
+      const stdair::LongDuration_T _fromTimeStamp;
+    };
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const unsigned int DAryHeapEventQueueBackend::ARITY;
+
+  // //////////////////////////////////////////////////////////////////////
+  DAryHeapEventQueueBackend::DAryHeapEventQueueBackend()
+    : _extractedEntry() {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  DAryHeapEventQueueBackend::
+  DAryHeapEventQueueBackend (const DAryHeapEventQueueBackend& iBackend) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  DAryHeapEventQueueBackend::~DAryHeapEventQueueBackend() {
+    _heap.clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct& DAryHeapEventQueueBackend::top() const {
+    return _heap.front()._event;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventSequence_T DAryHeapEventQueueBackend::getTopSequence() const {
+    return _heap.front()._sequence;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool DAryHeapEventQueueBackend::
+  hasTimeStamp (const stdair::LongDuration_T& iDateTimeStamp) const {
+    const EventHeap_T::EntryList_T& lEntryList = _heap.getEntryList();
+    for (EventHeap_T::EntryList_T::const_iterator itEntry = lEntryList.begin();
+         itEntry != lEntryList.end(); ++itEntry) {
+      if (itEntry->_timeStamp == iDateTimeStamp) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void DAryHeapEventQueueBackend::
+  getSortedEventList (EventStructPtrList_T& ioEventList,
+                      EventSequenceList_T* ioSequenceList_ptr) const {
+    // Sort (pointers on) the entries, as the heap is only partially ordered
+    const EventHeap_T::EntryList_T& lHeapEntryList = _heap.getEntryList();
+    std::vector<const HeapEntry*> lEntryList;
+    lEntryList.reserve (lHeapEntryList.size());
+    for (EventHeap_T::EntryList_T::const_iterator itEntry =
+           lHeapEntryList.begin(); itEntry != lHeapEntryList.end(); ++itEntry) {
+      lEntryList.push_back (&(*itEntry));
+    }
+    std::sort (lEntryList.begin(), lEntryList.end(), HeapEntryPtrLess());
+
+    ioEventList.reserve (ioEventList.size() + lEntryList.size());
+    for (std::vector<const HeapEntry*>::const_iterator itEntry =
+           lEntryList.begin(); itEntry != lEntryList.end(); ++itEntry) {
+      ioEventList.push_back (&(*itEntry)->_event);
+      if (ioSequenceList_ptr != NULL) {
+        ioSequenceList_ptr->push_back ((*itEntry)->_sequence);
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueCursor* DAryHeapEventQueueBackend::
+  createCursor (const stdair::LongDuration_T& iFromTimeStamp) const {
+    return new HeapEventCursor (_heap, iFromTimeStamp);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool DAryHeapEventQueueBackend::
+  insert (const stdair::EventStruct& iEventStruct,
+          const EventSequence_T& iSequence) {
+    HeapEntry lEntry = { iEventStruct.getEventTimeStamp(), iSequence,
+                         iEventStruct };
+    _heap.push (lEntry);
+
+    return true;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void DAryHeapEventQueueBackend::
+  bulkInsert (const EventStructList_T& iEventStructList,
+              const EventSequence_T& iFirstSequence) {
+    // When the list is at least as long as the heap, append all the
+    // entries and re-heapify the whole array; otherwise, insert them
+    // one by one
+    const bool isHeapToBeRebuilt = (iEventStructList.size() >= _heap.size());
+
+    _heap.reserve (_heap.size() + iEventStructList.size());
+    EventSequence_T lSequence = iFirstSequence;
+    for (EventStructList_T::const_iterator itEvent = iEventStructList.begin();
+         itEvent != iEventStructList.end(); ++itEvent) {
+      HeapEntry lEntry = { itEvent->getEventTimeStamp(), lSequence,
+                           *itEvent };
+      ++lSequence;
+
+      if (isHeapToBeRebuilt == true) {
+        _heap.append (lEntry);
+      } else {
+        _heap.push (lEntry);
+      }
+    }
+
+    if (isHeapToBeRebuilt == true) {
+      _heap.rebuild();
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void DAryHeapEventQueueBackend::pop (stdair::EventStruct& ioEventStruct) {
+    assert (_heap.empty() == false);
+
+    // Extract (a copy of) the root event, and remove its entry
+    ioEventStruct = _heap.front()._event;
+    _heap.pop();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct& DAryHeapEventQueueBackend::extract() {
+    assert (_heap.empty() == false);
+
+    // Move the root entry aside, and remove it from the heap
+    _heap.pop (_extractedEntry);
+    return _extractedEntry._event;
+  }
+
+}
@@ -0,0 +1,167 @@
+#ifndef __SEVMGR_BOM_DARYHEAPEVENTQUEUEBACKEND_HPP
+#define __SEVMGR_BOM_DARYHEAPEVENTQUEUEBACKEND_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <vector>
+// StdAir
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/bom/EventQueueBackend.hpp>
+#include <sevmgr/bom/DAryHeap.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Event queue backend relying on a 4-ary implicit heap, stored
+   * in a contiguous array.
+   *
+   * With four children per node, the heap is twice as shallow as a
+   * binary heap, and the children of a given node share (most of the
+   * time) the same cache lines. There is no allocation per event once
+   * the array has reached its working size: a pop followed by one or
+   * two pushes (typical hold model) only shifts entries within the
+   * array.
+   *
+   * Events having the same date-time stamp are ordered by insertion
+   * sequence, so that they are popped in the order they were added.
+   * Their date-time stamp is never altered.
+   *
+   * The entries embed the whole event structure, so that each sift
+   * level copies a few shared pointers along with the key. That backend
+   * is kept self-contained on purpose, as the baseline of the
+   * COMPACT_HEAP backend, which sifts only (key, payload index) entries
+   * and stores the event structures aside; the latter is to be preferred
+   * when the queue holds many events.
+   */
+  class DAryHeapEventQueueBackend : public EventQueueBackend {
+  public:
+    // ////////// Type definitions ////////////
+    /** Arity of the heap (number of children per node). */
+    static const unsigned int ARITY = 4;
+
+    /**
+     * Entry of the heap: the event structure along with its ordering
+     * key, i.e., (date-time stamp, insertion sequence). See
+     * CompactHeapEventQueueBackend for the entry without the payload.
+     */
+    struct HeapEntry {
+      stdair::LongDuration_T _timeStamp;
+      EventSequence_T _sequence;
+      stdair::EventStruct _event;
+
+      /** Strict ordering on (date-time stamp, insertion sequence). */
+      bool operator< (const HeapEntry& iEntry) const {
+        return (_timeStamp < iEntry._timeStamp
+                || (_timeStamp == iEntry._timeStamp
+                    && _sequence < iEntry._sequence));
+      }
+    };
+
+    /** Heap of entries, stored in a contiguous array. */
+    typedef DAryHeap<HeapEntry, ARITY> EventHeap_T;
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    DAryHeapEventQueueBackend();
+    /** Destructor. */
+    ~DAryHeapEventQueueBackend();
+
+  private:
+    /** Copy constructor (not to be used). */
+    DAryHeapEventQueueBackend (const DAryHeapEventQueueBackend&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the type of the backend. */
+    EventQueueBackendType::EN_EventQueueBackendType getType() const {
+      return EventQueueBackendType::DARY_HEAP;
+    }
+
+    /** Get the number of events. */
+    stdair::Count_T size() const {
+      return _heap.size();
+    }
+
+    /** State whether there is no event. */
+    bool empty() const {
+      return _heap.empty();
+    }
+
+    /** Get the next coming (in time) event. */
+    const stdair::EventStruct& top() const;
+
+    /** Get the insertion sequence number of the next coming event. */
+    EventSequence_T getTopSequence() const;
+
+    /**
+     * State whether there is an event with the given date-time stamp.
+     *
+     * \note The heap is not sorted: that method browses all the events.
+     */
+    bool hasTimeStamp (const stdair::LongDuration_T&) const;
+
+    /**
+     * Fill the given list with all the events, sorted by date-time.
+     *
+     * \note The heap is not sorted: the list is sorted on the fly.
+     */
+    void getSortedEventList (EventStructPtrList_T&,
+                             EventSequenceList_T*) const;
+
+    /**
+     * Create a cursor browsing the heap best-first: the k next events
+     * are browsed in O(k log k), without sorting the whole heap.
+     */
+    EventQueueCursor* createCursor (const stdair::LongDuration_T&) const;
+
+  public:
+    // ////////// Business methods /////////
+    /** Insert the given event. */
+    bool insert (const stdair::EventStruct&, const EventSequence_T&);
+
+    /**
+     * Insert all the events of the given list. When the list is at
+     * least as long as the heap, the entries are appended and the whole
+     * array is re-heapified bottom-up (Floyd), in linear time.
+     */
+    void bulkInsert (const EventStructList_T&, const EventSequence_T&);
+
+    /** Extract the next coming (in time) event. */
+    void pop (stdair::EventStruct&);
+
+    /**
+     * Extract the next coming (in time) event. Its heap entry is moved
+     * aside, and kept until the next extraction.
+     *
+     * \note The entries of that heap hold the event structures, which
+     *       are moved along with them when the heap is re-ordered.
+     *       Contrary to the compact heap backend, the reference counters
+     *       of the payloads are thus altered anyway.
+     */
+    const stdair::EventStruct& extract();
+
+    /** Remove all the events. The array capacity is kept. */
+    void clear() {
+      _heap.clear();
+      _extractedEntry = HeapEntry();
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /**
+     * Heap of events.
+     */
+    EventHeap_T _heap;
+
+    /**
+     * Entry of the last extracted event.
+     */
+    HeapEntry _extractedEntry;
+  };
+
+}
+#endif // __SEVMGR_BOM_DARYHEAPEVENTQUEUEBACKEND_HPP
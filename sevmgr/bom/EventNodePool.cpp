@@ -0,0 +1,101 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// SEvMgr
+#include <sevmgr/bom/EventNodePool.hpp>
+
+namespace SEVMGR {
+
+  namespace {
+    /** Alignment of the nodes (the strictest fundamental one). */
+    const std::size_t NODE_ALIGNMENT = alignof (std::max_align_t);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const std::size_t EventNodePool::NB_OF_NODES_PER_SLAB;
+
+  // //////////////////////////////////////////////////////////////////////
+  EventNodePool::EventNodePool()
+    : _nodeSize (0), _currentSlab (0), _nextNodeInSlab (0),
+      _freeNodeList (NULL) {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventNodePool::EventNodePool (const EventNodePool& iPool)
+    : _nodeSize (0), _currentSlab (0), _nextNodeInSlab (0),
+      _freeNodeList (NULL) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventNodePool::~EventNodePool() {
+    for (std::vector<char*>::const_iterator itSlab = _slabList.begin();
+         itSlab != _slabList.end(); ++itSlab) {
+      ::operator delete (*itSlab);
+    }
+    _slabList.clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void* EventNodePool::allocate (const std::size_t& iSize) {
+    // Bind the node size at the first allocation. A node must be able
+    // to hold the link of the free list.
+    if (_nodeSize == 0) {
+      const std::size_t lSize = (iSize < sizeof (void*)) ? sizeof (void*) : iSize;
+      _nodeSize = (lSize + NODE_ALIGNMENT - 1) / NODE_ALIGNMENT * NODE_ALIGNMENT;
+    }
+    if (iSize > _nodeSize) {
+      return ::operator new (iSize);
+    }
+
+    // Recycle a released node, if any
+    if (_freeNodeList != NULL) {
+      void* oNode_ptr = _freeNodeList;
+      _freeNodeList = *static_cast<void**> (oNode_ptr);
+      return oNode_ptr;
+    }
+
+    // Otherwise, carve a new node out of the current slab, moving to
+    // the next slab (allocating it if needed) when the current one is full
+    if (_nextNodeInSlab == NB_OF_NODES_PER_SLAB) {
+      ++_currentSlab;
+      _nextNodeInSlab = 0;
+    }
+    if (_currentSlab == _slabList.size()) {
+      _slabList.push_back (static_cast<char*>
+                           (::operator new (NB_OF_NODES_PER_SLAB * _nodeSize)));
+    }
+    assert (_currentSlab < _slabList.size());
+
+    void* oNode_ptr = _slabList[_currentSlab] + _nextNodeInSlab * _nodeSize;
+    ++_nextNodeInSlab;
+    return oNode_ptr;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventNodePool::deallocate (void* ioNode_ptr, const std::size_t& iSize) {
+    if (ioNode_ptr == NULL) {
+      return;
+    }
+    if (iSize > _nodeSize) {
+      ::operator delete (ioNode_ptr);
+      return;
+    }
+
+    // Chain the node into the free list
+    *static_cast<void**> (ioNode_ptr) = _freeNodeList;
+    _freeNodeList = ioNode_ptr;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventNodePool::rewind() {
+    // Forget about the released nodes: all the slabs are to be carved
+    // again, from the first one on
+    _freeNodeList = NULL;
+    _currentSlab = 0;
+    _nextNodeInSlab = 0;
+  }
+
+}
@@ -0,0 +1,182 @@
+#ifndef __SEVMGR_BOM_EVENTNODEPOOL_HPP
+#define __SEVMGR_BOM_EVENTNODEPOOL_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Arena of fixed-size nodes, carved out of slabs owned by the
+   * pool.
+   *
+   * The node size is bound by the first allocation; the allocations of
+   * another size (if any) are forwarded to the global operator new.
+   * Released nodes are chained into a free list and recycled by the
+   * next allocations, so that, once the pool has reached its working
+   * size, there is no call to the system allocator any more.
+   *
+   * The slabs are only given back to the system when the pool is
+   * destroyed: rewind() makes all of them available again, in constant
+   * time, without browsing the nodes.
+   */
+  class EventNodePool {
+  public:
+    // ////////// Type definitions ////////////
+    /** Number of nodes per slab. */
+    static const std::size_t NB_OF_NODES_PER_SLAB = 1024;
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    EventNodePool();
+    /** Destructor. All the slabs are given back to the system. */
+    ~EventNodePool();
+
+  private:
+    /** Copy constructor (not to be used). */
+    EventNodePool (const EventNodePool&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the number of slabs, in use or not. */
+    std::size_t getNbOfSlabs() const {
+      return _slabList.size();
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /** Allocate a node of the given size. */
+    void* allocate (const std::size_t&);
+
+    /** Release the given node, of the given size. */
+    void deallocate (void*, const std::size_t&);
+
+    /**
+     * Make all the nodes available again, in constant time. The slabs
+     * are kept for the next allocations.
+     *
+     * \note No node must be in use any more (e.g., the container relying
+     *       on the pool must have been cleared).
+     */
+    void rewind();
+
+  private:
+    // ////////// Attributes /////////
+    /**
+     * Size (in bytes) of the nodes, rounded up for alignment. Zero, as
+     * long as no node has been allocated.
+     */
+    std::size_t _nodeSize;
+
+    /**
+     * Slabs, each one holding NB_OF_NODES_PER_SLAB nodes.
+     */
+    std::vector<char*> _slabList;
+
+    /**
+     * Slab from which the nodes, never allocated since the last rewind,
+     * are carved, and position of the next such node within it.
+     */
+    std::size_t _currentSlab;
+    std::size_t _nextNodeInSlab;
+
+    /**
+     * Head of the (intrusive) list of the released nodes.
+     */
+    void* _freeNodeList;
+  };
+
+
+  /**
+   * @brief Allocator (in the STL sense) drawing its nodes from an
+   * EventNodePool.
+   *
+   * When no pool is given, the allocator falls back to the global
+   * operator new, so that the same container type may be used with or
+   * without a pool. Only single-object allocations (i.e., the nodes of
+   * node-based containers) go through the pool.
+   */
+  template <typename T>
+  class EventNodeAllocator {
+  public:
+    // ////////// Type definitions ////////////
+    typedef T value_type;
+
+    /**
+     * The (pointer on the) pool follows the nodes, e.g., when a node
+     * handle is moved.
+     */
+    typedef std::true_type propagate_on_container_move_assignment;
+
+    template <typename U>
+    struct rebind {
+      typedef EventNodeAllocator<U> other;
+    };
+
+  public:
+    // ////////// Constructors /////////
+    /** Constructor. */
+    explicit EventNodeAllocator (EventNodePool* ioPool_ptr = NULL)
+      : _pool_ptr (ioPool_ptr) {
+    }
+
+    /** Conversion constructor (from the allocator of another type). */
+    template <typename U>
+    EventNodeAllocator (const EventNodeAllocator<U>& iAllocator)
+      : _pool_ptr (iAllocator.getPool()) {
+    }
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the underlying pool (NULL when there is none). */
+    EventNodePool* getPool() const {
+      return _pool_ptr;
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /** Allocate room for the given number of objects. */
+    T* allocate (std::size_t iNbOfObjects) {
+      if (_pool_ptr != NULL && iNbOfObjects == 1) {
+        return static_cast<T*> (_pool_ptr->allocate (sizeof (T)));
+      }
+      return static_cast<T*> (::operator new (iNbOfObjects * sizeof (T)));
+    }
+
+    /** Release the given room, for the given number of objects. */
+    void deallocate (T* ioObject_ptr, std::size_t iNbOfObjects) {
+      if (_pool_ptr != NULL && iNbOfObjects == 1) {
+        _pool_ptr->deallocate (ioObject_ptr, sizeof (T));
+        return;
+      }
+      ::operator delete (ioObject_ptr);
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /** Pool, from which the nodes are drawn. */
+    EventNodePool* _pool_ptr;
+  };
+
+  /** Two allocators are interchangeable when they share the same pool. */
+  template <typename T, typename U>
+  bool operator== (const EventNodeAllocator<T>& iLHS,
+                   const EventNodeAllocator<U>& iRHS) {
+    return (iLHS.getPool() == iRHS.getPool());
+  }
+
+  template <typename T, typename U>
+  bool operator!= (const EventNodeAllocator<T>& iLHS,
+                   const EventNodeAllocator<U>& iRHS) {
+    return (iLHS.getPool() != iRHS.getPool());
+  }
+
+}
+#endif // __SEVMGR_BOM_EVENTNODEPOOL_HPP
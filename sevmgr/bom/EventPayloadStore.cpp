@@ -0,0 +1,88 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// SEvMgr
+#include <sevmgr/bom/EventPayloadStore.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  EventPayloadStore::EventPayloadStore() {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventPayloadStore::EventPayloadStore (const EventPayloadStore& iStore) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventPayloadStore::~EventPayloadStore() {
+    clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventPayloadStore::
+  size (const stdair::EventType::EN_EventType& iType) const {
+    assert (iType < stdair::EventType::LAST_VALUE);
+    const PayloadArena& lArena = _arenaList[iType];
+    return (lArena._payloadList.size() - lArena._freeIndexList.size());
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventPayloadIndex_T EventPayloadStore::
+  store (const stdair::EventStruct& iEventStruct) {
+    const stdair::EventType::EN_EventType& lType = iEventStruct.getEventType();
+    assert (lType < stdair::EventType::LAST_VALUE);
+    PayloadArena& lArena = _arenaList[lType];
+
+    // Re-use a released index, if any
+    if (lArena._freeIndexList.empty() == false) {
+      const EventPayloadIndex_T oIndex = lArena._freeIndexList.back();
+      lArena._freeIndexList.pop_back();
+      lArena._payloadList[oIndex] = iEventStruct;
+      return oIndex;
+    }
+
+    const EventPayloadIndex_T oIndex = lArena._payloadList.size();
+    lArena._payloadList.push_back (iEventStruct);
+    return oIndex;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventPayloadStore::extract (const stdair::EventType::EN_EventType& iType,
+                                   const EventPayloadIndex_T& iIndex,
+                                   stdair::EventStruct& ioEventStruct) {
+    assert (iType < stdair::EventType::LAST_VALUE);
+    PayloadArena& lArena = _arenaList[iType];
+    assert (iIndex < lArena._payloadList.size());
+
+    // Extract (a copy of) the event structure, and release it
+    ioEventStruct = lArena._payloadList[iIndex];
+    release (iType, iIndex);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventPayloadStore::release (const stdair::EventType::EN_EventType& iType,
+                                   const EventPayloadIndex_T& iIndex) {
+    assert (iType < stdair::EventType::LAST_VALUE);
+    PayloadArena& lArena = _arenaList[iType];
+    assert (iIndex < lArena._payloadList.size());
+
+    // Release the payload the event structure refers to, so that it does
+    // not outlive the event, and recycle the index
+    lArena._payloadList[iIndex] = stdair::EventStruct();
+    lArena._freeIndexList.push_back (iIndex);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventPayloadStore::clear() {
+    for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+      PayloadArena& lArena = _arenaList[idx];
+      lArena._payloadList.clear();
+      lArena._freeIndexList.clear();
+    }
+  }
+
+}
@@ -0,0 +1,109 @@
+#ifndef __SEVMGR_BOM_EVENTPAYLOADSTORE_HPP
+#define __SEVMGR_BOM_EVENTPAYLOADSTORE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <vector>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/basic/EventType.hpp>
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/bom/EventQueueTypes.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Per event type arenas, holding the event structures
+   * (payloads) on behalf of an event queue backend.
+   *
+   * The backend then only orders small entries made of the date-time
+   * stamp, the event type and the index of the payload within the
+   * arena of that type: the ordering operations never touch the event
+   * structures. The indexes of the removed payloads are recycled by the
+   * next insertions of the same type.
+   */
+  class EventPayloadStore {
+  public:
+    // ////////// Type definitions ////////////
+    /** List of event structures. */
+    typedef std::vector<stdair::EventStruct> EventPayloadList_T;
+
+    /** List of payload indexes. */
+    typedef std::vector<EventPayloadIndex_T> EventPayloadIndexList_T;
+
+    /**
+     * Arena of the payloads of a given event type, along with the
+     * indexes which are not in use.
+     */
+    struct PayloadArena {
+      EventPayloadList_T _payloadList;
+      EventPayloadIndexList_T _freeIndexList;
+    };
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    EventPayloadStore();
+    /** Destructor. */
+    ~EventPayloadStore();
+
+  private:
+    /** Copy constructor (not to be used). */
+    EventPayloadStore (const EventPayloadStore&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the event structure stored at the given index for the given type. */
+    const stdair::EventStruct& get (const stdair::EventType::EN_EventType& iType,
+                                    const EventPayloadIndex_T& iIndex) const {
+      assert (iType < stdair::EventType::LAST_VALUE);
+      const EventPayloadList_T& lPayloadList = _arenaList[iType]._payloadList;
+      assert (iIndex < lPayloadList.size());
+      return lPayloadList[iIndex];
+    }
+
+    /** Get the number of event structures stored for the given type. */
+    stdair::Count_T size (const stdair::EventType::EN_EventType&) const;
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Store (a copy of) the given event structure within the arena of
+     * its type.
+     *
+     * @return EventPayloadIndex_T Index of the event structure.
+     */
+    EventPayloadIndex_T store (const stdair::EventStruct&);
+
+    /**
+     * Copy the event structure stored at the given index for the given
+     * type into the given structure, and release its index.
+     */
+    void extract (const stdair::EventType::EN_EventType&,
+                  const EventPayloadIndex_T&, stdair::EventStruct&);
+
+    /**
+     * Release the event structure stored at the given index for the
+     * given type (its payload is released), and make that index
+     * available again.
+     */
+    void release (const stdair::EventType::EN_EventType&,
+                  const EventPayloadIndex_T&);
+
+    /** Remove all the event structures. The arena capacities are kept. */
+    void clear();
+
+  private:
+    // ////////// Attributes /////////
+    /**
+     * Arenas, one per event type.
+     */
+    PayloadArena _arenaList[stdair::EventType::LAST_VALUE];
+  };
+
+}
+#endif // __SEVMGR_BOM_EVENTPAYLOADSTORE_HPP
@@ -2,7 +2,13 @@
 // Import section
 // //////////////////////////////////////////////////////////////////////
 // STL
+#include <algorithm>
 #include <cassert>
+#include <limits>
+#include <sstream>
+// Boost
+#include <boost/scoped_ptr.hpp>
+#include <boost/static_assert.hpp>
 // StdAir
 #include <stdair/stdair_exceptions.hpp>
 #include <stdair/basic/BasConst_Event.hpp>
@@ -10,41 +16,73 @@
 #include <stdair/service/Logger.hpp>
 // SEvMgr
 #include <sevmgr/basic/BasConst_EventQueueManager.hpp>
+#include <sevmgr/bom/EventQueueBackend.hpp>
+#include <sevmgr/bom/EventQueueCursor.hpp>
+#include <sevmgr/bom/EventQueueBrowser.hpp>
 #include <sevmgr/bom/EventQueue.hpp>
+#include <sevmgr/factory/FacEventQueueBackend.hpp>
 
 namespace SEVMGR {
+
+  // Each event type must have its own bit within the mask
+  BOOST_STATIC_ASSERT (stdair::EventType::LAST_VALUE
+                       <= 8 * sizeof (EventTypeMask_T));
   
   // //////////////////////////////////////////////////////////////////////
   EventQueue::EventQueue()
-    : _key (DEFAULT_EVENT_QUEUE_ID), _parent (NULL),
+    : _key (DEFAULT_EVENT_QUEUE_ID), _parent (NULL), _backend (NULL),
       _progressStatus (stdair::DEFAULT_PROGRESS_STATUS,
-                       stdair::DEFAULT_PROGRESS_STATUS) {
+                       stdair::DEFAULT_PROGRESS_STATUS),
+      _progressStatusMask (0), _isMultiProducer (false),
+      _areInsertionsDeferred (false), _nbOfPendingEvents (0),
+      _nextSequence (0), _firstPendingSequence (0), _firstValidSequence (0),
+      _removalBoundKey (std::numeric_limits<stdair::LongDuration_T>::min(), 0),
+      _nbOfCancelledEvents (0), _nbOfCancelledPendingEvents (0),
+      _isTimeIndexed (false) {
+    _nbOfCancelledEventsList.fill (0);
+    _nbOfCancelledPendingEventsList.fill (0);
+    _backend = FacEventQueueBackend::create (DEFAULT_EVENT_QUEUE_BACKEND);
   }
   
   // //////////////////////////////////////////////////////////////////////
   EventQueue::EventQueue (const Key_T& iKey)
-    : _key (iKey), _parent (NULL),
+    : _key (iKey), _parent (NULL), _backend (NULL),
       _progressStatus (stdair::DEFAULT_PROGRESS_STATUS,
-                       stdair::DEFAULT_PROGRESS_STATUS) {
+                       stdair::DEFAULT_PROGRESS_STATUS),
+      _progressStatusMask (0), _isMultiProducer (false),
+      _areInsertionsDeferred (false), _nbOfPendingEvents (0),
+      _nextSequence (0), _firstPendingSequence (0), _firstValidSequence (0),
+      _removalBoundKey (std::numeric_limits<stdair::LongDuration_T>::min(), 0),
+      _nbOfCancelledEvents (0), _nbOfCancelledPendingEvents (0),
+      _isTimeIndexed (false) {
+    _nbOfCancelledEventsList.fill (0);
+    _nbOfCancelledPendingEventsList.fill (0);
+    _backend = FacEventQueueBackend::create (DEFAULT_EVENT_QUEUE_BACKEND);
   }
   
   // //////////////////////////////////////////////////////////////////////
   EventQueue::EventQueue (const EventQueue& iEventQueue)
-    : _key (DEFAULT_EVENT_QUEUE_ID), _parent (NULL),
+    : _key (DEFAULT_EVENT_QUEUE_ID), _parent (NULL), _backend (NULL),
       _progressStatus (stdair::DEFAULT_PROGRESS_STATUS,
-                       stdair::DEFAULT_PROGRESS_STATUS) {
+                       stdair::DEFAULT_PROGRESS_STATUS),
+      _progressStatusMask (0), _isMultiProducer (false),
+      _areInsertionsDeferred (false), _nbOfPendingEvents (0),
+      _nextSequence (0), _firstPendingSequence (0), _firstValidSequence (0),
+      _removalBoundKey (std::numeric_limits<stdair::LongDuration_T>::min(), 0),
+      _nbOfCancelledEvents (0), _nbOfCancelledPendingEvents (0),
+      _isTimeIndexed (false) {
     assert (false);
   }
   
   // //////////////////////////////////////////////////////////////////////
   EventQueue::~EventQueue() {
-    _eventList.clear();
+    delete _backend; _backend = NULL;
   }
   
   // //////////////////////////////////////////////////////////////////////
   std::string EventQueue::toString() const {
     std::ostringstream oStr;
-    oStr << "(" << _eventList.size() << ") "
+    oStr << "(" << _backend->size() - _nbOfCancelledEvents << ") "
          << _progressStatus.getCurrentNb() << "/{"
          << _progressStatus.getExpectedNb() << ","
          << _progressStatus.getActualNb() << "}";
@@ -67,9 +105,11 @@ namespace SEVMGR {
     oStr << toString() << std::endl;
 
     // Browse the events
-    for (stdair::EventList_T::const_iterator itEvent = _eventList.begin();
-	 itEvent != _eventList.end(); ++itEvent) {
-      const stdair::EventStruct& lEvent = itEvent->second;
+    EventStructPtrList_T lEventList;
+    getSortedEventList (lEventList);
+    for (EventStructPtrList_T::const_iterator itEvent = lEventList.begin();
+	 itEvent != lEventList.end(); ++itEvent) {
+      const stdair::EventStruct& lEvent = **itEvent;
  
       oStr << lEvent.describe();
     }
@@ -86,31 +126,340 @@ namespace SEVMGR {
       oStr << "List " << stdair::EventType::getLabel(iType) 
 	   << " events:" << std::endl;
       
-      // Browse the events
-      for (stdair::EventList_T::const_iterator itEvent = _eventList.begin();
-	   itEvent != _eventList.end(); ++itEvent) {
-	const stdair::EventStruct& lEvent = itEvent->second;
+      // Browse the events of that type
+      EventStructPtrList_T lEventList;
+      getSortedEventList (lEventList, iType);
+      for (EventStructPtrList_T::const_iterator itEvent = lEventList.begin();
+	   itEvent != lEventList.end(); ++itEvent) {
+	const stdair::EventStruct& lEvent = **itEvent;
  
-	if (lEvent.getEventType() == iType) {  
-	  oStr << lEvent.describe();
-	}
+	oStr << lEvent.describe();
       }	
       return oStr.str();
   }
 
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::
+  getSortedEventList (EventStructPtrList_T& ioEventList) const {
+    if (_nbOfCancelledEvents == 0) {
+      _backend->getSortedEventList (ioEventList, NULL);
+      return;
+    }
+
+    // Leave the cancelled events out
+    EventStructPtrList_T lEventList;
+    EventSequenceList_T lSequenceList;
+    _backend->getSortedEventList (lEventList, &lSequenceList);
+    ioEventList.reserve (ioEventList.size() + lEventList.size()
+                         - _nbOfCancelledEvents);
+    for (EventStructPtrList_T::size_type idx = 0; idx != lEventList.size();
+         ++idx) {
+      const EventOrderingKey_T lKey (lEventList[idx]->getEventTimeStamp(),
+                                     lSequenceList[idx]);
+      if (_cancelledEventKeySet.find (lKey) == _cancelledEventKeySet.end()) {
+        ioEventList.push_back (lEventList[idx]);
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::
+  getSortedEventList (EventStructPtrList_T& ioEventList,
+                      const stdair::EventType::EN_EventType& iType) const {
+    if (iType >= stdair::EventType::LAST_VALUE
+        || _nbOfCancelledEventsList[iType] == 0) {
+      _backend->getSortedEventListOfType (ioEventList, iType, NULL);
+      return;
+    }
+
+    // Leave the cancelled events out
+    EventStructPtrList_T lEventList;
+    EventSequenceList_T lSequenceList;
+    _backend->getSortedEventListOfType (lEventList, iType, &lSequenceList);
+    for (EventStructPtrList_T::size_type idx = 0; idx != lEventList.size();
+         ++idx) {
+      const EventOrderingKey_T lKey (lEventList[idx]->getEventTimeStamp(),
+                                     lSequenceList[idx]);
+      if (_cancelledEventKeySet.find (lKey) == _cancelledEventKeySet.end()) {
+        ioEventList.push_back (lEventList[idx]);
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueBackendType::EN_EventQueueBackendType EventQueue::
+  getBackendType () const {
+    return _backend->getType();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::
+  setBackendType (const EventQueueBackendType::EN_EventQueueBackendType& iType) {
+    if (iType == _backend->getType()) {
+      return;
+    }
+    flushPendingEvents();
+
+    // Transfer the events, if any, from the current backend into the new one
+    rebuildBackend (iType);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::
+  rebuildBackend (const EventQueueBackendType::EN_EventQueueBackendType& iType) {
+    EventQueueBackend* lNewBackend_ptr = FacEventQueueBackend::create (iType);
+    assert (lNewBackend_ptr != NULL);
+
+    // The events keep their sequence numbers, and hence their handles
+    stdair::EventStruct lEventStruct;
+    while (_backend->empty() == false) {
+      const EventSequence_T lSequence = _backend->getTopSequence();
+      _backend->pop (lEventStruct);
+      if (_nbOfCancelledEvents != 0
+          && _cancelledEventKeySet.
+          erase (EventOrderingKey_T (lEventStruct.getEventTimeStamp(),
+                                     lSequence)) != 0) {
+        continue;
+      }
+      lNewBackend_ptr->insert (lEventStruct, lSequence);
+    }
+
+    // All the cancelled events were held by the former backend
+    assert (_cancelledEventKeySet.empty() == true);
+    _nbOfCancelledEvents = 0;
+    _nbOfCancelledEventsList.fill (0);
+
+    delete _backend;
+    _backend = lNewBackend_ptr;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::setMultiProducer (const bool& iIsMultiProducer) {
+    // Transfer the events added by the producers, if any, when leaving
+    // the multi-producer mode
+    flushPendingEvents();
+    _isMultiProducer = iIsMultiProducer;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::setInsertionsDeferred (const bool& iAreInsertionsDeferred) {
+    // The deferred events are transferred at the next pop (or extraction),
+    // or right away when the insertions are no longer deferred, so that
+    // the pending events always have consecutive sequence numbers
+    _areInsertionsDeferred = iAreInsertionsDeferred;
+    if (_areInsertionsDeferred == false && _isMultiProducer == false) {
+      flushPendingEvents();
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::setTimeIndexed (const bool& iIsTimeIndexed) {
+    if (iIsTimeIndexed == _isTimeIndexed) {
+      return;
+    }
+    _isTimeIndexed = iIsTimeIndexed;
+    _eventTimeIndex.clear();
+    if (_isTimeIndexed == false) {
+      return;
+    }
+
+    // Index the events already held by the backend (but the cancelled
+    // ones)
+    flushPendingEvents();
+    EventStructPtrList_T lEventList;
+    getSortedEventList (lEventList);
+    for (EventStructPtrList_T::const_iterator itEvent = lEventList.begin();
+         itEvent != lEventList.end(); ++itEvent) {
+      const stdair::EventStruct& lEventStruct = **itEvent;
+      _eventTimeIndex.add (lEventStruct.getEventType(),
+                           lEventStruct.getEventTimeStamp());
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::flushPendingEvents () {
+    // Most of the time, there is no pending event: the mutex is then
+    // not even locked
+    if (_nbOfPendingEvents.load (std::memory_order_acquire) == 0) {
+      return;
+    }
+
+    EventSequence_T lFirstSequence = 0;
+    {
+      std::lock_guard<std::mutex> lGuard (_pendingEventListMutex);
+      _flushedEventList.swap (_pendingEventList);
+      _nbOfPendingEvents.store (0, std::memory_order_relaxed);
+      lFirstSequence = _firstPendingSequence;
+    }
+
+    // The producers may go on adding events, while the pending ones are
+    // inserted, in the order they were added
+    _backend->bulkInsert (_flushedEventList, lFirstSequence);
+
+    // Index the transferred events, but the cancelled ones
+    if (_isTimeIndexed == true) {
+      for (EventStructList_T::size_type idx = 0;
+           idx != _flushedEventList.size(); ++idx) {
+        const stdair::EventStruct& lEventStruct = _flushedEventList[idx];
+        if (_nbOfCancelledPendingEvents != 0
+            && _cancelledEventKeySet.
+            find (EventOrderingKey_T (lEventStruct.getEventTimeStamp(),
+                                      lFirstSequence + idx))
+            != _cancelledEventKeySet.end()) {
+          continue;
+        }
+        _eventTimeIndex.add (lEventStruct.getEventType(),
+                             lEventStruct.getEventTimeStamp());
+      }
+    }
+    _flushedEventList.clear();
+
+    // The cancelled pending events, if any, are now held by the backend
+    if (_nbOfCancelledPendingEvents != 0) {
+      for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE;
+           ++idx) {
+        _nbOfCancelledEventsList[idx] += _nbOfCancelledPendingEventsList[idx];
+      }
+      _nbOfCancelledEvents += _nbOfCancelledPendingEvents;
+      _nbOfCancelledPendingEventsList.fill (0);
+      _nbOfCancelledPendingEvents = 0;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventOrderingKey_T EventQueue::getTopKey () const {
+    assert (_backend->empty() == false);
+    return EventOrderingKey_T (_backend->top().getEventTimeStamp(),
+                               _backend->getTopSequence());
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::discardCancelledEvents () {
+    if (_nbOfCancelledEvents == 0) {
+      return;
+    }
+
+    // Compact the backend, when it is mostly made of cancelled events
+    if (2 * _nbOfCancelledEvents > _backend->size()) {
+      rebuildBackend (_backend->getType());
+      return;
+    }
+
+    // The lowest cancelled key cannot be lower than the one of the next
+    // event: drop the next events as long as both match
+    while (_cancelledEventKeySet.empty() == false
+           && getTopKey() == *_cancelledEventKeySet.begin()) {
+      const EventOrderingKey_T& lKey = *_cancelledEventKeySet.begin();
+      updateRemovalBound (lKey.first, lKey.second);
+      const stdair::EventStruct& lEventStruct = _backend->extract();
+      --_nbOfCancelledEventsList[lEventStruct.getEventType()];
+      --_nbOfCancelledEvents;
+      _cancelledEventKeySet.erase (_cancelledEventKeySet.begin());
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::invalidateEventHandles () {
+    {
+      std::lock_guard<std::mutex> lGuard (_pendingEventListMutex);
+      _firstValidSequence = _nextSequence;
+    }
+    _cancelledEventKeySet.clear();
+    _nbOfCancelledEvents = 0;
+    _nbOfCancelledEventsList.fill (0);
+    _nbOfCancelledPendingEvents = 0;
+    _nbOfCancelledPendingEventsList.fill (0);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool EventQueue::isEventQueued (const EventHandle& iHandle) const {
+    if (iHandle.isValid() == false
+        || iHandle.getSequence() < _firstValidSequence) {
+      return false;
+    }
+
+    const EventOrderingKey_T lKey (iHandle.getTimeStamp(),
+                                   iHandle.getSequence());
+    if (lKey < _removalBoundKey) {
+      return false;
+    }
+    return (_cancelledEventKeySet.find (lKey) == _cancelledEventKeySet.end());
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool EventQueue::cancelEvent (const EventHandle& iHandle) {
+    // The event may still be pending. While the insertions are deferred,
+    // the pending events are left aside (the backend must not be
+    // altered), and the event may be flagged before it is transferred.
+    bool isEventPending = false;
+    if (_areInsertionsDeferred == true) {
+      std::lock_guard<std::mutex> lGuard (_pendingEventListMutex);
+      isEventPending = (_pendingEventList.empty() == false
+                        && iHandle.getSequence() >= _firstPendingSequence);
+    } else {
+      flushPendingEvents();
+    }
+
+    if (isEventQueued (iHandle) == false) {
+      return false;
+    }
+
+    // Flag the event: it is dropped when it comes at the front
+    const EventOrderingKey_T lKey (iHandle.getTimeStamp(),
+                                   iHandle.getSequence());
+    _cancelledEventKeySet.insert (lKey);
+    if (isEventPending == true) {
+      ++_nbOfCancelledPendingEventsList[iHandle.getEventType()];
+      ++_nbOfCancelledPendingEvents;
+    } else {
+      ++_nbOfCancelledEventsList[iHandle.getEventType()];
+      ++_nbOfCancelledEvents;
+      if (_isTimeIndexed == true) {
+        _eventTimeIndex.remove (iHandle.getEventType(),
+                                iHandle.getTimeStamp());
+      }
+    }
+    return true;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventHandle EventQueue::
+  rescheduleEvent (const EventHandle& iHandle,
+                   const stdair::EventStruct& iEventStruct) {
+    if (cancelEvent (iHandle) == false) {
+      return EventHandle();
+    }
+    return addEvent (iEventStruct);
+  }
+
   // //////////////////////////////////////////////////////////////////////
   stdair::Count_T EventQueue::getQueueSize () const {
-    return _eventList.size();
+    const stdair::Count_T lNbOfPendingEvents =
+      _nbOfPendingEvents.load (std::memory_order_acquire);
+    return (_backend->size() - _nbOfCancelledEvents
+            + lNbOfPendingEvents - _nbOfCancelledPendingEvents);
   }
   
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueue::
+  getQueueSize (const stdair::EventType::EN_EventType& iType) const {
+    if (iType >= stdair::EventType::LAST_VALUE) {
+      return _backend->count (iType);
+    }
+    return (_backend->count (iType) - _nbOfCancelledEventsList[iType]);
+  }
+
   // //////////////////////////////////////////////////////////////////////
   bool EventQueue::isQueueEmpty () const {
-    return _eventList.empty();
+    const stdair::Count_T lNbOfPendingEvents =
+      _nbOfPendingEvents.load (std::memory_order_acquire);
+    return (_backend->size() == _nbOfCancelledEvents
+            && lNbOfPendingEvents == _nbOfCancelledPendingEvents);
   }
   
   // //////////////////////////////////////////////////////////////////////
   bool EventQueue::isQueueDone () const {
-    const bool isQueueEmpty = _eventList.empty();
+    const bool isQueueEmpty = this->isQueueEmpty();
     return isQueueEmpty;
   }
 
@@ -119,34 +468,44 @@ namespace SEVMGR {
     // Reset only the current number of events, not the expected one
     _progressStatus.reset();
     
-    // Empty the list of events
-    _eventList.clear();
+    // Empty the list of events, including the ones not transferred yet
+    // into the backend
+    {
+      std::lock_guard<std::mutex> lGuard (_pendingEventListMutex);
+      _pendingEventList.clear();
+      _nbOfPendingEvents.store (0, std::memory_order_relaxed);
+    }
+    _backend->clear();
+    _eventTimeIndex.clear();
+    invalidateEventHandles();
+    _removalBoundKey =
+      EventOrderingKey_T (std::numeric_limits<stdair::LongDuration_T>::min(), 0);
 
     // Reset the progress statuses for all the event types
-    for (ProgressStatusMap_T::iterator itProgressStatus =
-           _progressStatusMap.begin();
-         itProgressStatus != _progressStatusMap.end(); ++itProgressStatus) {
-      stdair::ProgressStatus& lProgressStatus = itProgressStatus->second;
-      lProgressStatus.reset();
+    for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+      _progressStatusList[idx].reset();
     }
+    publishProgressStatuses (_progressStatusMask);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::
+  publishProgressStatuses (const EventTypeMask_T& iUpdatedTypeMask) {
+    _progressMonitor.publish (_progressStatus, _progressStatusList,
+                              _progressStatusMask, iUpdatedTypeMask);
   }
 
   // //////////////////////////////////////////////////////////////////////
   bool EventQueue::
   hasProgressStatus (const stdair::EventType::EN_EventType& iType) const {
 
-    bool hasProgressStatus = true;
-
-    // Retrieve the ProgressStatus structure corresponding to the
-    // given event type
-    ProgressStatusMap_T::const_iterator itProgressStatus =
-      _progressStatusMap.find (iType);
-    if (itProgressStatus == _progressStatusMap.end()) {
+    const bool hasProgressStatus = isStatusDeclared (iType);
+    if (hasProgressStatus == false) {
       //
       STDAIR_LOG_DEBUG ("No ProgressStatus structure can be retrieved in the "
-                        << "EventQueue: " << display());
-
-      hasProgressStatus = false;
+                        << "EventQueue '" << describeKey() << "' for the "
+                        << "following event type: "
+                        << stdair::EventType::getLabel (iType));
     }
     
     return hasProgressStatus;
@@ -158,16 +517,14 @@ namespace SEVMGR {
 
     // Retrieve the ProgressStatus structure corresponding to the
     // given event type
-    ProgressStatusMap_T::const_iterator itProgressStatus =
-      _progressStatusMap.find (iType);
-    if (itProgressStatus == _progressStatusMap.end()) {
+    if (isStatusDeclared (iType) == false) {
       //
       STDAIR_LOG_ERROR ("No ProgressStatus structure can be retrieved in the "
                         << "EventQueue: " << display());
       assert (false);
     }
     
-    const stdair::ProgressStatus& lProgressStatus = itProgressStatus->second;
+    const stdair::ProgressStatus& lProgressStatus = _progressStatusList[iType];
     return lProgressStatus.getCurrentNb();
   }
 
@@ -177,9 +534,7 @@ namespace SEVMGR {
 
     // Retrieve the ProgressStatus structure corresponding to the
     // given event type
-    ProgressStatusMap_T::const_iterator itProgressStatus =
-      _progressStatusMap.find (iType);
-    if (itProgressStatus == _progressStatusMap.end()) {
+    if (isStatusDeclared (iType) == false) {
       std::ostringstream oStr;
       oStr << "No ProgressStatus structure can be retrieved in the EventQueue '"
            << display() << "'. The EventQueue should be initialised, e.g., by "
@@ -189,7 +544,7 @@ namespace SEVMGR {
       throw EventQueueException (oStr.str());
     }
     
-    const stdair::ProgressStatus& lProgressStatus = itProgressStatus->second;
+    const stdair::ProgressStatus& lProgressStatus = _progressStatusList[iType];
     return lProgressStatus.getExpectedNb();
   }
 
@@ -199,16 +554,14 @@ namespace SEVMGR {
 
     // Retrieve the ProgressStatus structure corresponding to the
     // given event type
-    ProgressStatusMap_T::const_iterator itProgressStatus =
-      _progressStatusMap.find (iType);
-    if (itProgressStatus == _progressStatusMap.end()) {
+    if (isStatusDeclared (iType) == false) {
       //
       STDAIR_LOG_ERROR ("No ProgressStatus structure can be retrieved in the "
                         << "EventQueue: " << display());
       assert (false);
     }
     
-    const stdair::ProgressStatus& lProgressStatus = itProgressStatus->second;
+    const stdair::ProgressStatus& lProgressStatus = _progressStatusList[iType];
     return lProgressStatus.getActualNb();
   }
 
@@ -216,30 +569,26 @@ namespace SEVMGR {
   void EventQueue::updateStatus (const stdair::EventType::EN_EventType& iType,
                                  const stdair::ProgressStatus& iProgressStatus) {
 
-    // Retrieve, if existing, the ProgressStatus structure
-    // corresponding to the given event type
-    ProgressStatusMap_T::iterator itProgressStatus =
-      _progressStatusMap.find (iType);
-    if (itProgressStatus == _progressStatusMap.end()) {
-      const bool hasInsertBeenSuccessful =
-        _progressStatusMap.insert (ProgressStatusMap_T::
-                                   value_type (iType, iProgressStatus)).second;
-      
-      if (hasInsertBeenSuccessful == false) {
-        STDAIR_LOG_ERROR ("No progress_status can be inserted "
-                          << "for the following event type: "
-                          << stdair::EventType::getLabel(iType)
-                          << ". EventQueue: " << toString());
-        throw stdair::EventException ("No progress_status can be inserted for the "
-				      "following event type: "
-				      + stdair::EventType::getLabel(iType)
-				      + ". EventQueue: " + toString());
-      }
+    if (iType >= stdair::EventType::LAST_VALUE) {
+      STDAIR_LOG_ERROR ("No progress_status can be inserted "
+                        << "for the following event type: "
+                        << stdair::EventType::getLabel(iType)
+                        << ". EventQueue: " << toString());
+      throw stdair::EventException ("No progress_status can be inserted for the "
+                                    "following event type: "
+                                    + stdair::EventType::getLabel(iType)
+                                    + ". EventQueue: " + toString());
+    }
 
+    // Declare the ProgressStatus structure corresponding to the given
+    // event type, if not already done
+    stdair::ProgressStatus& lProgressStatus = _progressStatusList[iType];
+    if (isStatusDeclared (iType) == false) {
+      lProgressStatus = iProgressStatus;
+      _progressStatusMask |= getStatusBit (iType);
+      publishProgressStatuses (getStatusBit (iType));
       return;
     }
-    
-    stdair::ProgressStatus& lProgressStatus = itProgressStatus->second;
 
     // Update the progress status
     const stdair::Count_T& lCurrentNb = iProgressStatus.getCurrentNb();
@@ -250,6 +599,8 @@ namespace SEVMGR {
 
     const stdair::Count_T& lActualNb = iProgressStatus.getActualNb();
     lProgressStatus.setActualNb (lProgressStatus.getActualNb() + lActualNb);
+
+    publishProgressStatuses (getStatusBit (iType));
   }
 
   // //////////////////////////////////////////////////////////////////////
@@ -276,6 +627,7 @@ namespace SEVMGR {
 				  + iExpectedTotalNbOfEvents);
     _progressStatus.setActualNb (lActualNb);
 
+    publishProgressStatuses (getStatusBit (iType));
   }
 
   // //////////////////////////////////////////////////////////////////////
@@ -287,12 +639,10 @@ namespace SEVMGR {
       static_cast<const stdair::Count_T> (std::floor (iActualNbOfEvents));
       
     // Update the progress status for the corresponding content type key
-    ProgressStatusMap_T::iterator itProgressStatus =
-      _progressStatusMap.find (iType);
-    if (itProgressStatus != _progressStatusMap.end()) {
+    if (isStatusDeclared (iType) == true) {
 
       //
-      stdair::ProgressStatus& lProgressStatus = itProgressStatus->second;
+      stdair::ProgressStatus& lProgressStatus = _progressStatusList[iType];
 
       // Update the overall progress status
       const stdair::Count_T& lActualEventTypeNb = lProgressStatus.getActualNb();
@@ -304,6 +654,8 @@ namespace SEVMGR {
 
       // Update the progress status for the corresponding type key
       lProgressStatus.setActualNb (lActualNbOfEventsInt); 
+
+      publishProgressStatuses (getStatusBit (iType));
     }  
   }
 
@@ -311,14 +663,11 @@ namespace SEVMGR {
   void EventQueue::setStatus (const stdair::EventType::EN_EventType& iType,
                               const stdair::ProgressStatus& iProgressStatus) {
 
-    // Retrieve the ProgressStatus structure corresponding to the
-    // given event type
-    ProgressStatusMap_T::iterator itProgressStatus =
-      _progressStatusMap.find (iType);
-    // assert (itProgressStatus != _progressStatusMap.end());
-    if (itProgressStatus != _progressStatusMap.end()) {
-      // Update the ProgressStatus structure
-      itProgressStatus->second = iProgressStatus;
+    // Update the ProgressStatus structure corresponding to the given
+    // event type, if any
+    if (isStatusDeclared (iType) == true) {
+      _progressStatusList[iType] = iProgressStatus;
+      publishProgressStatuses (getStatusBit (iType));
     }
   }
 
@@ -328,9 +677,7 @@ namespace SEVMGR {
 
     // Retrieve the ProgressStatus structure corresponding to the
     // given event type
-    ProgressStatusMap_T::const_iterator itProgressStatus =
-      _progressStatusMap.find (iType);   
-    if (itProgressStatus == _progressStatusMap.end()) {
+    if (isStatusDeclared (iType) == false) {
       std::ostringstream oStr;
       oStr << "No ProgressStatus structure can be retrieved in the EventQueue '" 
 	   << display() << "' for the following event type: " 
@@ -339,9 +686,8 @@ namespace SEVMGR {
       STDAIR_LOG_ERROR (oStr.str());
       throw EventQueueException (oStr.str());
     }
-    assert(itProgressStatus != _progressStatusMap.end());
     
-    const stdair::ProgressStatus& oProgressStatus = itProgressStatus->second;
+    const stdair::ProgressStatus& oProgressStatus = _progressStatusList[iType];
     return oProgressStatus;
   }
 
@@ -351,23 +697,25 @@ namespace SEVMGR {
 
     // Retrieve the ProgressStatus structure corresponding to the
     // given event type
-    ProgressStatusMap_T::const_iterator itProgressStatus =
-      _progressStatusMap.find (iType);
-    if (itProgressStatus == _progressStatusMap.end()) {
+    if (isStatusDeclared (iType) == false) {
       //
       STDAIR_LOG_ERROR ("No ProgressStatus structure can be retrieved in the "
                         << "EventQueue: " << display());
       assert (false);
     }
     
-    const stdair::ProgressStatus& lProgressStatus = itProgressStatus->second;
+    const stdair::ProgressStatus& lProgressStatus = _progressStatusList[iType];
     return lProgressStatus.progress();
   }
 
   // //////////////////////////////////////////////////////////////////////
   stdair::ProgressStatusSet EventQueue::popEvent (stdair::EventStruct& ioEventStruct) {
 
-    if (_eventList.empty() == true) {  
+    // Take into account the events added by the producers, if any
+    flushPendingEvents();
+    discardCancelledEvents();
+
+    if (_backend->empty() == true) {  
       std::ostringstream oStr;
       oStr << "The event queue '" << describeKey() << "' is empty. "
 	   << "No event can be popped.";
@@ -378,54 +726,222 @@ namespace SEVMGR {
 
     /**
      * 1. Update the event queue itself.
+     *
+     * Extract (a copy of) the first event (sorted by date-time stamps),
+     * and remove it from the backend. Moreover, the resulting EventStruct
+     * structure will be returned by this method.
      */
-    // Get an iterator on the first event (sorted by date-time stamps)
-    stdair::EventList_T::iterator itEvent = _eventList.begin();
+    const EventSequence_T lSequence = _backend->getTopSequence();
+    _backend->pop (ioEventStruct);
+    updateRemovalBound (ioEventStruct.getEventTimeStamp(), lSequence);
+    if (_isTimeIndexed == true) {
+      _eventTimeIndex.remove (ioEventStruct.getEventType(),
+                              ioEventStruct.getEventTimeStamp());
+    }
 
     /**
-     * Extract (a copy of) the corresponding Event structure. We make
-     * a copy here, as the original EventStruct structure is removed
-     * from the list (and erased). Moreover, the resulting EventStruct
-     * structure will be returned by this method.
+     * 2. Update the progress statuses.
      */
-    ioEventStruct = itEvent->second;
-    // Retrieve the event type
-    const stdair::EventType::EN_EventType& lEventType = ioEventStruct.getEventType();
-    stdair::ProgressStatusSet oProgressStatusSet (lEventType);
-  
-    // Update the (current number part of the) overall progress status,
-    // to account for the event that is being popped out of the event
-    // queue.
-    ++_progressStatus;
-    
-    // Remove the event, which has just been retrieved
-    _eventList.erase (itEvent);
+    return updateProgressStatuses (ioEventStruct.getEventType());
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct* EventQueue::peekEvent() {
+
+    // Take into account the events added by the producers, if any
+    flushPendingEvents();
+    discardCancelledEvents();
 
+    if (_backend->empty() == true) {
+      return NULL;
+    }
+    return &_backend->top();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::DateTime_T EventQueue::getNextEventDateTime() {
+    const stdair::EventStruct* lEventStruct_ptr = peekEvent();
+    if (lEventStruct_ptr == NULL) {
+      return stdair::DateTime_T (boost::posix_time::not_a_date_time);
+    }
+    return lEventStruct_ptr->getEventTime();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::LongDuration_T EventQueue::
+  getTimeStamp (const stdair::DateTime_T& iDateTime) {
+    // Compute the number of milliseconds between the given date-time
+    // and DEFAULT_EVENT_OLDEST_DATETIME
+    const stdair::Duration_T lDuration =
+      iDateTime - stdair::DEFAULT_EVENT_OLDEST_DATETIME;
+    return lDuration.total_milliseconds();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventBrowser* EventQueue::
+  createBrowser (const stdair::DateTime_T& iHorizonDateTime) {
+    // The horizon itself is included
+    const stdair::LongDuration_T lHorizonTimeStamp =
+      getTimeStamp (iHorizonDateTime);
+    return createBrowser (std::numeric_limits<stdair::LongDuration_T>::min(),
+                          lHorizonTimeStamp + 1,
+                          ~static_cast<EventTypeMask_T> (0));
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventBrowser* EventQueue::
+  createBrowser (const stdair::DateTime_T& iFromDateTime,
+                 const stdair::DateTime_T& iToDateTime) {
+    return createBrowser (getTimeStamp (iFromDateTime),
+                          getTimeStamp (iToDateTime),
+                          ~static_cast<EventTypeMask_T> (0));
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventBrowser* EventQueue::
+  createBrowser (const stdair::DateTime_T& iFromDateTime,
+                 const stdair::DateTime_T& iToDateTime,
+                 const stdair::EventType::EN_EventType& iType) {
+    return createBrowser (getTimeStamp (iFromDateTime),
+                          getTimeStamp (iToDateTime), getStatusBit (iType));
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventBrowser* EventQueue::
+  createBrowser (const stdair::LongDuration_T& iFromTimeStamp,
+                 const stdair::LongDuration_T& iToTimeStamp,
+                 const EventTypeMask_T& iTypeMask) {
+
+    // Take into account the events added by the producers, if any
+    flushPendingEvents();
+    discardCancelledEvents();
+
+    EventQueueCursor* lCursor_ptr = _backend->createCursor (iFromTimeStamp);
+    assert (lCursor_ptr != NULL);
+    return new EventQueueBrowser (lCursor_ptr, _cancelledEventKeySet,
+                                  iToTimeStamp, iTypeMask);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueue::
+  countEvents (const stdair::DateTime_T& iFromDateTime,
+               const stdair::DateTime_T& iToDateTime) {
+    return countEvents (getTimeStamp (iFromDateTime),
+                        getTimeStamp (iToDateTime),
+                        ~static_cast<EventTypeMask_T> (0));
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueue::
+  countEvents (const stdair::DateTime_T& iFromDateTime,
+               const stdair::DateTime_T& iToDateTime,
+               const stdair::EventType::EN_EventType& iType) {
+    return countEvents (getTimeStamp (iFromDateTime),
+                        getTimeStamp (iToDateTime), getStatusBit (iType));
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueue::
+  countEvents (const stdair::LongDuration_T& iFromTimeStamp,
+               const stdair::LongDuration_T& iToTimeStamp,
+               const EventTypeMask_T& iTypeMask) {
+    if (iToTimeStamp <= iFromTimeStamp) {
+      return 0;
+    }
+
+    // Without index, the events of the range are browsed
+    if (_isTimeIndexed == false) {
+      boost::scoped_ptr<EventBrowser>
+        lBrowser_ptr (createBrowser (iFromTimeStamp, iToTimeStamp, iTypeMask));
+      stdair::Count_T oNbOfEvents = 0;
+      while (lBrowser_ptr->next() != NULL) {
+        ++oNbOfEvents;
+      }
+      return oNbOfEvents;
+    }
+
+    // Take into account the events added by the producers, if any
+    flushPendingEvents();
+
+    if (iTypeMask == ~static_cast<EventTypeMask_T> (0)) {
+      return _eventTimeIndex.count (iFromTimeStamp, iToTimeStamp);
+    }
+    stdair::Count_T oNbOfEvents = 0;
+    for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+      const stdair::EventType::EN_EventType lEventType =
+        static_cast<stdair::EventType::EN_EventType> (idx);
+      if ((iTypeMask & getStatusBit (lEventType)) != 0) {
+        oNbOfEvents += _eventTimeIndex.count (lEventType, iFromTimeStamp,
+                                              iToTimeStamp);
+      }
+    }
+    return oNbOfEvents;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet EventQueue::
+  extractEvent (const stdair::EventStruct*& oEventStruct_ptr) {
+
+    // Take into account the events added by the producers, if any
+    flushPendingEvents();
+    discardCancelledEvents();
+
+    if (_backend->empty() == true) {  
+      std::ostringstream oStr;
+      oStr << "The event queue '" << describeKey() << "' is empty. "
+	   << "No event can be extracted.";
+      //
+      STDAIR_LOG_ERROR (oStr.str());
+      throw EventQueueException (oStr.str());
+    }
 
     /**
-     * 2. Update the progress statuses held by the EventStruct structure.
-     *
-     * 2.1. Update the progress status specific to the event type (e.g.,
-     *      booking request, optimisation notification).
+     * 1. Remove the first event (sorted by date-time stamps) from the
+     *    backend, which keeps on holding it until it is altered again.
      */
+    const EventSequence_T lSequence = _backend->getTopSequence();
+    const stdair::EventStruct& lEventStruct = _backend->extract();
+    updateRemovalBound (lEventStruct.getEventTimeStamp(), lSequence);
+    if (_isTimeIndexed == true) {
+      _eventTimeIndex.remove (lEventStruct.getEventType(),
+                              lEventStruct.getEventTimeStamp());
+    }
+    oEventStruct_ptr = &lEventStruct;
 
-    // Retrieve the progress status specific to that event type
-    stdair::ProgressStatus lEventTypeProgressStatus = getStatus (lEventType);
+    /**
+     * 2. Update the progress statuses.
+     */
+    return updateProgressStatuses (lEventStruct.getEventType());
+  }
 
-    // Increase the current number of events
+  // //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet EventQueue::
+  updateProgressStatuses (const stdair::EventType::EN_EventType& iEventType) {
+    stdair::ProgressStatusSet oProgressStatusSet (iEventType);
+  
+    // Update the progress status specific to the event type (e.g.,
+    // booking request, optimisation notification)
+    if (isStatusDeclared (iEventType) == false) {
+      std::ostringstream oStr;
+      oStr << "No ProgressStatus structure can be retrieved in the EventQueue '"
+           << display() << "' for the following event type: "
+           << stdair::EventType::getLabel (iEventType) << ".";
+      //
+      STDAIR_LOG_ERROR (oStr.str());
+      throw EventQueueException (oStr.str());
+    }
+    stdair::ProgressStatus& lEventTypeProgressStatus =
+      _progressStatusList[iEventType];
     ++lEventTypeProgressStatus;
 
-    // Store back the progress status
-    setStatus (lEventType, lEventTypeProgressStatus);
+    // Update the (current number part of the) overall progress status,
+    // to account for the event that is being popped out of the event
+    // queue.
+    ++_progressStatus;
+    publishProgressStatuses (getStatusBit (iEventType));
 
-    // Update the progress status of the progress status set, specific to
-    // the event type.
+    // Snapshot of the progress statuses
     oProgressStatusSet.setTypeSpecificStatus (lEventTypeProgressStatus);
-
-    /**
-     * 2.2. Update the overall progress status.
-     */
-    // Update the overall progress status of the progress status set.
     oProgressStatusSet.setOverallStatus (_progressStatus);
 
     //
@@ -433,38 +949,313 @@ namespace SEVMGR {
   }
 
   // //////////////////////////////////////////////////////////////////////
-  bool EventQueue::addEvent (stdair::EventStruct& ioEventStruct) {
-    bool insertionSucceeded =
-      _eventList.insert (stdair::EventListElement_T (ioEventStruct.getEventTimeStamp(),
-						     ioEventStruct)).second;
+  stdair::ProgressStatusSet EventQueue::
+  popEvents (EventStructList_T& ioEventStructList,
+             const stdair::Count_T& iMaxNbOfEvents) {
+    const stdair::LongDuration_T lNoTimeStampLimit =
+      std::numeric_limits<stdair::LongDuration_T>::max();
+    return popEventBatch (ioEventStructList, iMaxNbOfEvents,
+                          lNoTimeStampLimit);
+  }
 
-    /**
-     * If the insertion has not been successful, try repeatedly until
-     * the insertion becomes successful.
-     *
-     * The date-time is counted in milliseconds (1e-3 second). Hence,
-     * one thousand (1e3) of attempts correspond to 1 second.
-     *     
-     * The check on one thousand (1e3) is made in order to avoid
-     * potential infinite loops. In such case, however, an assertion
-     * will fail: it is always better that an assertion fails rather
-     * than entering an infinite loop.
-     */
-    const unsigned int idx = 0;
-    while (insertionSucceeded == false && idx != 1e3) {
-      // Increment the date-time stamp (expressed in milliseconds)
-      ioEventStruct.incrementEventTimeStamp();
+  // //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet EventQueue::
+  popEventsUntil (EventStructList_T& ioEventStructList,
+                  const stdair::DateTime_T& iDateTime) {
+    // Compute the number of milliseconds between the given date-time
+    // and DEFAULT_EVENT_OLDEST_DATETIME
+    const stdair::Duration_T lDuration =
+      iDateTime - stdair::DEFAULT_EVENT_OLDEST_DATETIME;
+    const stdair::LongDuration_T lDateTimeStamp =
+      lDuration.total_milliseconds();
+
+    const stdair::Count_T lNoCountLimit =
+      std::numeric_limits<stdair::Count_T>::max();
+    return popEventBatch (ioEventStructList, lNoCountLimit, lDateTimeStamp);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueue::
+  skipEventsBefore (const stdair::DateTime_T& iDateTime) {
+    return removeEventsBefore (iDateTime, NULL);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueue::
+  popEventsBefore (EventStructList_T& ioEventStructList,
+                   const stdair::DateTime_T& iDateTime) {
+    return removeEventsBefore (iDateTime, &ioEventStructList);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueue::
+  removeEventsBefore (const stdair::DateTime_T& iDateTime,
+                      EventStructList_T* ioEventStructList_ptr) {
+    // Compute the number of milliseconds between the given date-time
+    // and DEFAULT_EVENT_OLDEST_DATETIME
+    const stdair::Duration_T lDuration =
+      iDateTime - stdair::DEFAULT_EVENT_OLDEST_DATETIME;
+    const stdair::LongDuration_T lDateTimeStamp =
+      lDuration.total_milliseconds();
+
+    // Take into account the events added by the producers, if any
+    flushPendingEvents();
+    discardCancelledEvents();
+
+    // When cancelled events are within the range, the events are popped
+    // one by one, so that the cancelled ones be left out
+    const EventOrderingKey_T lBoundKey (lDateTimeStamp, 0);
+    if (_cancelledEventKeySet.empty() == false
+        && *_cancelledEventKeySet.begin() < lBoundKey) {
+      EventStructList_T lEventStructList;
+      EventStructList_T& lPoppedEventList = (ioEventStructList_ptr != NULL)
+        ? *ioEventStructList_ptr : lEventStructList;
+      const EventStructList_T::size_type lInitialSize = lPoppedEventList.size();
+      popEventBatch (lPoppedEventList,
+                     std::numeric_limits<stdair::Count_T>::max(),
+                     lDateTimeStamp - 1);
+      return (lPoppedEventList.size() - lInitialSize);
+    }
+
+    // Remove the range of events, as long as their types have a
+    // progress status
+    EventTypeCountList_T lNbOfEventsList;
+    lNbOfEventsList.fill (0);
+    const stdair::Count_T oNbOfRemovedEvents =
+      _backend->removeBefore (lDateTimeStamp, _progressStatusMask,
+                              ioEventStructList_ptr, lNbOfEventsList);
+
+    // Account for the removed events, once per event type
+    EventTypeMask_T lRemovedTypeMask = 0;
+    for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+      const stdair::Count_T& lNbOfEvents = lNbOfEventsList[idx];
+      if (lNbOfEvents == 0) {
+        continue;
+      }
+      const stdair::EventType::EN_EventType lEventType =
+        static_cast<stdair::EventType::EN_EventType> (idx);
+      stdair::ProgressStatus& lProgressStatus = _progressStatusList[idx];
+      lProgressStatus.setCurrentNb (lProgressStatus.getCurrentNb()
+                                    + lNbOfEvents);
+      lRemovedTypeMask |= getStatusBit (lEventType);
 
-      // Retry to insert into the event queue
-      insertionSucceeded =
-        _eventList.insert (stdair::EventListElement_T (ioEventStruct.getEventTimeStamp(),
-						       ioEventStruct)).second;
+      // The removed events are the earliest ones of their type
+      if (_isTimeIndexed == true) {
+        _eventTimeIndex.removeFirst (lEventType, lNbOfEvents);
+      }
+    }
+    _progressStatus.setCurrentNb (_progressStatus.getCurrentNb()
+                                  + oNbOfRemovedEvents);
+    publishProgressStatuses (lRemovedTypeMask);
+
+    // All the events before the next one (if earlier than the bound)
+    // have been removed
+    if (oNbOfRemovedEvents != 0) {
+      const EventOrderingKey_T lNextKey = (_backend->empty() == false)
+        ? std::min (getTopKey(), lBoundKey) : lBoundKey;
+      if (_removalBoundKey < lNextKey) {
+        _removalBoundKey = lNextKey;
+      }
     }
-    assert (idx != 1e3);
 
-    return insertionSucceeded;
+    // The removal has stopped at an event having no progress status
+    if (_backend->empty() == false
+        && _backend->top().getEventTimeStamp() < lDateTimeStamp) {
+      const stdair::EventType::EN_EventType lEventType =
+        _backend->top().getEventType();
+      assert (isStatusDeclared (lEventType) == false);
+
+      std::ostringstream oStr;
+      oStr << "No ProgressStatus structure can be retrieved in the "
+           << "EventQueue '" << display() << "' for the following event "
+           << "type: " << stdair::EventType::getLabel (lEventType) << ".";
+      //
+      STDAIR_LOG_ERROR (oStr.str());
+      throw EventQueueException (oStr.str());
+    }
+
+    return oNbOfRemovedEvents;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet EventQueue::
+  popEventBatch (EventStructList_T& ioEventStructList,
+                 const stdair::Count_T& iMaxNbOfEvents,
+                 const stdair::LongDuration_T& iMaxDateTimeStamp) {
+
+    // Take into account the events added by the producers, if any
+    flushPendingEvents();
+
+    stdair::EventType::EN_EventType lLastEventType =
+      stdair::EventType::LAST_VALUE;
+    EventTypeMask_T lPoppedTypeMask = 0;
+    stdair::Count_T lNbOfPoppedEvents = 0;
+    while (lNbOfPoppedEvents < iMaxNbOfEvents) {
+      discardCancelledEvents();
+      if (_backend->empty() == true) {
+        break;
+      }
+      const stdair::EventStruct& lNextEventStruct = _backend->top();
+      if (lNextEventStruct.getEventTimeStamp() > iMaxDateTimeStamp) {
+        break;
+      }
+
+      // Check that the event type has a progress status, before the
+      // event be removed from the queue
+      const stdair::EventType::EN_EventType lEventType =
+        lNextEventStruct.getEventType();
+      if (isStatusDeclared (lEventType) == false) {
+        // Publish the progress statuses of the events popped so far
+        publishProgressStatuses (lPoppedTypeMask);
+
+        std::ostringstream oStr;
+        oStr << "No ProgressStatus structure can be retrieved in the "
+             << "EventQueue '" << display() << "' for the following event "
+             << "type: " << stdair::EventType::getLabel (lEventType) << ".";
+        //
+        STDAIR_LOG_ERROR (oStr.str());
+        throw EventQueueException (oStr.str());
+      }
+
+      // Extract the event, and account for it
+      const EventSequence_T lSequence = _backend->getTopSequence();
+      ioEventStructList.push_back (stdair::EventStruct());
+      _backend->pop (ioEventStructList.back());
+      updateRemovalBound (ioEventStructList.back().getEventTimeStamp(),
+                          lSequence);
+      if (_isTimeIndexed == true) {
+        _eventTimeIndex.remove (lEventType,
+                                ioEventStructList.back().getEventTimeStamp());
+      }
+      ++_progressStatusList[lEventType];
+      ++_progressStatus;
+      lPoppedTypeMask |= getStatusBit (lEventType);
+      lLastEventType = lEventType;
+      ++lNbOfPoppedEvents;
+    }
+
+    // Publish the progress statuses once for the whole batch
+    publishProgressStatuses (lPoppedTypeMask);
+
+    // Snapshot of the progress statuses
+    stdair::ProgressStatusSet oProgressStatusSet (lLastEventType);
+    if (lLastEventType != stdair::EventType::LAST_VALUE) {
+      oProgressStatusSet.
+        setTypeSpecificStatus (_progressStatusList[lLastEventType]);
+    }
+    oProgressStatusSet.setOverallStatus (_progressStatus);
+
+    return oProgressStatusSet;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventHandle EventQueue::addEvent (const stdair::EventStruct& iEventStruct) {
+    // In multi-producer mode (or while the insertions are deferred), keep
+    // the event aside, until the simulation thread transfers it into the
+    // backend
+    if (_isMultiProducer == true || _areInsertionsDeferred == true) {
+      std::lock_guard<std::mutex> lGuard (_pendingEventListMutex);
+      if (_pendingEventList.empty() == true) {
+        _firstPendingSequence = _nextSequence;
+      }
+      const EventHandle oEventHandle (iEventStruct.getEventTimeStamp(),
+                                      _nextSequence,
+                                      iEventStruct.getEventType());
+      ++_nextSequence;
+      _pendingEventList.push_back (iEventStruct);
+      _nbOfPendingEvents.fetch_add (1, std::memory_order_release);
+      return oEventHandle;
+    }
+
+    // Delegate the insertion to the backend. The events having the same
+    // date-time stamp are ordered by insertion sequence.
+    const EventSequence_T lSequence = _nextSequence;
+    ++_nextSequence;
+    const bool insertionSucceeded = _backend->insert (iEventStruct, lSequence);
+    if (insertionSucceeded == false) {
+      return EventHandle();
+    }
+    if (_isTimeIndexed == true) {
+      _eventTimeIndex.add (iEventStruct.getEventType(),
+                           iEventStruct.getEventTimeStamp());
+    }
+    return EventHandle (iEventStruct.getEventTimeStamp(), lSequence,
+                        iEventStruct.getEventType());
   }
   
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::addEvents (const EventStructList_T& iEventStructList) {
+    // In multi-producer mode (or while the insertions are deferred), keep
+    // the events aside, until the simulation thread transfers them into
+    // the backend
+    if (_isMultiProducer == true || _areInsertionsDeferred == true) {
+      std::lock_guard<std::mutex> lGuard (_pendingEventListMutex);
+      if (_pendingEventList.empty() == true) {
+        _firstPendingSequence = _nextSequence;
+      }
+      _nextSequence += iEventStructList.size();
+      _pendingEventList.insert (_pendingEventList.end(),
+                                iEventStructList.begin(),
+                                iEventStructList.end());
+      _nbOfPendingEvents.fetch_add (iEventStructList.size(),
+                                    std::memory_order_release);
+      return;
+    }
+
+    // Delegate the (bulk) insertion to the backend
+    _backend->bulkInsert (iEventStructList, _nextSequence);
+    _nextSequence += iEventStructList.size();
+    if (_isTimeIndexed == true) {
+      for (EventStructList_T::const_iterator itEvent = iEventStructList.begin();
+           itEvent != iEventStructList.end(); ++itEvent) {
+        _eventTimeIndex.add (itEvent->getEventType(),
+                             itEvent->getEventTimeStamp());
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::transferEvents (EventStructList_T& ioEventStructList) {
+    // Take into account the events added by the producers, if any
+    flushPendingEvents();
+
+    ioEventStructList.reserve (ioEventStructList.size() + _backend->size()
+                               - _nbOfCancelledEvents);
+    while (_backend->empty() == false) {
+      if (_nbOfCancelledEvents != 0
+          && _cancelledEventKeySet.erase (getTopKey()) != 0) {
+        _backend->extract();
+        continue;
+      }
+      ioEventStructList.push_back (stdair::EventStruct());
+      _backend->pop (ioEventStructList.back());
+    }
+
+    // The events are no longer within the event queue
+    _eventTimeIndex.clear();
+    invalidateEventHandles();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueue::
+  accountForEvents (const stdair::EventType::EN_EventType& iType,
+                    const stdair::Count_T& iNbOfEvents) {
+    if (isStatusDeclared (iType) == false) {
+      std::ostringstream oStr;
+      oStr << "No ProgressStatus structure can be retrieved in the EventQueue '"
+           << display() << "' for the following event type: "
+           << stdair::EventType::getLabel (iType) << ".";
+      //
+      STDAIR_LOG_ERROR (oStr.str());
+      throw EventQueueException (oStr.str());
+    }
+
+    stdair::ProgressStatus& lProgressStatus = _progressStatusList[iType];
+    lProgressStatus.setCurrentNb (lProgressStatus.getCurrentNb() + iNbOfEvents);
+    _progressStatus.setCurrentNb (_progressStatus.getCurrentNb() + iNbOfEvents);
+    publishProgressStatuses (getStatusBit (iType));
+  }
+
   // //////////////////////////////////////////////////////////////////////
   bool EventQueue::hasEventDateTime (const stdair::DateTime_T& iDateTime) {
 
@@ -481,13 +1272,26 @@ namespace SEVMGR {
       lDuration.total_milliseconds();
 
     // Searches the container for an element with iDateTime as key
-    stdair::EventList_T::iterator itEvent =
-      _eventList.find (lDateTimeStamp);
+    flushPendingEvents();
+    hasSearchEventBeenSucessful = _backend->hasTimeStamp (lDateTimeStamp);
 
-    // An iterator to map::end means the specified key has not found in the
-    // container.
-    if (itEvent == _eventList.end()) {
+    // When events with that date-time have been cancelled, check that
+    // not all of them have been
+    EventOrderingKeySet_T::const_iterator itCancelledKey =
+      _cancelledEventKeySet.lower_bound (EventOrderingKey_T (lDateTimeStamp, 0));
+    if (hasSearchEventBeenSucessful == true
+        && itCancelledKey != _cancelledEventKeySet.end()
+        && itCancelledKey->first == lDateTimeStamp) {
+      EventStructPtrList_T lEventList;
+      getSortedEventList (lEventList);
       hasSearchEventBeenSucessful = false;
+      for (EventStructPtrList_T::const_iterator itEvent = lEventList.begin();
+           itEvent != lEventList.end(); ++itEvent) {
+        if ((*itEvent)->getEventTimeStamp() == lDateTimeStamp) {
+          hasSearchEventBeenSucessful = true;
+          break;
+        }
+      }
     }
 
     return hasSearchEventBeenSucessful;
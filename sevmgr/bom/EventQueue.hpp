@@ -5,7 +5,9 @@
 // Import section
 // //////////////////////////////////////////////////////////////////////
 // STL
+#include <atomic>
 #include <iosfwd>
+#include <mutex>
 #include <string>
 // StdAir
 #include <stdair/stdair_basic_types.hpp>
@@ -14,9 +16,12 @@
 #include <stdair/basic/EventType.hpp>
 #include <stdair/bom/BomAbstract.hpp>
 #include <stdair/bom/EventTypes.hpp>
+#include <stdair/bom/EventStruct.hpp>
 // SEvMgr
 #include <sevmgr/bom/EventQueueKey.hpp>
 #include <sevmgr/bom/EventQueueTypes.hpp>
+#include <sevmgr/bom/EventTimeIndex.hpp>
+#include <sevmgr/bom/ProgressStatusMonitor.hpp>
 #include <sevmgr/SEVMGR_Types.hpp>
 
 /// Forward declarations
@@ -27,6 +32,10 @@ namespace stdair {
 
 namespace SEVMGR {
 
+  /// Forward declarations
+  class EventQueueBackend;
+  class EventBrowser;
+
   /**
    * @brief Class holding event structures.
    *
@@ -64,10 +73,15 @@ namespace SEVMGR {
    *  </ul>
    *  <li>Overall status: 16 events out of {expected: 52, actual: 52}</li>
    * </ul>
+   *
+   * The events themselves are held, sorted by date-time stamps, by a
+   * storage backend (see EventQueueBackend), which may be chosen
+   * according to the workload (see EventQueueBackendType).
    */
   class EventQueue : public stdair::BomAbstract {
     template <typename BOM> friend class stdair::FacBom;
     friend class stdair::FacBomManager;
+    friend class FacEventQueue;
 
   public:
     // ////////// Type definitions ////////////
@@ -89,10 +103,31 @@ namespace SEVMGR {
       return _parent;
     } 
 
-    /** Get the list of events. */
-    const stdair::EventList_T& getEventList () const {
-      return _eventList;
-    }
+    /**
+     * Get the list of (pointers on) events, sorted by date-time stamps.
+     *
+     * That method may be consuming (in time and memory) when there are
+     * a lot of events, as the list is built on the fly. Call it only for
+     * display or export purposes.
+     *
+     * \note In multi-producer mode, the events not yet transferred into
+     *       the backend (see setMultiProducer()) are not listed. Neither
+     *       are the cancelled events (see cancelEvent()).
+     */
+    void getSortedEventList (EventStructPtrList_T&) const;
+
+    /**
+     * Fill the given list with (pointers on) the events of the given
+     * type, sorted by date-time stamps. With the sharded backend, only
+     * the events of that type are browsed.
+     *
+     * \see getSortedEventList() for the validity of the pointers.
+     */
+    void getSortedEventList (EventStructPtrList_T&,
+                             const stdair::EventType::EN_EventType&) const;
+
+    /** Get the type of the storage backend (e.g., map, d-ary heap). */
+    EventQueueBackendType::EN_EventQueueBackendType getBackendType () const;
     
     /** Get the map of children holders. */
     const stdair::HolderMap_T& getHolderMap () const {
@@ -135,11 +170,86 @@ namespace SEVMGR {
      *  event type */
     bool hasProgressStatus (const stdair::EventType::EN_EventType&) const;
 
+    /**
+     * Get the monitor of the progress statuses. Contrary to the other
+     * getters, the monitor may be read from any thread, while the event
+     * queue is being altered (e.g., events being popped) by another one.
+     */
+    const ProgressStatusMonitor& getProgressMonitor () const {
+      return _progressMonitor;
+    }
+
+    /** State whether the events may be added from several threads. */
+    bool isMultiProducer () const {
+      return _isMultiProducer;
+    }
+
+    /** State whether the events are indexed by date-time. */
+    bool isTimeIndexed () const {
+      return _isTimeIndexed;
+    }
+
+    /** Get the event types for which a progress status has been declared. */
+    const EventTypeMask_T& getProgressStatusMask () const {
+      return _progressStatusMask;
+    }
+
   public:
     // /////////// Setters ///////////////
+    /**
+     * Set the type of the storage backend (e.g., map, d-ary heap).
+     *
+     * The events already in the queue, if any, are transferred into the
+     * new backend.
+     */
+    void setBackendType (const EventQueueBackendType::EN_EventQueueBackendType&);
+
+    /**
+     * Set whether the events may be added from several threads
+     * (multi-producer, single-consumer mode).
+     *
+     * In that mode, addEvent() and addEvents() may be called from any
+     * thread, while the events are popped by the (single) simulation
+     * thread. The added events are first kept in a pending list, guarded
+     * by a mutex, and transferred into the backend, in one go, by the
+     * simulation thread, right before it pops (or looks for) the next
+     * event. Hence, any event added before a pop is taken into account
+     * by that pop: the events are popped in chronological order, as
+     * long as they are not added after the date-time of the events
+     * already popped (such late events are popped next).
+     *
+     * \note The other methods must be called from the simulation thread.
+     *       The mode must be set before the producers start.
+     */
+    void setMultiProducer (const bool&);
+
+    /**
+     * Set whether the insertions are deferred: while they are, the added
+     * events are kept in the pending list (as in multi-producer mode),
+     * and transferred into the backend right before the next pop (or
+     * extraction). Hence, the event given by extractEvent() stays valid
+     * while events are added, e.g., by the handler of that event. When
+     * the insertions are no longer deferred, the pending events are
+     * transferred into the backend right away.
+     */
+    void setInsertionsDeferred (const bool&);
+
+    /**
+     * Set whether the events are indexed by date-time, for each event
+     * type (see countEvents()).
+     *
+     * While they are, the number of events within any date-time range
+     * is given in logarithmic time, at the expense of a logarithmic
+     * cost for each addition, removal or cancellation of an event. When
+     * the indexing is switched on, the events already in the queue are
+     * indexed right away.
+     */
+    void setTimeIndexed (const bool&);
+
     /** Set/update the progress status. */
     void setStatus (const stdair::ProgressStatus& iProgressStatus) {
       _progressStatus = iProgressStatus;
+      publishProgressStatuses (0);
     }
     /** Set/update the progress status. */
     void setStatus (const stdair::Count_T& iCurrentNbOfEvents,
@@ -148,20 +258,24 @@ namespace SEVMGR {
       _progressStatus.setCurrentNb (iCurrentNbOfEvents);
       _progressStatus.setExpectedNb (iExpectedTotalNbOfEvents);
       _progressStatus.setActualNb (iActualTotalNbOfEvents);
+      publishProgressStatuses (0);
     }
     /** Set/update the progress status. */
     void setStatus (const stdair::Count_T& iCurrentNbOfEvents,
                     const stdair::Count_T& iActualTotalNbOfEvents) {
       _progressStatus.setCurrentNb (iCurrentNbOfEvents);
       _progressStatus.setActualNb (iActualTotalNbOfEvents);
+      publishProgressStatuses (0);
     }
     /** Set the current number of events (for the whole event queue). */
     void setCurrentNbOfEvents (const stdair::Count_T& iCurrentNbOfEvents) {
       _progressStatus.setCurrentNb (iCurrentNbOfEvents);
+      publishProgressStatuses (0);
     }
     /** Set the expected total number of events (for the whole event queue). */
     void setExpectedTotalNbOfEvents (const stdair::Count_T& iExpectedTotalNbOfEvents) {
       _progressStatus.setExpectedNb (iExpectedTotalNbOfEvents);
+      publishProgressStatuses (0);
     }
 
     /**
@@ -248,12 +362,165 @@ namespace SEVMGR {
      */
      stdair::ProgressStatusSet popEvent (stdair::EventStruct&);
 
+    /**
+     * Remove the next coming (in time) event from the event queue, and
+     * give access to it without copying it.
+     *
+     * Contrary to popEvent(), the event structure is neither copied
+     * into a structure of the caller, nor erased: it is kept by the
+     * event queue until the next call altering that latter (adding,
+     * popping or extracting events, or resetting the queue). Hence, the
+     * reference counters of its payload are not altered, and the given
+     * pointer is valid only until that next call. The progress statuses
+     * are updated as with popEvent().
+     *
+     * @param const stdair::EventStruct*& Pointer, set on the extracted
+     *        event structure.
+     * @return stdair::ProgressStatusSet The progress statuses, updated
+     *         to account for the extracted event.
+     */
+    stdair::ProgressStatusSet extractEvent (const stdair::EventStruct*&);
+
+    /**
+     * Give access to the next coming (in time) event, without removing
+     * it from the event queue.
+     *
+     * @return const stdair::EventStruct* Pointer on the next event, or
+     *         NULL when the queue is empty. It is valid only until the
+     *         next call altering the event queue.
+     */
+    const stdair::EventStruct* peekEvent();
+
+    /**
+     * Get the date-time of the next coming (in time) event, without
+     * removing it from the event queue.
+     *
+     * @return stdair::DateTime_T Date-time of the next event, or
+     *         not-a-date-time when the queue is empty.
+     */
+    stdair::DateTime_T getNextEventDateTime();
+
+    /**
+     * Create a browser, browsing lazily the next coming events, in
+     * chronological order, up to (and including) the given date-time.
+     * The events are not removed, and the progress statuses are left
+     * untouched.
+     *
+     * \note The browser is no longer valid once the event queue has
+     *       been altered.
+     *
+     * @param const stdair::DateTime_T& Horizon of the browsing.
+     * @return EventBrowser* Browser, owned by the caller.
+     */
+    EventBrowser* createBrowser (const stdair::DateTime_T&);
+
+    /**
+     * Create a browser of the events, the date-times of which are
+     * within the given range [from, to), in chronological order.
+     *
+     * The events earlier than the range are skipped by a logarithmic
+     * search with the map-based backends, and browsed with the other
+     * ones.
+     *
+     * \note The browser is no longer valid once the event queue has
+     *       been altered.
+     *
+     * @param const stdair::DateTime_T& Start (included) of the range.
+     * @param const stdair::DateTime_T& End (excluded) of the range.
+     * @return EventBrowser* Browser, owned by the caller.
+     */
+    EventBrowser* createBrowser (const stdair::DateTime_T&,
+                                 const stdair::DateTime_T&);
+
+    /**
+     * Create a browser of the events of the given type, the date-times
+     * of which are within the given range [from, to), in chronological
+     * order.
+     */
+    EventBrowser* createBrowser (const stdair::DateTime_T&,
+                                 const stdair::DateTime_T&,
+                                 const stdair::EventType::EN_EventType&);
+
+    /**
+     * Get the number of queued events, the date-times of which are
+     * within the given range [from, to). The cancelled events are not
+     * counted.
+     *
+     * When the events are indexed by date-time (see setTimeIndexed()),
+     * the cost is logarithmic; otherwise, the events of the range are
+     * browsed.
+     */
+    stdair::Count_T countEvents (const stdair::DateTime_T&,
+                                 const stdair::DateTime_T&);
+
+    /**
+     * Get the number of queued events of the given type, the date-times
+     * of which are within the given range [from, to).
+     */
+    stdair::Count_T countEvents (const stdair::DateTime_T&,
+                                 const stdair::DateTime_T&,
+                                 const stdair::EventType::EN_EventType&);
+
+    /**
+     * Pop (at most) the given number of next coming (in time) events,
+     * and remove them from the event queue.
+     *
+     * The popped events are appended, in chronological order, to the
+     * given list. The progress statuses are updated once per event type
+     * for the whole batch, rather than once per event. When the queue
+     * is empty, no event is popped (and no exception is thrown).
+     *
+     * @param EventStructList_T& List to which the popped events are
+     *        appended.
+     * @param const stdair::Count_T& Maximum number of events to be popped.
+     * @return stdair::ProgressStatusSet Snapshot of the progress
+     *         statuses after the batch, i.e., the same as popEvent()
+     *         would have returned for the last popped event. When no
+     *         event has been popped, only the overall status is set.
+     */
+    stdair::ProgressStatusSet popEvents (EventStructList_T&,
+                                         const stdair::Count_T&);
+
+    /**
+     * Pop all the events occurring at, or before, the given date-time,
+     * and remove them from the event queue.
+     *
+     * \see popEvents(EventStructList_T&, const stdair::Count_T&) for
+     *      more details.
+     */
+    stdair::ProgressStatusSet popEventsUntil (EventStructList_T&,
+                                              const stdair::DateTime_T&);
+
+    /**
+     * Remove, without copying them, all the events occurring strictly
+     * before the given date-time, e.g., to seek the simulation forward.
+     *
+     * The events are removed as one range operation by the backends
+     * allowing for it (see EventQueueBackend::removeBefore()), and the
+     * progress statuses are updated once per event type, for the whole
+     * range.
+     *
+     * @return stdair::Count_T Number of removed events.
+     */
+    stdair::Count_T skipEventsBefore (const stdair::DateTime_T&);
+
+    /**
+     * Pop all the events occurring strictly before the given date-time,
+     * and append them, in chronological order, to the given list.
+     *
+     * \see skipEventsBefore() for more details.
+     *
+     * @return stdair::Count_T Number of popped events.
+     */
+    stdair::Count_T popEventsBefore (EventStructList_T&,
+                                     const stdair::DateTime_T&);
+
     /**
      * Add event.
      *
-     * If there already is an event with the same date-time, move the
-     * given event one nanosecond forward, and retry the insertion
-     * until it succeeds.
+     * Whatever the backend, events having the same date-time are kept
+     * in insertion order, i.e., they are ordered by an insertion
+     * sequence number. The date-time of the event is never altered.
      *
      * That method:
      * <ul>
@@ -263,12 +530,112 @@ namespace SEVMGR {
      *     statuses.</li>
      * </ul>
      *
-     * @param stdair::EventStruct& The reference on EventStruct is not
-     *        constant, because the EventStruct object can be altered:
-     *        its date-time stamp can be changed accordingly to the
-     *        location where it has been inserted in the event queue.
+     * In multi-producer mode (see setMultiProducer()), that method may
+     * be called from any thread.
+     *
+     * @return EventHandle Handle on the added event, allowing to cancel
+     *         it, or to reschedule it, later on (see cancelEvent()). The
+     *         handle refers to no event when the insertion has failed.
      */
-    bool addEvent (stdair::EventStruct&);
+    EventHandle addEvent (const stdair::EventStruct&);
+
+    /**
+     * Build an event of the given type, for the given payload (e.g.,
+     * booking request, break point), and add it to the event queue.
+     *
+     * That is a mere convenience wrapper over addEvent(): the event
+     * structure is built on the stack, and then copied into the storage
+     * of the backend (or first into the pending events, in multi-producer
+     * mode).
+     */
+    template <typename PAYLOAD_PTR>
+    EventHandle emplaceEvent (const stdair::EventType::EN_EventType& iEventType,
+                              const PAYLOAD_PTR& iPayload_ptr) {
+      const stdair::EventStruct lEventStruct (iEventType, iPayload_ptr);
+      return addEvent (lEventStruct);
+    }
+
+    /**
+     * Add all the events of the given list (batch), e.g., the first
+     * event of every demand stream at the start of the simulation.
+     *
+     * The events are ordered as if they had been added one by one, in
+     * the list order. However, the backend builds its structure in one
+     * go (see EventQueueBackend::bulkInsert()), rather than event by
+     * event.
+     *
+     * \note As for addEvent(), the progress statuses are not altered
+     *       by the insertion: they are declared, once per event type,
+     *       with addStatus().
+     *
+     * In multi-producer mode (see setMultiProducer()), that method may
+     * be called from any thread.
+     */
+    void addEvents (const EventStructList_T&);
+
+    /**
+     * State whether the event referred to by the given handle is still
+     * within the event queue, i.e., it has been neither removed (popped,
+     * skipped, transferred or reset), nor cancelled.
+     *
+     * \note The events added with a date-time stamp earlier than the
+     *       one of an already removed event (i.e., late events, which
+     *       are popped next) are considered as removed.
+     */
+    bool isEventQueued (const EventHandle&) const;
+
+    /**
+     * Cancel the event referred to by the given handle, e.g., a booking
+     * request for a cancelled flight, so that it is never popped.
+     *
+     * The event is not removed from the backend right away: it is
+     * flagged (tombstone), in logarithmic time, and dropped when it
+     * comes at the front of the queue. Meanwhile, it is neither counted
+     * nor listed. When the cancelled events outnumber the other ones,
+     * the backend is compacted, i.e., re-built without them, right
+     * before the next pop (or look up), so that the memory and time
+     * overhead stay bounded.
+     *
+     * \note The progress statuses are not altered by the cancellation:
+     *       when needed, the actual total number of events of that type
+     *       is to be updated by the caller (see updateStatus()).
+     *
+     * @return bool Whether the event has been cancelled, i.e., whether
+     *         it was still queued (see isEventQueued()).
+     */
+    bool cancelEvent (const EventHandle&);
+
+    /**
+     * Replace the event referred to by the given handle by the given
+     * one, e.g., the same event built for another date-time. The former
+     * event is cancelled (see cancelEvent()), and the latter one is
+     * added, in logarithmic time.
+     *
+     * @return EventHandle Handle on the added event. It refers to no
+     *         event when the former one was no longer queued, in which
+     *         case the given event is not added.
+     */
+    EventHandle rescheduleEvent (const EventHandle&, const stdair::EventStruct&);
+
+    /**
+     * Remove all the events from the event queue, and append them, in
+     * chronological order, to the given list, without altering the
+     * progress statuses (e.g., so that the events be handled
+     * elsewhere, such as in the partitions of a parallel simulation).
+     * The cancelled events are dropped, and the handles on the
+     * transferred events are no longer valid.
+     */
+    void transferEvents (EventStructList_T&);
+
+    /**
+     * Account for the given number of events of the given type, having
+     * been handled outside of the event queue (see transferEvents()):
+     * the progress statuses are updated as if those events had been
+     * popped. A negative number cancels events having been popped, but
+     * not handled (e.g., before they be added again).
+     */
+    void accountForEvents (const stdair::EventType::EN_EventType&,
+                           const stdair::Count_T&);
 
     /**
      * Find the event with the given date time, if such event existed.
@@ -357,9 +724,126 @@ namespace SEVMGR {
     /** Queue size */
     stdair::Count_T getQueueSize () const;
 
+    /**
+     * Number of events of the given type (constant time with the
+     * sharded backend). The events not yet transferred into the backend
+     * (in multi-producer mode) are not counted.
+     */
+    stdair::Count_T getQueueSize (const stdair::EventType::EN_EventType&) const;
+
     /** Is queue empty */
     bool isQueueEmpty () const;
 
+  private:
+    // ////////// Business helpers /////////
+    /**
+     * Update the progress statuses (the one specific to the given event
+     * type, and the overall one), to account for an event of that type
+     * having been removed from the queue.
+     *
+     * @return stdair::ProgressStatusSet Snapshot of the progress statuses.
+     */
+    stdair::ProgressStatusSet
+    updateProgressStatuses (const stdair::EventType::EN_EventType&);
+
+    /**
+     * Pop (at most) the given number of next coming (in time) events,
+     * provided that their date-time stamps do not go beyond the given
+     * one. The events are appended to the given list.
+     */
+    stdair::ProgressStatusSet popEventBatch (EventStructList_T&,
+                                             const stdair::Count_T&,
+                                             const stdair::LongDuration_T&);
+
+    /**
+     * Remove all the events occurring strictly before the given
+     * date-time, appending them to the given list, if any, and account
+     * for them, in aggregate, within the progress statuses.
+     */
+    stdair::Count_T removeEventsBefore (const stdair::DateTime_T&,
+                                        EventStructList_T*);
+
+    /**
+     * Publish the overall progress status, along with the progress
+     * statuses of the event types flagged within the given mask, towards
+     * the monitor.
+     */
+    void publishProgressStatuses (const EventTypeMask_T&);
+
+    /**
+     * Transfer the events added by the producers (in multi-producer
+     * mode), if any, into the backend.
+     */
+    void flushPendingEvents ();
+
+    /**
+     * Drop the cancelled events standing at the front of the backend,
+     * if any, and compact the backend when the cancelled events
+     * outnumber the other ones.
+     */
+    void discardCancelledEvents ();
+
+    /**
+     * Transfer the events into a new backend of the given type, keeping
+     * their insertion sequence numbers, and dropping the cancelled ones.
+     */
+    void rebuildBackend (const EventQueueBackendType::EN_EventQueueBackendType&);
+
+    /**
+     * Make all the handles given so far no longer valid, e.g., when the
+     * event queue is emptied.
+     */
+    void invalidateEventHandles ();
+
+    /** Get the ordering key of the next event of the backend. */
+    EventOrderingKey_T getTopKey () const;
+
+    /**
+     * Get the date-time stamp, i.e., the number of milliseconds since
+     * DEFAULT_EVENT_OLDEST_DATETIME, of the given date-time.
+     */
+    static stdair::LongDuration_T getTimeStamp (const stdair::DateTime_T&);
+
+    /**
+     * Create a browser of the events of the given types, the date-time
+     * stamps of which are within the given range [from, to).
+     */
+    EventBrowser* createBrowser (const stdair::LongDuration_T&,
+                                 const stdair::LongDuration_T&,
+                                 const EventTypeMask_T&);
+
+    /**
+     * Get the number of queued events of the given types, the date-time
+     * stamps of which are within the given range [from, to).
+     */
+    stdair::Count_T countEvents (const stdair::LongDuration_T&,
+                                 const stdair::LongDuration_T&,
+                                 const EventTypeMask_T&);
+
+    /**
+     * Account for the removal of the event having the given ordering
+     * key: the events with a lower key are no longer queued.
+     */
+    void updateRemovalBound (const stdair::LongDuration_T& iTimeStamp,
+                             const EventSequence_T& iSequence) {
+      const EventOrderingKey_T lKey (iTimeStamp, iSequence + 1);
+      if (_removalBoundKey < lKey) {
+        _removalBoundKey = lKey;
+      }
+    }
+
+    /** Get the bit standing for the given event type, within the mask. */
+    static EventTypeMask_T
+    getStatusBit (const stdair::EventType::EN_EventType& iType) {
+      return (static_cast<EventTypeMask_T> (1) << iType);
+    }
+
+    /** State whether a progress status has been declared for that type. */
+    bool isStatusDeclared (const stdair::EventType::EN_EventType& iType) const {
+      return (iType < stdair::EventType::LAST_VALUE
+              && (_progressStatusMask & getStatusBit (iType)) != 0);
+    }
+
     
   protected:
     // ////////// Constructors and destructors /////////
@@ -394,9 +878,9 @@ namespace SEVMGR {
     stdair::HolderMap_T _holderMap;
 
     /**
-     * List of events.
+     * Storage backend, holding the events sorted by date-time stamps.
      */
-    stdair::EventList_T _eventList;
+    EventQueueBackend* _backend;
     
     /**
      * Counters holding the overall progress status.
@@ -406,9 +890,98 @@ namespace SEVMGR {
     /**
      * Counters holding the overall progress status, for each event
      * type (e.g., booking request, optimisation notification,
-     * schedule change, break point).
+     * schedule change, break point), indexed by event type.
+     */
+    stdair::ProgressStatus _progressStatusList[stdair::EventType::LAST_VALUE];
+
+    /**
+     * Event types for which a progress status has been declared (see
+     * addStatus() and updateStatus()).
+     */
+    EventTypeMask_T _progressStatusMask;
+
+    /**
+     * Copy of the progress statuses above, which may be read from any
+     * thread.
+     */
+    ProgressStatusMonitor _progressMonitor;
+
+    /**
+     * Whether the events may be added from several threads.
+     */
+    bool _isMultiProducer;
+
+    /**
+     * Whether the added events are kept in the pending list, until the
+     * next pop (see setInsertionsDeferred()).
+     */
+    bool _areInsertionsDeferred;
+
+    /**
+     * Events added by the producers (in multi-producer mode), not yet
+     * transferred into the backend, along with their number (which may
+     * be read without locking the mutex).
+     */
+    std::mutex _pendingEventListMutex;
+    EventStructList_T _pendingEventList;
+    std::atomic<stdair::Count_T> _nbOfPendingEvents;
+
+    /**
+     * Events being transferred into the backend. It is swapped with the
+     * pending list, so that both keep their capacity.
+     */
+    EventStructList_T _flushedEventList;
+
+    /**
+     * Sequence number to be given to the next added event, and the one
+     * given to the first event of the pending list (the events of that
+     * list have consecutive sequence numbers). Both are guarded by the
+     * mutex of the pending list, when events may be added from several
+     * threads.
+     */
+    EventSequence_T _nextSequence;
+    EventSequence_T _firstPendingSequence;
+
+    /**
+     * Lowest sequence number of the events which may still be queued:
+     * the handles on the events added before the queue was last emptied
+     * (reset or transferred) are no longer valid.
+     */
+    EventSequence_T _firstValidSequence;
+
+    /**
+     * Lowest ordering key of the events which may still be queued: the
+     * events having a lower key have been removed from the queue.
+     */
+    EventOrderingKey_T _removalBoundKey;
+
+    /**
+     * Ordering keys of the cancelled events still held by the backend
+     * (or the pending list), along with the number of the ones held by
+     * the backend, overall and by event type.
+     */
+    EventOrderingKeySet_T _cancelledEventKeySet;
+    stdair::Count_T _nbOfCancelledEvents;
+    EventTypeCountList_T _nbOfCancelledEventsList;
+
+    /**
+     * Number of cancelled events, overall and by event type, still
+     * within the pending list (while the insertions are deferred).
+     */
+    stdair::Count_T _nbOfCancelledPendingEvents;
+    EventTypeCountList_T _nbOfCancelledPendingEventsList;
+
+    /**
+     * Whether the events held by the backend (but the cancelled ones)
+     * are indexed by date-time.
+     */
+    bool _isTimeIndexed;
+
+    /**
+     * Index, by date-time, of the events held by the backend, but the
+     * cancelled ones (in time-indexed mode only).
      */
-    ProgressStatusMap_T _progressStatusMap;
+    EventTimeIndex _eventTimeIndex;
   };
 
 }
@@ -0,0 +1,82 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// StdAir
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/bom/EventQueueBackend.hpp>
+#include <sevmgr/bom/EventQueueCursor.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueBackend::
+  count (const stdair::EventType::EN_EventType& iType) const {
+    EventStructPtrList_T lEventList;
+    getSortedEventListOfType (lEventList, iType, NULL);
+    return lEventList.size();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueueBackend::
+  getSortedEventListOfType (EventStructPtrList_T& ioEventList,
+                            const stdair::EventType::EN_EventType& iType,
+                            EventSequenceList_T* ioSequenceList_ptr) const {
+    // Browse all the events, and keep the ones of the given type
+    EventStructPtrList_T lEventList;
+    EventSequenceList_T lSequenceList;
+    getSortedEventList (lEventList,
+                        (ioSequenceList_ptr != NULL) ? &lSequenceList : NULL);
+    for (EventStructPtrList_T::size_type idx = 0; idx != lEventList.size();
+         ++idx) {
+      const stdair::EventStruct* lEvent_ptr = lEventList[idx];
+      if (lEvent_ptr->getEventType() == iType) {
+        ioEventList.push_back (lEvent_ptr);
+        if (ioSequenceList_ptr != NULL) {
+          ioSequenceList_ptr->push_back (lSequenceList[idx]);
+        }
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueCursor* EventQueueBackend::
+  createCursor (const stdair::LongDuration_T& iFromTimeStamp) const {
+    SortedEventListCursor* oCursor_ptr =
+      new SortedEventListCursor (iFromTimeStamp);
+    assert (oCursor_ptr != NULL);
+    getSortedEventList (oCursor_ptr->getEventList(),
+                        &oCursor_ptr->getSequenceList());
+    return oCursor_ptr;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueBackend::
+  removeBefore (const stdair::LongDuration_T& iDateTimeStamp,
+                const EventTypeMask_T& iTypeMask,
+                EventStructList_T* ioEventStructList_ptr,
+                EventTypeCountList_T& ioNbOfEventsList) {
+    stdair::Count_T oNbOfRemovedEvents = 0;
+    while (empty() == false) {
+      const stdair::EventStruct& lNextEventStruct = top();
+      const stdair::EventType::EN_EventType lEventType =
+        lNextEventStruct.getEventType();
+      if (lNextEventStruct.getEventTimeStamp() >= iDateTimeStamp
+          || (iTypeMask & (static_cast<EventTypeMask_T> (1) << lEventType))
+          == 0) {
+        break;
+      }
+
+      const stdair::EventStruct& lEventStruct = extract();
+      if (ioEventStructList_ptr != NULL) {
+        ioEventStructList_ptr->push_back (lEventStruct);
+      }
+      ++ioNbOfEventsList[lEventType];
+      ++oNbOfRemovedEvents;
+    }
+    return oNbOfRemovedEvents;
+  }
+
+}
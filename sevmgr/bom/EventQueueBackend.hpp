@@ -0,0 +1,190 @@
+#ifndef __SEVMGR_BOM_EVENTQUEUEBACKEND_HPP
+#define __SEVMGR_BOM_EVENTQUEUEBACKEND_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_date_time_types.hpp>
+#include <stdair/basic/EventType.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Types.hpp>
+#include <sevmgr/bom/EventQueueTypes.hpp>
+
+// Forward declarations
+namespace stdair {
+  struct EventStruct;
+}
+
+namespace SEVMGR {
+
+  // Forward declarations
+  class EventQueueCursor;
+
+  /**
+   * @brief Interface of the storage on which an EventQueue object keeps
+   * its events ordered by date-time stamp.
+   *
+   * The EventQueue object delegates to that interface all the
+   * operations on the ordered set of events, while it keeps on
+   * handling the progress statuses itself. Hence, the storage
+   * (e.g., STL map, d-ary heap) can be chosen according to the
+   * workload, without any change in the simulation logic.
+   *
+   * \see FacEventQueueBackend for the creation of the backends.
+   */
+  class EventQueueBackend {
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Destructor. */
+    virtual ~EventQueueBackend() {}
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the type of the backend (e.g., map, d-ary heap). */
+    virtual EventQueueBackendType::EN_EventQueueBackendType getType() const = 0;
+
+    /** Get the number of events held by the backend. */
+    virtual stdair::Count_T size() const = 0;
+
+    /** State whether the backend holds no event. */
+    virtual bool empty() const = 0;
+
+    /**
+     * Get the next coming (in time) event, i.e., the event having the
+     * earliest date-time stamp.
+     *
+     * \note The backend must not be empty.
+     */
+    virtual const stdair::EventStruct& top() const = 0;
+
+    /**
+     * Get the insertion sequence number of the next coming (in time)
+     * event, i.e., of the event given by top().
+     *
+     * \note The backend must not be empty.
+     */
+    virtual EventSequence_T getTopSequence() const = 0;
+
+    /**
+     * State whether there is an event with exactly the given date-time
+     * stamp (expressed in milliseconds).
+     */
+    virtual bool hasTimeStamp (const stdair::LongDuration_T&) const = 0;
+
+    /**
+     * Fill the given list with (pointers on) all the events, sorted by
+     * date-time stamps. When a list of sequence numbers is given, the
+     * insertion sequence number of each event is appended to it, in the
+     * same order.
+     */
+    virtual void getSortedEventList (EventStructPtrList_T&,
+                                     EventSequenceList_T*) const = 0;
+
+    /**
+     * Get the number of events of the given type. By default, all the
+     * events are browsed.
+     */
+    virtual stdair::Count_T
+    count (const stdair::EventType::EN_EventType&) const;
+
+    /**
+     * Fill the given list with (pointers on) the events of the given
+     * type, sorted by date-time stamps, along with their insertion
+     * sequence numbers when a list is given for them. By default, all
+     * the events are browsed, and filtered.
+     */
+    virtual void
+    getSortedEventListOfType (EventStructPtrList_T&,
+                              const stdair::EventType::EN_EventType&,
+                              EventSequenceList_T*) const;
+
+    /**
+     * Create a cursor browsing the events in chronological order,
+     * without removing them, from the first event not earlier than the
+     * given date-time stamp (expressed in milliseconds). By default,
+     * the cursor browses a sorted list of all the events, built
+     * upfront: the backends override that method, so that the events
+     * are produced lazily.
+     *
+     * \note The cursor is owned by the caller, and is no longer valid
+     *       once the backend has been altered.
+     */
+    virtual EventQueueCursor*
+    createCursor (const stdair::LongDuration_T&) const;
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Insert the given event, with the given insertion sequence number.
+     *
+     * The events are ordered by (date-time stamp, insertion sequence
+     * number): events having the same date-time stamp come out in the
+     * order of their sequence numbers, and their date-time stamp is
+     * never altered. The sequence numbers are given by the caller
+     * (e.g., the event queue), and must be unique.
+     *
+     * @return bool Whether the insertion succeeded.
+     */
+    virtual bool insert (const stdair::EventStruct&,
+                         const EventSequence_T&) = 0;
+
+    /**
+     * Insert all the events of the given list, as if they were inserted
+     * one by one, in the list order, with consecutive sequence numbers
+     * starting at the given one. The backend may however build its
+     * structure in a single pass, rather than event by event.
+     */
+    virtual void bulkInsert (const EventStructList_T&,
+                             const EventSequence_T&) = 0;
+
+    /**
+     * Copy the next coming (in time) event into the given structure,
+     * and remove it from the backend.
+     *
+     * \note The backend must not be empty.
+     */
+    virtual void pop (stdair::EventStruct&) = 0;
+
+    /**
+     * Remove the next coming (in time) event from the backend, and give
+     * access to it, without copying it (hence, without altering the
+     * reference counters of its payload).
+     *
+     * The event structure remains held by the backend until the next
+     * call altering that latter (insertion, removal or clearing): the
+     * returned reference is no longer valid past that call.
+     *
+     * \note The backend must not be empty.
+     */
+    virtual const stdair::EventStruct& extract() = 0;
+
+    /**
+     * Remove, as one range operation when the storage allows for it,
+     * all the events having a date-time stamp strictly earlier than the
+     * given one (expressed in milliseconds). The removal stops before
+     * the first event the type of which is not within the given mask.
+     *
+     * By default, the events are extracted one by one.
+     *
+     * @param const stdair::LongDuration_T& Date-time stamp, before which
+     *        the events are removed.
+     * @param const EventTypeMask_T& Event types which may be removed.
+     * @param EventStructList_T* List to which (copies of) the removed
+     *        events are appended, in chronological order, if any.
+     * @param EventTypeCountList_T& Numbers of events, by type, to which
+     *        the removed events are added.
+     * @return stdair::Count_T Number of removed events.
+     */
+    virtual stdair::Count_T removeBefore (const stdair::LongDuration_T&,
+                                          const EventTypeMask_T&,
+                                          EventStructList_T*,
+                                          EventTypeCountList_T&);
+
+    /** Remove all the events. */
+    virtual void clear() = 0;
+  };
+
+}
+#endif // __SEVMGR_BOM_EVENTQUEUEBACKEND_HPP
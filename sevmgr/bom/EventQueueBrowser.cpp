@@ -0,0 +1,73 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// StdAir
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/bom/EventQueueCursor.hpp>
+#include <sevmgr/bom/EventQueueBrowser.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueBrowser::
+  EventQueueBrowser (EventQueueCursor* ioCursor_ptr,
+                     const EventOrderingKeySet_T& iCancelledEventKeySet,
+                     const stdair::LongDuration_T& iToTimeStamp,
+                     const EventTypeMask_T& iTypeMask)
+    : _cursor (ioCursor_ptr), _cancelledEventKeySet (iCancelledEventKeySet),
+      _toTimeStamp (iToTimeStamp), _typeMask (iTypeMask),
+      _isExhausted (false) {
+    assert (_cursor != NULL);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueBrowser::
+  EventQueueBrowser (const EventQueueBrowser& iBrowser)
+    : _cursor (NULL),
+      _cancelledEventKeySet (iBrowser._cancelledEventKeySet),
+      _toTimeStamp (iBrowser._toTimeStamp), _typeMask (iBrowser._typeMask),
+      _isExhausted (true) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueBrowser::~EventQueueBrowser() {
+    delete _cursor; _cursor = NULL;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct* EventQueueBrowser::next() {
+    if (_isExhausted == true) {
+      return NULL;
+    }
+
+    EventSequence_T lSequence = 0;
+    const stdair::EventStruct* oEventStruct_ptr = _cursor->next (lSequence);
+    while (oEventStruct_ptr != NULL) {
+      // Stop at the upper date-time stamp
+      if (oEventStruct_ptr->getEventTimeStamp() >= _toTimeStamp) {
+        break;
+      }
+
+      // Skip the events of the other types, and the cancelled ones
+      const EventTypeMask_T lEventTypeBit =
+        static_cast<EventTypeMask_T> (1) << oEventStruct_ptr->getEventType();
+      if ((_typeMask & lEventTypeBit) != 0
+          && (_cancelledEventKeySet.empty() == true
+              || _cancelledEventKeySet.
+              find (EventOrderingKey_T (oEventStruct_ptr->getEventTimeStamp(),
+                                        lSequence))
+              == _cancelledEventKeySet.end())) {
+        return oEventStruct_ptr;
+      }
+      oEventStruct_ptr = _cursor->next (lSequence);
+    }
+
+    _isExhausted = true;
+    return NULL;
+  }
+
+}
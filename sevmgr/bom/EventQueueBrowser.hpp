@@ -0,0 +1,84 @@
+#ifndef __SEVMGR_BOM_EVENTQUEUEBROWSER_HPP
+#define __SEVMGR_BOM_EVENTQUEUEBROWSER_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_BrowserTypes.hpp>
+#include <sevmgr/bom/EventQueueTypes.hpp>
+
+namespace SEVMGR {
+
+  // Forward declarations
+  class EventQueueCursor;
+
+  /**
+   * @brief Browser of an event queue, up to a date-time stamp.
+   *
+   * The events are given by a cursor on the backend of the event queue;
+   * the ones which have been cancelled (but not removed from the
+   * backend yet), and the ones the types of which are not browsed, are
+   * skipped.
+   */
+  class EventQueueBrowser : public EventBrowser {
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     *
+     * @param EventQueueCursor* Cursor on the backend, owned (and deleted)
+     *        by the browser.
+     * @param const EventOrderingKeySet_T& Ordering keys of the cancelled
+     *        events, still held by the backend.
+     * @param const stdair::LongDuration_T& Date-time stamp from which
+     *        (included) the events are no longer browsed.
+     * @param const EventTypeMask_T& Types of the browsed events.
+     */
+    EventQueueBrowser (EventQueueCursor*, const EventOrderingKeySet_T&,
+                       const stdair::LongDuration_T&, const EventTypeMask_T&);
+    /** Destructor. */
+    ~EventQueueBrowser();
+
+  private:
+    /** Copy constructor (not to be used). */
+    EventQueueBrowser (const EventQueueBrowser&);
+
+  public:
+    // ////////// Business methods /////////
+    /** Move on to the next coming event, up to the horizon. */
+    const stdair::EventStruct* next();
+
+  private:
+    // ////////// Attributes /////////
+    /**
+     * Cursor on the backend of the event queue.
+     */
+    EventQueueCursor* _cursor;
+
+    /**
+     * Ordering keys of the cancelled events, to be skipped.
+     */
+    const EventOrderingKeySet_T& _cancelledEventKeySet;
+
+    /**
+     * Date-time stamp (in milliseconds) from which the events are no
+     * longer browsed.
+     */
+    const stdair::LongDuration_T _toTimeStamp;
+
+    /**
+     * Types of the browsed events.
+     */
+    const EventTypeMask_T _typeMask;
+
+    /**
+     * Whether the horizon, or the end of the queue, has been reached.
+     */
+    bool _isExhausted;
+  };
+
+}
+#endif // __SEVMGR_BOM_EVENTQUEUEBROWSER_HPP
@@ -0,0 +1,116 @@
+#ifndef __SEVMGR_BOM_EVENTQUEUECURSOR_HPP
+#define __SEVMGR_BOM_EVENTQUEUECURSOR_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Types.hpp>
+#include <sevmgr/bom/EventQueueTypes.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Interface of the cursors browsing the events of a backend,
+   * in chronological order, without removing them.
+   *
+   * A cursor is created by the backend (see
+   * EventQueueBackend::createCursor()), and the events are produced
+   * lazily: browsing the next k events costs (roughly) O(k), whatever
+   * the number of events held by the backend.
+   *
+   * \note A cursor refers to the inner structure of its backend: it is
+   *       no longer valid once the backend has been altered (insertion,
+   *       removal or clearing).
+   */
+  class EventQueueCursor {
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Destructor. */
+    virtual ~EventQueueCursor() {}
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Move on to the next event, in (date-time stamp, insertion
+     * sequence number) order.
+     *
+     * @param EventSequence_T& Insertion sequence number of the event.
+     * @return const stdair::EventStruct* Next event, or NULL once all
+     *         the events have been browsed.
+     */
+    virtual const stdair::EventStruct* next (EventSequence_T&) = 0;
+  };
+
+  /**
+   * @brief Cursor browsing a list of events, already sorted in
+   * chronological order (e.g., as given by
+   * EventQueueBackend::getSortedEventList()). The events earlier than
+   * a given date-time stamp are skipped.
+   */
+  class SortedEventListCursor : public EventQueueCursor {
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor. The cursor is positioned before the first event.
+     *
+     * @param const stdair::LongDuration_T& Date-time stamp, before which
+     *        the events are skipped.
+     */
+    explicit SortedEventListCursor (const stdair::LongDuration_T& iFromTimeStamp)
+      : _fromTimeStamp (iFromTimeStamp), _nextIndex (0) {}
+
+    /** Destructor. */
+    ~SortedEventListCursor() {}
+
+  private:
+    /** Copy constructor (not to be used). */
+    SortedEventListCursor (const SortedEventListCursor&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the list of events to be browsed. */
+    EventStructPtrList_T& getEventList() {
+      return _eventList;
+    }
+
+    /** Get the list of the insertion sequence numbers of the events. */
+    EventSequenceList_T& getSequenceList() {
+      return _sequenceList;
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /** Move on to the next event of the list. */
+    const stdair::EventStruct* next (EventSequence_T& oSequence) {
+      while (_nextIndex != _eventList.size()
+             && _eventList[_nextIndex]->getEventTimeStamp() < _fromTimeStamp) {
+        ++_nextIndex;
+      }
+      if (_nextIndex == _eventList.size()) {
+        return NULL;
+      }
+      oSequence = _sequenceList[_nextIndex];
+      return _eventList[_nextIndex++];
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /** List of (pointers on) the events, sorted by date-time. */
+    EventStructPtrList_T _eventList;
+
+    /** Insertion sequence numbers of the events, in the same order. */
+    EventSequenceList_T _sequenceList;
+
+    /** Date-time stamp, before which the events are skipped. */
+    const stdair::LongDuration_T _fromTimeStamp;
+
+    /** Index of the next event to be browsed. */
+    EventStructPtrList_T::size_type _nextIndex;
+  };
+
+}
+#endif // __SEVMGR_BOM_EVENTQUEUECURSOR_HPP
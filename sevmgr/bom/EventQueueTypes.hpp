@@ -6,10 +6,26 @@
 // Import section
 // //////////////////////////////////////////////////////////////////////
 // STL
+#include <array>
 #include <map>
 #include <list>
+#include <set>
+#include <utility>
+#include <vector>
+// Boost
+#include <boost/cstdint.hpp>
 // StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_date_time_types.hpp>
+#include <stdair/basic/EventType.hpp>
 #include <stdair/bom/key_types.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Types.hpp>
+
+// Forward declarations
+namespace stdair {
+  struct EventStruct;
+}
 
 namespace SEVMGR {
 
@@ -21,6 +37,51 @@ namespace SEVMGR {
 
   /** Define the EventQueue map. */
   typedef std::map<const stdair::MapKey_T, EventQueue*> EventQueueMap_T;
+
+  /**
+   * Define a list of (pointers on) event structures, sorted by
+   * date-time stamps. The pointed structures are held by the event
+   * queue, and remain valid only as long as that latter is not altered.
+   */
+  typedef std::vector<const stdair::EventStruct*> EventStructPtrList_T;
+
+  /**
+   * Define a list of insertion sequence numbers, e.g., the ones of a
+   * list of (pointers on) event structures.
+   */
+  typedef std::vector<EventSequence_T> EventSequenceList_T;
+
+  /**
+   * Define the ordering key of an event within the event queue, i.e.,
+   * (date-time stamp, insertion sequence number).
+   */
+  typedef std::pair<stdair::LongDuration_T,
+                    EventSequence_T> EventOrderingKey_T;
+
+  /**
+   * Define a set of ordering keys, e.g., the ones of the cancelled
+   * events still held by the backend of an event queue.
+   */
+  typedef std::set<EventOrderingKey_T> EventOrderingKeySet_T;
+
+  /**
+   * Define the index of an event structure within the payload arena of
+   * its event type (see EventPayloadStore).
+   */
+  typedef boost::uint32_t EventPayloadIndex_T;
+
+  /**
+   * Define a set of event types, as a bitmask (the bit of rank i
+   * standing for the event type of value i).
+   */
+  typedef boost::uint32_t EventTypeMask_T;
+
+  /**
+   * Define a number of events for each event type, indexed by event
+   * type.
+   */
+  typedef std::array<stdair::Count_T,
+                     stdair::EventType::LAST_VALUE> EventTypeCountList_T;
   
 }
 #endif // __SEVMGR_BOM_EVENTQUEUETYPES_HPP
@@ -0,0 +1,81 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// SEvMgr
+#include <sevmgr/bom/EventRingBuffer.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  /** Smallest power of two greater than, or equal to, the given size. */
+  static std::size_t getRingCapacity (const std::size_t& iCapacity) {
+    std::size_t oCapacity = 1;
+    while (oCapacity < iCapacity) {
+      oCapacity <<= 1;
+    }
+    return oCapacity;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventRingBuffer::EventRingBuffer (const std::size_t& iCapacity)
+    : _slotList (getRingCapacity (iCapacity)),
+      _indexMask (getRingCapacity (iCapacity) - 1),
+      _head (0), _consumerTail (0), _tail (0), _producerHead (0) {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventRingBuffer::EventRingBuffer (const EventRingBuffer& iBuffer)
+    : _indexMask (0), _head (0), _consumerTail (0), _tail (0),
+      _producerHead (0) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventRingBuffer::~EventRingBuffer() {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool EventRingBuffer::push (const stdair::EventStruct& iEventStruct) {
+    const std::size_t lTail = _tail.load (std::memory_order_relaxed);
+
+    // Read the index of the consumer only when the buffer looks full
+    if (lTail - _producerHead == _slotList.size()) {
+      _producerHead = _head.load (std::memory_order_acquire);
+      if (lTail - _producerHead == _slotList.size()) {
+        return false;
+      }
+    }
+
+    // Fill the slot, then publish it to the consumer
+    _slotList[lTail & _indexMask] = iEventStruct;
+    _tail.store (lTail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  std::size_t EventRingBuffer::popAll (EventStructList_T& ioEventStructList) {
+    const std::size_t lHead = _head.load (std::memory_order_relaxed);
+
+    // Read the index of the producer only when the buffer looks empty
+    if (_consumerTail == lHead) {
+      _consumerTail = _tail.load (std::memory_order_acquire);
+      if (_consumerTail == lHead) {
+        return 0;
+      }
+    }
+
+    // Copy the events out, and release their payloads from the slots
+    for (std::size_t idx = lHead; idx != _consumerTail; ++idx) {
+      stdair::EventStruct& lSlot = _slotList[idx & _indexMask];
+      ioEventStructList.push_back (lSlot);
+      lSlot = stdair::EventStruct();
+    }
+
+    // Give the slots back to the producer
+    _head.store (_consumerTail, std::memory_order_release);
+    return (_consumerTail - lHead);
+  }
+
+}
@@ -0,0 +1,93 @@
+#ifndef __SEVMGR_BOM_EVENTRINGBUFFER_HPP
+#define __SEVMGR_BOM_EVENTRINGBUFFER_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <atomic>
+#include <cstddef>
+#include <vector>
+// StdAir
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Types.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Bounded, lock-free, single-producer single-consumer buffer
+   * of events.
+   *
+   * The events are held by a ring of slots, the capacity of which is a
+   * power of two. The producer only writes the tail index, and the
+   * consumer only writes the head index: each one reads the index of
+   * the other with acquire semantics, and keeps a cached copy of it, so
+   * that the cache line of the other side is only read when the buffer
+   * looks full (resp. empty).
+   */
+  class EventRingBuffer {
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     *
+     * @param const std::size_t& Minimal capacity, rounded up to the next
+     *        power of two.
+     */
+    EventRingBuffer (const std::size_t& iCapacity);
+    /** Destructor. */
+    ~EventRingBuffer();
+
+  private:
+    /** Copy constructor (not to be used). */
+    EventRingBuffer (const EventRingBuffer&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the capacity of the buffer. */
+    std::size_t getCapacity() const {
+      return _slotList.size();
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Add (a copy of) the given event, unless the buffer is full. That
+     * method must only be called by the producer.
+     *
+     * @return bool Whether the event has been added.
+     */
+    bool push (const stdair::EventStruct&);
+
+    /**
+     * Move all the events of the buffer to the end of the given list.
+     * That method must only be called by the consumer.
+     *
+     * @return std::size_t Number of moved events.
+     */
+    std::size_t popAll (EventStructList_T&);
+
+  private:
+    // ////////// Attributes /////////
+    /** Slots of the ring. */
+    std::vector<stdair::EventStruct> _slotList;
+
+    /** Capacity minus one, masking the indices. */
+    const std::size_t _indexMask;
+
+    /** Index of the next slot to be read, written by the consumer. */
+    alignas(64) std::atomic<std::size_t> _head;
+
+    /** Copy of the tail index, as last seen by the consumer. */
+    std::size_t _consumerTail;
+
+    /** Index of the next slot to be written, written by the producer. */
+    alignas(64) std::atomic<std::size_t> _tail;
+
+    /** Copy of the head index, as last seen by the producer. */
+    std::size_t _producerHead;
+  };
+
+}
+#endif // __SEVMGR_BOM_EVENTRINGBUFFER_HPP
@@ -0,0 +1,304 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <limits>
+// SEvMgr
+#include <sevmgr/bom/EventTimeIndex.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  const EventTimeIndex::NodeIndex_T EventTimeIndex::NIL_NODE =
+    std::numeric_limits<EventTimeIndex::NodeIndex_T>::max();
+
+  // //////////////////////////////////////////////////////////////////////
+  EventTimeIndex::EventTimeIndex() : _randomState (2463534242U) {
+    for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+      _rootList[idx] = NIL_NODE;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventTimeIndex::EventTimeIndex (const EventTimeIndex& iIndex)
+    : _randomState (iIndex._randomState) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventTimeIndex::~EventTimeIndex() {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventTimeIndex::size() const {
+    stdair::Count_T oNbOfEvents = 0;
+    for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+      oNbOfEvents += getNbOfSubtreeEvents (_rootList[idx]);
+    }
+    return oNbOfEvents;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventTimeIndex::
+  count (const stdair::EventType::EN_EventType& iType,
+         const stdair::LongDuration_T& iFromTimeStamp,
+         const stdair::LongDuration_T& iToTimeStamp) const {
+    assert (iType < stdair::EventType::LAST_VALUE);
+    if (iFromTimeStamp >= iToTimeStamp) {
+      return 0;
+    }
+    const NodeIndex_T& lRoot = _rootList[iType];
+    return (countBefore (lRoot, iToTimeStamp)
+            - countBefore (lRoot, iFromTimeStamp));
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventTimeIndex::
+  count (const stdair::LongDuration_T& iFromTimeStamp,
+         const stdair::LongDuration_T& iToTimeStamp) const {
+    stdair::Count_T oNbOfEvents = 0;
+    for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+      oNbOfEvents +=
+        count (static_cast<stdair::EventType::EN_EventType> (idx),
+               iFromTimeStamp, iToTimeStamp);
+    }
+    return oNbOfEvents;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventTimeIndex::
+  countBefore (const NodeIndex_T& iRoot,
+               const stdair::LongDuration_T& iTimeStamp) const {
+    // Walk down the tree, adding up the events of the left sub-trees
+    // (and of their parents) left behind
+    stdair::Count_T oNbOfEvents = 0;
+    NodeIndex_T lNode = iRoot;
+    while (lNode != NIL_NODE) {
+      const Node& lCurrentNode = _nodeList[lNode];
+      if (iTimeStamp <= lCurrentNode._timeStamp) {
+        lNode = lCurrentNode._left;
+      } else {
+        oNbOfEvents += getNbOfSubtreeEvents (lCurrentNode._left)
+          + lCurrentNode._nbOfEvents;
+        lNode = lCurrentNode._right;
+      }
+    }
+    return oNbOfEvents;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventTimeIndex::add (const stdair::EventType::EN_EventType& iType,
+                            const stdair::LongDuration_T& iTimeStamp) {
+    assert (iType < stdair::EventType::LAST_VALUE);
+    _rootList[iType] = insert (_rootList[iType], iTimeStamp);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventTimeIndex::remove (const stdair::EventType::EN_EventType& iType,
+                               const stdair::LongDuration_T& iTimeStamp) {
+    assert (iType < stdair::EventType::LAST_VALUE);
+    _rootList[iType] = erase (_rootList[iType], iTimeStamp);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventTimeIndex::
+  removeFirst (const stdair::EventType::EN_EventType& iType,
+               const stdair::Count_T& iNbOfEvents) {
+    assert (iType < stdair::EventType::LAST_VALUE);
+    assert (iNbOfEvents <= getNbOfSubtreeEvents (_rootList[iType]));
+    _rootList[iType] = eraseFirst (_rootList[iType], iNbOfEvents);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventTimeIndex::clear() {
+    _nodeList.clear();
+    _freeNodeList.clear();
+    for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+      _rootList[idx] = NIL_NODE;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventTimeIndex::updateNbOfSubtreeEvents (const NodeIndex_T& iNode) {
+    Node& lNode = _nodeList[iNode];
+    lNode._nbOfSubtreeEvents = getNbOfSubtreeEvents (lNode._left)
+      + lNode._nbOfEvents + getNbOfSubtreeEvents (lNode._right);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventTimeIndex::NodeIndex_T EventTimeIndex::
+  rotateLeft (NodeIndex_T iNode) {
+    const NodeIndex_T oRoot = _nodeList[iNode]._right;
+    _nodeList[iNode]._right = _nodeList[oRoot]._left;
+    _nodeList[oRoot]._left = iNode;
+    updateNbOfSubtreeEvents (iNode);
+    updateNbOfSubtreeEvents (oRoot);
+    return oRoot;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventTimeIndex::NodeIndex_T EventTimeIndex::
+  rotateRight (NodeIndex_T iNode) {
+    const NodeIndex_T oRoot = _nodeList[iNode]._left;
+    _nodeList[iNode]._left = _nodeList[oRoot]._right;
+    _nodeList[oRoot]._right = iNode;
+    updateNbOfSubtreeEvents (iNode);
+    updateNbOfSubtreeEvents (oRoot);
+    return oRoot;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventTimeIndex::NodeIndex_T EventTimeIndex::
+  insert (NodeIndex_T iNode, const stdair::LongDuration_T& iTimeStamp) {
+    if (iNode == NIL_NODE) {
+      return createNode (iTimeStamp);
+    }
+
+    // The nodes may be moved by the creation of a new one: they are
+    // referred to by index only, across the recursive calls
+    ++_nodeList[iNode]._nbOfSubtreeEvents;
+    const stdair::LongDuration_T lNodeTimeStamp = _nodeList[iNode]._timeStamp;
+    if (iTimeStamp == lNodeTimeStamp) {
+      ++_nodeList[iNode]._nbOfEvents;
+
+    } else if (iTimeStamp < lNodeTimeStamp) {
+      const NodeIndex_T lLeft = insert (_nodeList[iNode]._left, iTimeStamp);
+      _nodeList[iNode]._left = lLeft;
+      if (getPriority (lLeft) > _nodeList[iNode]._priority) {
+        return rotateRight (iNode);
+      }
+
+    } else {
+      const NodeIndex_T lRight = insert (_nodeList[iNode]._right, iTimeStamp);
+      _nodeList[iNode]._right = lRight;
+      if (getPriority (lRight) > _nodeList[iNode]._priority) {
+        return rotateLeft (iNode);
+      }
+    }
+    return iNode;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventTimeIndex::NodeIndex_T EventTimeIndex::
+  erase (NodeIndex_T iNode, const stdair::LongDuration_T& iTimeStamp) {
+    assert (iNode != NIL_NODE);
+
+    Node& lNode = _nodeList[iNode];
+    --lNode._nbOfSubtreeEvents;
+    if (iTimeStamp < lNode._timeStamp) {
+      lNode._left = erase (lNode._left, iTimeStamp);
+
+    } else if (lNode._timeStamp < iTimeStamp) {
+      lNode._right = erase (lNode._right, iTimeStamp);
+
+    } else {
+      --lNode._nbOfEvents;
+      if (lNode._nbOfEvents == 0) {
+        // The node is replaced by the merge of its sub-trees
+        const NodeIndex_T oRoot = merge (lNode._left, lNode._right);
+        releaseNode (iNode);
+        return oRoot;
+      }
+    }
+    return iNode;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventTimeIndex::NodeIndex_T EventTimeIndex::
+  eraseFirst (NodeIndex_T iNode, stdair::Count_T iNbOfEvents) {
+    if (iNbOfEvents == 0) {
+      return iNode;
+    }
+    assert (iNode != NIL_NODE);
+
+    // The whole sub-tree goes
+    Node& lNode = _nodeList[iNode];
+    if (iNbOfEvents == lNode._nbOfSubtreeEvents) {
+      releaseSubtree (iNode);
+      return NIL_NODE;
+    }
+
+    // Only (a part of) the left sub-tree goes
+    const stdair::Count_T lNbOfLeftEvents = getNbOfSubtreeEvents (lNode._left);
+    if (iNbOfEvents <= lNbOfLeftEvents) {
+      lNode._left = eraseFirst (lNode._left, iNbOfEvents);
+      lNode._nbOfSubtreeEvents -= iNbOfEvents;
+      return iNode;
+    }
+
+    // The left sub-tree goes, along with (a part of) the node itself
+    releaseSubtree (lNode._left);
+    lNode._left = NIL_NODE;
+    iNbOfEvents -= lNbOfLeftEvents;
+    if (iNbOfEvents < lNode._nbOfEvents) {
+      lNode._nbOfEvents -= iNbOfEvents;
+      updateNbOfSubtreeEvents (iNode);
+      return iNode;
+    }
+
+    // And so does the node, and (a part of) the right sub-tree
+    iNbOfEvents -= lNode._nbOfEvents;
+    const NodeIndex_T lRight = lNode._right;
+    releaseNode (iNode);
+    return eraseFirst (lRight, iNbOfEvents);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventTimeIndex::NodeIndex_T EventTimeIndex::
+  merge (NodeIndex_T iLeft, NodeIndex_T iRight) {
+    if (iLeft == NIL_NODE) {
+      return iRight;
+    }
+    if (iRight == NIL_NODE) {
+      return iLeft;
+    }
+
+    // The node having the highest priority becomes the root
+    if (_nodeList[iLeft]._priority > _nodeList[iRight]._priority) {
+      _nodeList[iLeft]._right = merge (_nodeList[iLeft]._right, iRight);
+      updateNbOfSubtreeEvents (iLeft);
+      return iLeft;
+    }
+    _nodeList[iRight]._left = merge (iLeft, _nodeList[iRight]._left);
+    updateNbOfSubtreeEvents (iRight);
+    return iRight;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventTimeIndex::NodeIndex_T EventTimeIndex::
+  createNode (const stdair::LongDuration_T& iTimeStamp) {
+    // Draw the (pseudo-random) priority of the node
+    _randomState ^= _randomState << 13;
+    _randomState ^= _randomState >> 17;
+    _randomState ^= _randomState << 5;
+
+    // The lowest priority stands for no node
+    const Node lNode = { iTimeStamp, 1, 1, _randomState | 1U,
+                         NIL_NODE, NIL_NODE };
+    if (_freeNodeList.empty() == false) {
+      const NodeIndex_T oNode = _freeNodeList.back();
+      _freeNodeList.pop_back();
+      _nodeList[oNode] = lNode;
+      return oNode;
+    }
+    _nodeList.push_back (lNode);
+    return (_nodeList.size() - 1);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventTimeIndex::releaseNode (NodeIndex_T iNode) {
+    _freeNodeList.push_back (iNode);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventTimeIndex::releaseSubtree (NodeIndex_T iNode) {
+    if (iNode == NIL_NODE) {
+      return;
+    }
+    releaseSubtree (_nodeList[iNode]._left);
+    releaseSubtree (_nodeList[iNode]._right);
+    releaseNode (iNode);
+  }
+
+}
@@ -0,0 +1,193 @@
+#ifndef __SEVMGR_BOM_EVENTTIMEINDEX_HPP
+#define __SEVMGR_BOM_EVENTTIMEINDEX_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <vector>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_date_time_types.hpp>
+#include <stdair/basic/EventType.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Order-statistics index of the events by date-time stamp, for
+   * each event type.
+   *
+   * For each event type, the distinct date-time stamps are kept in a
+   * randomised balanced search tree (treap), each node holding the
+   * number of events at its date-time stamp, along with the number of
+   * events of its whole sub-tree. Hence, the number of events within
+   * any range of date-time stamps is given in logarithmic time, as are
+   * the additions and removals of events.
+   *
+   * The nodes of all the trees are drawn from a single array, the
+   * released ones being recycled.
+   */
+  class EventTimeIndex {
+  public:
+    // ////////// Type definitions ////////////
+    /** Index of a node within the array of nodes. */
+    typedef unsigned int NodeIndex_T;
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    EventTimeIndex();
+    /** Destructor. */
+    ~EventTimeIndex();
+
+  private:
+    /** Copy constructor (not to be used). */
+    EventTimeIndex (const EventTimeIndex&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the number of indexed events, whatever their types. */
+    stdair::Count_T size() const;
+
+    /**
+     * Get the number of indexed events of the given type, the date-time
+     * stamps of which are within the given range [from, to).
+     */
+    stdair::Count_T count (const stdair::EventType::EN_EventType&,
+                           const stdair::LongDuration_T&,
+                           const stdair::LongDuration_T&) const;
+
+    /**
+     * Get the number of indexed events, whatever their types, the
+     * date-time stamps of which are within the given range [from, to).
+     */
+    stdair::Count_T count (const stdair::LongDuration_T&,
+                           const stdair::LongDuration_T&) const;
+
+  public:
+    // ////////// Business methods /////////
+    /** Index an event of the given type, at the given date-time stamp. */
+    void add (const stdair::EventType::EN_EventType&,
+              const stdair::LongDuration_T&);
+
+    /**
+     * Remove (the index of) an event of the given type, at the given
+     * date-time stamp.
+     *
+     * \note Such an event must have been indexed.
+     */
+    void remove (const stdair::EventType::EN_EventType&,
+                 const stdair::LongDuration_T&);
+
+    /**
+     * Remove (the index of) the given number of earliest events of the
+     * given type, e.g., the ones removed from the front of the queue as
+     * one range. The cost is logarithmic, beyond the release of the
+     * nodes.
+     *
+     * \note There must be at least as many indexed events of that type.
+     */
+    void removeFirst (const stdair::EventType::EN_EventType&,
+                      const stdair::Count_T&);
+
+    /** Remove all the events. The array of nodes is kept. */
+    void clear();
+
+  private:
+    // ////////// Tree helpers /////////
+    /*
+     * The indices of the nodes are passed by value to the helpers
+     * altering the trees: they are often read from nodes, which may be
+     * moved by the creation of a new node.
+     */
+
+    /** Node of a tree: the events of a given type at a date-time stamp. */
+    struct Node {
+      stdair::LongDuration_T _timeStamp;
+      stdair::Count_T _nbOfEvents;
+      stdair::Count_T _nbOfSubtreeEvents;
+      unsigned int _priority;
+      NodeIndex_T _left;
+      NodeIndex_T _right;
+    };
+
+    /** Get the number of events of the sub-tree of the given node. */
+    stdair::Count_T getNbOfSubtreeEvents (const NodeIndex_T& iNode) const {
+      return (iNode == NIL_NODE) ? 0 : _nodeList[iNode]._nbOfSubtreeEvents;
+    }
+
+    /** Get the priority of the given node (the lowest one for none). */
+    unsigned int getPriority (const NodeIndex_T& iNode) const {
+      return (iNode == NIL_NODE) ? 0 : _nodeList[iNode]._priority;
+    }
+
+    /**
+     * Get the number of events of the given tree, the date-time stamps
+     * of which are strictly earlier than the given one.
+     */
+    stdair::Count_T countBefore (const NodeIndex_T&,
+                                 const stdair::LongDuration_T&) const;
+
+    /** Re-compute the number of events of the sub-tree of the given node. */
+    void updateNbOfSubtreeEvents (const NodeIndex_T&);
+
+    /** Rotate the given sub-tree, and return its new root. */
+    NodeIndex_T rotateLeft (NodeIndex_T);
+    NodeIndex_T rotateRight (NodeIndex_T);
+
+    /** Add an event into the given sub-tree, and return its new root. */
+    NodeIndex_T insert (NodeIndex_T, const stdair::LongDuration_T&);
+
+    /** Remove an event from the given sub-tree, and return its new root. */
+    NodeIndex_T erase (NodeIndex_T, const stdair::LongDuration_T&);
+
+    /**
+     * Remove the given number of earliest events from the given
+     * sub-tree, and return its new root.
+     */
+    NodeIndex_T eraseFirst (NodeIndex_T, stdair::Count_T);
+
+    /**
+     * Merge the two given sub-trees, all the date-time stamps of the
+     * first one being earlier than the ones of the second one, and
+     * return the root of the result.
+     */
+    NodeIndex_T merge (NodeIndex_T, NodeIndex_T);
+
+    /** Get a node for (one event at) the given date-time stamp. */
+    NodeIndex_T createNode (const stdair::LongDuration_T&);
+
+    /** Recycle the given node, or all the nodes of the given sub-tree. */
+    void releaseNode (NodeIndex_T);
+    void releaseSubtree (NodeIndex_T);
+
+  private:
+    // ////////// Attributes /////////
+    /**
+     * Index standing for no node.
+     */
+    static const NodeIndex_T NIL_NODE;
+
+    /**
+     * Nodes of all the trees.
+     */
+    std::vector<Node> _nodeList;
+
+    /**
+     * Nodes which have been released, and may be recycled.
+     */
+    std::vector<NodeIndex_T> _freeNodeList;
+
+    /**
+     * Root of the tree of each event type.
+     */
+    NodeIndex_T _rootList[stdair::EventType::LAST_VALUE];
+
+    /**
+     * State of the (xorshift) generator of the node priorities.
+     */
+    unsigned int _randomState;
+  };
+
+}
+#endif // __SEVMGR_BOM_EVENTTIMEINDEX_HPP
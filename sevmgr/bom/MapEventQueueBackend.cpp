@@ -0,0 +1,229 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <algorithm>
+#include <utility>
+#include <vector>
+// SEvMgr
+#include <sevmgr/bom/MapEventQueueBackend.hpp>
+#include <sevmgr/bom/EventQueueCursor.hpp>
+
+namespace SEVMGR {
+
+  namespace {
+    /**
+     * Cursor walking the map of events, which is already sorted, from
+     * the given iterator.
+     */
+    class MapEventCursor : public EventQueueCursor {
+    public:
+      MapEventCursor (const MapEventQueueBackend::EventOrderedList_T::const_iterator& iBegin,
+                      const MapEventQueueBackend::EventOrderedList_T::const_iterator& iEnd)
+        : _itEvent (iBegin), _itEnd (iEnd) {
+      }
+
+      const stdair::EventStruct* next (EventSequence_T& oSequence) {
+        if (_itEvent == _itEnd) {
+          return NULL;
+        }
+        const stdair::EventStruct* oEvent_ptr = &_itEvent->second;
+        oSequence = _itEvent->first.second;
+        ++_itEvent;
+        return oEvent_ptr;
+      }
+
+    private:
+      MapEventQueueBackend::EventOrderedList_T::const_iterator _itEvent;
+      const MapEventQueueBackend::EventOrderedList_T::const_iterator _itEnd;
+    };
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  MapEventQueueBackend::MapEventQueueBackend (const bool& iIsPooled)
+    : _isPooled (iIsPooled),
+      _eventList (std::less<EventOrderingKey_T>(),
+                  EventNodeAllocator_T (iIsPooled ? &_nodePool : NULL)) {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  MapEventQueueBackend::
+  MapEventQueueBackend (const MapEventQueueBackend& iBackend)
+    : _isPooled (false) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  MapEventQueueBackend::~MapEventQueueBackend() {
+    _extractedNode = EventOrderedList_T::node_type();
+    _eventList.clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct& MapEventQueueBackend::top() const {
+    assert (_eventList.empty() == false);
+    return _eventList.begin()->second;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventSequence_T MapEventQueueBackend::getTopSequence() const {
+    assert (_eventList.empty() == false);
+    return _eventList.begin()->first.second;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool MapEventQueueBackend::
+  hasTimeStamp (const stdair::LongDuration_T& iDateTimeStamp) const {
+    // The first event with that date-time stamp would have the lowest
+    // possible sequence number
+    EventOrderedList_T::const_iterator itEvent =
+      _eventList.lower_bound (EventOrderingKey_T (iDateTimeStamp, 0));
+    return (itEvent != _eventList.end()
+            && itEvent->first.first == iDateTimeStamp);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void MapEventQueueBackend::
+  getSortedEventList (EventStructPtrList_T& ioEventList,
+                      EventSequenceList_T* ioSequenceList_ptr) const {
+    ioEventList.reserve (ioEventList.size() + _eventList.size());
+    for (EventOrderedList_T::const_iterator itEvent = _eventList.begin();
+	 itEvent != _eventList.end(); ++itEvent) {
+      ioEventList.push_back (&itEvent->second);
+      if (ioSequenceList_ptr != NULL) {
+        ioSequenceList_ptr->push_back (itEvent->first.second);
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueCursor* MapEventQueueBackend::
+  createCursor (const stdair::LongDuration_T& iFromTimeStamp) const {
+    // The first event with that date-time stamp would have the lowest
+    // possible sequence number
+    return new MapEventCursor (_eventList.
+                               lower_bound (EventOrderingKey_T (iFromTimeStamp,
+                                                                0)),
+                               _eventList.end());
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool MapEventQueueBackend::insert (const stdair::EventStruct& iEventStruct,
+                                     const EventSequence_T& iSequence) {
+    /**
+     * As the sequence number is unique, so is the ordering key, and the
+     * insertion cannot fail. When the event comes after all the others
+     * (e.g., it has the same date-time stamp as the last event), the
+     * hint makes the insertion amortized constant time.
+     */
+    const EventOrderingKey_T lKey (iEventStruct.getEventTimeStamp(),
+                                   iSequence);
+    _eventList.emplace_hint (_eventList.end(), lKey, iEventStruct);
+
+    return true;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void MapEventQueueBackend::
+  bulkInsert (const EventStructList_T& iEventStructList,
+              const EventSequence_T& iFirstSequence) {
+    // Give the ordering keys in the list order, and sort the list
+    typedef std::pair<EventOrderingKey_T,
+                      const stdair::EventStruct*> KeyedEventPtr_T;
+    std::vector<KeyedEventPtr_T> lKeyedEventList;
+    lKeyedEventList.reserve (iEventStructList.size());
+    EventSequence_T lSequence = iFirstSequence;
+    for (EventStructList_T::const_iterator itEvent = iEventStructList.begin();
+         itEvent != iEventStructList.end(); ++itEvent) {
+      const EventOrderingKey_T lKey (itEvent->getEventTimeStamp(),
+                                     lSequence);
+      ++lSequence;
+      lKeyedEventList.push_back (KeyedEventPtr_T (lKey, &(*itEvent)));
+    }
+    std::sort (lKeyedEventList.begin(), lKeyedEventList.end());
+
+    // Insert the events in order, hinting at the end of the map
+    for (std::vector<KeyedEventPtr_T>::const_iterator itKeyedEvent =
+           lKeyedEventList.begin(); itKeyedEvent != lKeyedEventList.end();
+         ++itKeyedEvent) {
+      _eventList.emplace_hint (_eventList.end(), itKeyedEvent->first,
+                               *itKeyedEvent->second);
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void MapEventQueueBackend::clear() {
+    _extractedNode = EventOrderedList_T::node_type();
+    _eventList.clear();
+
+    // No node is in use any more: the whole arena can be re-used
+    if (_isPooled == true) {
+      _nodePool.rewind();
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void MapEventQueueBackend::pop (stdair::EventStruct& ioEventStruct) {
+    assert (_eventList.empty() == false);
+
+    // Get an iterator on the first event (sorted by date-time stamps)
+    EventOrderedList_T::iterator itEvent = _eventList.begin();
+
+    /**
+     * Extract (a copy of) the corresponding Event structure. We make
+     * a copy here, as the original EventStruct structure is removed
+     * from the list (and erased).
+     */
+    ioEventStruct = itEvent->second;
+
+    // Remove the event, which has just been retrieved
+    _eventList.erase (itEvent);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct& MapEventQueueBackend::extract() {
+    assert (_eventList.empty() == false);
+
+    // Unlink the node of the first event, and keep it (the node of the
+    // previously extracted event, if any, is released)
+    _extractedNode = _eventList.extract (_eventList.begin());
+    return _extractedNode.mapped();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T MapEventQueueBackend::
+  removeBefore (const stdair::LongDuration_T& iDateTimeStamp,
+                const EventTypeMask_T& iTypeMask,
+                EventStructList_T* ioEventStructList_ptr,
+                EventTypeCountList_T& ioNbOfEventsList) {
+    // The first event at, or after, the given date-time stamp would have
+    // the lowest possible sequence number
+    EventOrderedList_T::iterator itLastEvent =
+      _eventList.lower_bound (EventOrderingKey_T (iDateTimeStamp, 0));
+
+    // Account for the events of the range, which is cut short at the
+    // first event of a type outside of the mask, if any
+    stdair::Count_T oNbOfRemovedEvents = 0;
+    for (EventOrderedList_T::iterator itEvent = _eventList.begin();
+         itEvent != itLastEvent; ++itEvent) {
+      const stdair::EventType::EN_EventType lEventType =
+        itEvent->second.getEventType();
+      if ((iTypeMask & (static_cast<EventTypeMask_T> (1) << lEventType))
+          == 0) {
+        itLastEvent = itEvent;
+        break;
+      }
+      if (ioEventStructList_ptr != NULL) {
+        ioEventStructList_ptr->push_back (itEvent->second);
+      }
+      ++ioNbOfEventsList[lEventType];
+      ++oNbOfRemovedEvents;
+    }
+
+    // Erase the whole range at once
+    _eventList.erase (_eventList.begin(), itLastEvent);
+    return oNbOfRemovedEvents;
+  }
+
+}
@@ -0,0 +1,172 @@
+#ifndef __SEVMGR_BOM_MAPEVENTQUEUEBACKEND_HPP
+#define __SEVMGR_BOM_MAPEVENTQUEUEBACKEND_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <map>
+#include <functional>
+// StdAir
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/bom/EventQueueBackend.hpp>
+#include <sevmgr/bom/EventNodePool.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Event queue backend relying on a (STL) map of events, keyed
+   * by (date-time stamp, insertion sequence number).
+   *
+   * That is the reference implementation: each event costs a tree node
+   * allocation, and insertions and removals are logarithmic.
+   *
+   * In pooled mode, the tree nodes are drawn from an arena (slabs) owned
+   * by the backend, rather than from the system allocator: once the
+   * arena has reached its working size, there is no malloc/free per
+   * event any more, and clearing the map hands all the slabs over to
+   * the next events in constant time (the slabs are kept).
+   *
+   * Events having the same date-time stamp are ordered by insertion
+   * sequence, so that they are popped in the order they were added.
+   * Their date-time stamp is never altered.
+   */
+  class MapEventQueueBackend : public EventQueueBackend {
+  public:
+    // ////////// Type definitions ////////////
+    /** Allocator of the map nodes. */
+    typedef EventNodeAllocator<std::pair<const EventOrderingKey_T,
+                                         stdair::EventStruct> > EventNodeAllocator_T;
+
+    /**
+     * (STL) map of events, sorted by ordering key. The nodes are drawn
+     * from the pool of the backend, if any.
+     */
+    typedef std::map<EventOrderingKey_T, stdair::EventStruct,
+                     std::less<EventOrderingKey_T>,
+                     EventNodeAllocator_T> EventOrderedList_T;
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     *
+     * @param const bool& Whether the map nodes are drawn from a pool
+     *        owned by the backend (pooled mode).
+     */
+    explicit MapEventQueueBackend (const bool& iIsPooled = false);
+    /** Destructor. */
+    ~MapEventQueueBackend();
+
+  private:
+    /** Copy constructor (not to be used). */
+    MapEventQueueBackend (const MapEventQueueBackend&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the type of the backend. */
+    EventQueueBackendType::EN_EventQueueBackendType getType() const {
+      return (_isPooled ? EventQueueBackendType::POOLED_MAP
+              : EventQueueBackendType::MAP);
+    }
+
+    /** Get the number of slabs of the node pool (in pooled mode). */
+    std::size_t getNbOfSlabs() const {
+      return _nodePool.getNbOfSlabs();
+    }
+
+    /** Get the number of events. */
+    stdair::Count_T size() const {
+      return _eventList.size();
+    }
+
+    /** State whether there is no event. */
+    bool empty() const {
+      return _eventList.empty();
+    }
+
+    /** Get the next coming (in time) event. */
+    const stdair::EventStruct& top() const;
+
+    /** Get the insertion sequence number of the next coming event. */
+    EventSequence_T getTopSequence() const;
+
+    /** State whether there is an event with the given date-time stamp. */
+    bool hasTimeStamp (const stdair::LongDuration_T&) const;
+
+    /** Fill the given list with all the events, sorted by date-time. */
+    void getSortedEventList (EventStructPtrList_T&,
+                             EventSequenceList_T*) const;
+
+    /**
+     * Create a cursor walking the map, one event at a time, from the
+     * given date-time stamp (found by a logarithmic search).
+     */
+    EventQueueCursor* createCursor (const stdair::LongDuration_T&) const;
+
+  public:
+    // ////////// Business methods /////////
+    /** Insert the given event. */
+    bool insert (const stdair::EventStruct&, const EventSequence_T&);
+
+    /**
+     * Insert all the events of the given list. The list is sorted
+     * first, so that each event is inserted right before the end of
+     * the map, when the map is empty or when all the events of the list
+     * come after the ones of the map: the insertion is then linear.
+     */
+    void bulkInsert (const EventStructList_T&, const EventSequence_T&);
+
+    /** Extract the next coming (in time) event. */
+    void pop (stdair::EventStruct&);
+
+    /**
+     * Extract the next coming (in time) event, without copying it: its
+     * map node is unlinked, and kept until the next extraction.
+     */
+    const stdair::EventStruct& extract();
+
+    /**
+     * Remove all the events earlier than the given date-time stamp: the
+     * bound is found by a logarithmic search, and the events before it
+     * are erased as one range.
+     */
+    stdair::Count_T removeBefore (const stdair::LongDuration_T&,
+                                  const EventTypeMask_T&,
+                                  EventStructList_T*,
+                                  EventTypeCountList_T&);
+
+    /**
+     * Remove all the events. In pooled mode, the slabs are kept, and
+     * made available again in constant time.
+     */
+    void clear();
+
+  private:
+    // ////////// Attributes /////////
+    /**
+     * Whether the map nodes are drawn from the node pool.
+     */
+    const bool _isPooled;
+
+    /**
+     * Pool of the map nodes (used in pooled mode only).
+     * \note It must be declared before, and thus outlive, the map.
+     */
+    EventNodePool _nodePool;
+
+    /**
+     * List of events.
+     */
+    EventOrderedList_T _eventList;
+
+    /**
+     * Node of the last extracted event, unlinked from the map.
+     * \note It must be declared after the pool, which it refers to.
+     */
+    EventOrderedList_T::node_type _extractedNode;
+  };
+
+}
+#endif // __SEVMGR_BOM_MAPEVENTQUEUEBACKEND_HPP
@@ -0,0 +1,150 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// SEvMgr
+#include <sevmgr/bom/ProgressStatusMonitor.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  ProgressStatusMonitor::ProgressStatusMonitor()
+    : _sequence (0), _declaredTypeMask (0) {
+    const stdair::ProgressStatus lNullStatus (0, 0, 0);
+    store (_overallCounters, lNullStatus);
+    for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+      store (_counterList[idx], lNullStatus);
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  ProgressStatusMonitor::
+  ProgressStatusMonitor (const ProgressStatusMonitor& iMonitor)
+    : _sequence (0), _declaredTypeMask (0) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  ProgressStatusMonitor::~ProgressStatusMonitor() {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ProgressStatusMonitor::store (Counters& ioCounters,
+                                     const stdair::ProgressStatus& iStatus) {
+    ioCounters._currentNb.store (iStatus.getCurrentNb(),
+                                 std::memory_order_relaxed);
+    ioCounters._expectedNb.store (iStatus.getExpectedNb(),
+                                  std::memory_order_relaxed);
+    ioCounters._actualNb.store (iStatus.getActualNb(),
+                                std::memory_order_relaxed);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatus ProgressStatusMonitor::
+  load (const Counters& iCounters) {
+    const stdair::ProgressStatus
+      oStatus (iCounters._currentNb.load (std::memory_order_relaxed),
+               iCounters._expectedNb.load (std::memory_order_relaxed),
+               iCounters._actualNb.load (std::memory_order_relaxed));
+    return oStatus;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ProgressStatusMonitor::
+  publish (const stdair::ProgressStatus& iOverallStatus,
+           const stdair::ProgressStatus iStatusList[],
+           const EventTypeMask_T& iDeclaredTypeMask,
+           const EventTypeMask_T& iUpdatedTypeMask) {
+    // Flag the publication as being in progress (odd sequence number).
+    // The release fence prevents the counter stores below from being
+    // visible before that flag.
+    const PublicationSequence_T lSequence =
+      _sequence.load (std::memory_order_relaxed);
+    _sequence.store (lSequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+
+    store (_overallCounters, iOverallStatus);
+    EventTypeMask_T lUpdatedTypeMask = iUpdatedTypeMask;
+    for (unsigned short idx = 0; lUpdatedTypeMask != 0; ++idx) {
+      if ((lUpdatedTypeMask & 1) != 0) {
+        assert (idx < stdair::EventType::LAST_VALUE);
+        store (_counterList[idx], iStatusList[idx]);
+      }
+      lUpdatedTypeMask >>= 1;
+    }
+    _declaredTypeMask.store (iDeclaredTypeMask, std::memory_order_relaxed);
+
+    // Flag the publication as being complete (even sequence number)
+    _sequence.store (lSequence + 2, std::memory_order_release);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatus ProgressStatusMonitor::getStatus() const {
+    stdair::ProgressStatus oStatus;
+    PublicationSequence_T lSequenceBefore = 0;
+    PublicationSequence_T lSequenceAfter = 0;
+    do {
+      lSequenceBefore = _sequence.load (std::memory_order_acquire);
+      oStatus = load (_overallCounters);
+      std::atomic_thread_fence (std::memory_order_acquire);
+      lSequenceAfter = _sequence.load (std::memory_order_relaxed);
+    } while ((lSequenceBefore & 1) != 0 || lSequenceBefore != lSequenceAfter);
+
+    return oStatus;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatus ProgressStatusMonitor::
+  getStatus (const stdair::EventType::EN_EventType& iType) const {
+    assert (iType < stdair::EventType::LAST_VALUE);
+
+    stdair::ProgressStatus oStatus;
+    PublicationSequence_T lSequenceBefore = 0;
+    PublicationSequence_T lSequenceAfter = 0;
+    do {
+      lSequenceBefore = _sequence.load (std::memory_order_acquire);
+      oStatus = load (_counterList[iType]);
+      std::atomic_thread_fence (std::memory_order_acquire);
+      lSequenceAfter = _sequence.load (std::memory_order_relaxed);
+    } while ((lSequenceBefore & 1) != 0 || lSequenceBefore != lSequenceAfter);
+
+    return oStatus;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet ProgressStatusMonitor::
+  getStatusSet (const stdair::EventType::EN_EventType& iType) const {
+    assert (iType < stdair::EventType::LAST_VALUE);
+
+    stdair::ProgressStatus lOverallStatus;
+    stdair::ProgressStatus lTypeSpecificStatus;
+    PublicationSequence_T lSequenceBefore = 0;
+    PublicationSequence_T lSequenceAfter = 0;
+    do {
+      lSequenceBefore = _sequence.load (std::memory_order_acquire);
+      lOverallStatus = load (_overallCounters);
+      lTypeSpecificStatus = load (_counterList[iType]);
+      std::atomic_thread_fence (std::memory_order_acquire);
+      lSequenceAfter = _sequence.load (std::memory_order_relaxed);
+    } while ((lSequenceBefore & 1) != 0 || lSequenceBefore != lSequenceAfter);
+
+    stdair::ProgressStatusSet oProgressStatusSet (iType);
+    oProgressStatusSet.setTypeSpecificStatus (lTypeSpecificStatus);
+    oProgressStatusSet.setOverallStatus (lOverallStatus);
+    return oProgressStatusSet;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool ProgressStatusMonitor::
+  hasStatus (const stdair::EventType::EN_EventType& iType) const {
+    if (iType >= stdair::EventType::LAST_VALUE) {
+      return false;
+    }
+    const EventTypeMask_T lTypeBit = (static_cast<EventTypeMask_T> (1) << iType);
+    const EventTypeMask_T lDeclaredTypeMask =
+      _declaredTypeMask.load (std::memory_order_acquire);
+    return ((lDeclaredTypeMask & lTypeBit) != 0);
+  }
+
+}
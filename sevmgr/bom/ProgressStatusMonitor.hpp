@@ -0,0 +1,133 @@
+#ifndef __SEVMGR_BOM_PROGRESSSTATUSMONITOR_HPP
+#define __SEVMGR_BOM_PROGRESSSTATUSMONITOR_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <atomic>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/basic/EventType.hpp>
+#include <stdair/basic/ProgressStatus.hpp>
+#include <stdair/basic/ProgressStatusSet.hpp>
+// SEvMgr
+#include <sevmgr/bom/EventQueueTypes.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Copy of the progress statuses of an event queue, which may be
+   * read from any thread, while the event queue is being altered by
+   * another one.
+   *
+   * The counters are published by the (single) thread altering the
+   * event queue, under a sequence lock: the sequence number is odd while
+   * a publication is in progress. A reader takes a copy of the counters,
+   * and starts over when the sequence number has changed in the
+   * meantime. Hence, the publishing thread never waits for the readers,
+   * and a reader always gets a consistent view (e.g., the overall
+   * status and the one specific to an event type, taken at the same
+   * point in time).
+   */
+  class ProgressStatusMonitor {
+  public:
+    // ////////// Type definitions ////////////
+    /** Sequence number of the publications. */
+    typedef unsigned long PublicationSequence_T;
+
+    /**
+     * Counters of a progress status. They are atomic, so that the
+     * (optimistic) copies taken by the readers are not data races.
+     */
+    struct Counters {
+      std::atomic<stdair::Count_T> _currentNb;
+      std::atomic<stdair::Count_T> _expectedNb;
+      std::atomic<stdair::Count_T> _actualNb;
+    };
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. All the counters are set to zero. */
+    ProgressStatusMonitor();
+    /** Destructor. */
+    ~ProgressStatusMonitor();
+
+  private:
+    /** Copy constructor (not to be used). */
+    ProgressStatusMonitor (const ProgressStatusMonitor&);
+
+  public:
+    // /////////// Getters (may be called from any thread) ///////////////
+    /** Get (a consistent copy of) the overall progress status. */
+    stdair::ProgressStatus getStatus() const;
+
+    /**
+     * Get (a consistent copy of) the progress status for the given event
+     * type. When no progress status has been declared for that type, the
+     * counters are all zero.
+     */
+    stdair::ProgressStatus
+    getStatus (const stdair::EventType::EN_EventType&) const;
+
+    /**
+     * Get (a consistent copy of) both the overall progress status and the
+     * one specific to the given event type.
+     */
+    stdair::ProgressStatusSet
+    getStatusSet (const stdair::EventType::EN_EventType&) const;
+
+    /** State whether a progress status has been declared for that type. */
+    bool hasStatus (const stdair::EventType::EN_EventType&) const;
+
+    /** Get the number of publications so far. */
+    PublicationSequence_T getNbOfPublications() const {
+      return (_sequence.load (std::memory_order_acquire) / 2);
+    }
+
+  public:
+    // ////////// Business methods (publishing thread only) /////////
+    /**
+     * Publish the given overall progress status, along with the progress
+     * statuses of the event types flagged within the given (updated type)
+     * mask. The progress statuses are given by an array indexed by the
+     * event type.
+     */
+    void publish (const stdair::ProgressStatus& iOverallStatus,
+                  const stdair::ProgressStatus iStatusList[],
+                  const EventTypeMask_T& iDeclaredTypeMask,
+                  const EventTypeMask_T& iUpdatedTypeMask);
+
+  private:
+    // ////////// Helpers /////////
+    /** Store the given progress status into the given counters. */
+    static void store (Counters&, const stdair::ProgressStatus&);
+
+    /** Load a progress status from the given counters. */
+    static stdair::ProgressStatus load (const Counters&);
+
+  private:
+    // ////////// Attributes /////////
+    /**
+     * Sequence number, odd while a publication is in progress.
+     */
+    std::atomic<PublicationSequence_T> _sequence;
+
+    /**
+     * Counters of the overall progress status.
+     */
+    Counters _overallCounters;
+
+    /**
+     * Counters of the progress statuses, indexed by event type.
+     */
+    Counters _counterList[stdair::EventType::LAST_VALUE];
+
+    /**
+     * Event types for which a progress status has been declared.
+     */
+    std::atomic<EventTypeMask_T> _declaredTypeMask;
+  };
+
+}
+#endif // __SEVMGR_BOM_PROGRESSSTATUSMONITOR_HPP
@@ -0,0 +1,358 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <iterator>
+// SEvMgr
+#include <sevmgr/bom/ShardedEventQueueBackend.hpp>
+#include <sevmgr/bom/EventQueueCursor.hpp>
+
+namespace SEVMGR {
+
+  namespace {
+    /**
+     * Cursor merging the sub-queues on the fly, picking the earliest
+     * head at each step.
+     */
+    class ShardedEventCursor : public EventQueueCursor {
+    public:
+      ShardedEventCursor (const ShardedEventQueueBackend::EventOrderedList_T* iShardList,
+                          const stdair::LongDuration_T& iFromTimeStamp)
+        : _shardList (iShardList) {
+        const EventOrderingKey_T lFromKey (iFromTimeStamp, 0);
+        for (ShardedEventQueueBackend::ShardIndex_T idx = 0;
+             idx != ShardedEventQueueBackend::NB_OF_SHARDS; ++idx) {
+          _headList[idx] = _shardList[idx].lower_bound (lFromKey);
+        }
+      }
+
+      const stdair::EventStruct* next (EventSequence_T& oSequence) {
+        ShardedEventQueueBackend::ShardIndex_T lBestShard =
+          ShardedEventQueueBackend::NB_OF_SHARDS;
+        for (ShardedEventQueueBackend::ShardIndex_T idx = 0;
+             idx != ShardedEventQueueBackend::NB_OF_SHARDS; ++idx) {
+          if (_headList[idx] != _shardList[idx].end()
+              && (lBestShard == ShardedEventQueueBackend::NB_OF_SHARDS
+                  || _headList[idx]->first < _headList[lBestShard]->first)) {
+            lBestShard = idx;
+          }
+        }
+        if (lBestShard == ShardedEventQueueBackend::NB_OF_SHARDS) {
+          return NULL;
+        }
+        const stdair::EventStruct* oEvent_ptr = &_headList[lBestShard]->second;
+        oSequence = _headList[lBestShard]->first.second;
+        ++_headList[lBestShard];
+        return oEvent_ptr;
+      }
+
+    private:
+      const ShardedEventQueueBackend::EventOrderedList_T* _shardList;
+      ShardedEventQueueBackend::EventOrderedList_T::const_iterator
+      _headList[ShardedEventQueueBackend::NB_OF_SHARDS];
+    };
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const ShardedEventQueueBackend::ShardIndex_T
+  ShardedEventQueueBackend::NB_OF_SHARDS;
+
+  // //////////////////////////////////////////////////////////////////////
+  ShardedEventQueueBackend::ShardedEventQueueBackend()
+    : _nbOfLeaves (1), _nbOfEvents (0) {
+    while (_nbOfLeaves < NB_OF_SHARDS) {
+      _nbOfLeaves <<= 1;
+    }
+
+    // The padding leaves hold an index out of range, i.e., an empty
+    // sub-queue
+    _winnerTree.resize (2 * _nbOfLeaves, NB_OF_SHARDS);
+    for (ShardIndex_T idx = 0; idx != NB_OF_SHARDS; ++idx) {
+      _winnerTree[_nbOfLeaves + idx] = idx;
+    }
+    rebuild();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  ShardedEventQueueBackend::
+  ShardedEventQueueBackend (const ShardedEventQueueBackend& iBackend)
+    : _nbOfLeaves (1), _nbOfEvents (0) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  ShardedEventQueueBackend::~ShardedEventQueueBackend() {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  ShardedEventQueueBackend::EventOrderedList_T& ShardedEventQueueBackend::
+  getShard (const stdair::EventType::EN_EventType& iType) {
+    assert (iType < NB_OF_SHARDS);
+    return _shardList[iType];
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool ShardedEventQueueBackend::isBefore (const ShardIndex_T& iShard,
+                                           const ShardIndex_T& iOtherShard) const {
+    if (iShard >= NB_OF_SHARDS || _shardList[iShard].empty() == true) {
+      return false;
+    }
+    if (iOtherShard >= NB_OF_SHARDS
+        || _shardList[iOtherShard].empty() == true) {
+      return true;
+    }
+    return (_shardList[iShard].begin()->first
+            < _shardList[iOtherShard].begin()->first);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ShardedEventQueueBackend::replay (const ShardIndex_T& iShard) {
+    for (ShardIndex_T lNode = (_nbOfLeaves + iShard) / 2; lNode != 0;
+         lNode /= 2) {
+      const ShardIndex_T& lLeft = _winnerTree[2 * lNode];
+      const ShardIndex_T& lRight = _winnerTree[2 * lNode + 1];
+      _winnerTree[lNode] = (isBefore (lRight, lLeft) == true) ? lRight : lLeft;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ShardedEventQueueBackend::rebuild() {
+    for (ShardIndex_T lNode = _nbOfLeaves - 1; lNode != 0; --lNode) {
+      const ShardIndex_T& lLeft = _winnerTree[2 * lNode];
+      const ShardIndex_T& lRight = _winnerTree[2 * lNode + 1];
+      _winnerTree[lNode] = (isBefore (lRight, lLeft) == true) ? lRight : lLeft;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct& ShardedEventQueueBackend::top() const {
+    assert (_nbOfEvents != 0);
+    const ShardIndex_T& lShard = _winnerTree[1];
+    assert (lShard < NB_OF_SHARDS && _shardList[lShard].empty() == false);
+    return _shardList[lShard].begin()->second;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventSequence_T ShardedEventQueueBackend::getTopSequence() const {
+    assert (_nbOfEvents != 0);
+    const ShardIndex_T& lShard = _winnerTree[1];
+    assert (lShard < NB_OF_SHARDS && _shardList[lShard].empty() == false);
+    return _shardList[lShard].begin()->first.second;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool ShardedEventQueueBackend::
+  hasTimeStamp (const stdair::LongDuration_T& iDateTimeStamp) const {
+    const EventOrderingKey_T lKey (iDateTimeStamp, 0);
+    for (ShardIndex_T idx = 0; idx != NB_OF_SHARDS; ++idx) {
+      EventOrderedList_T::const_iterator itEvent =
+        _shardList[idx].lower_bound (lKey);
+      if (itEvent != _shardList[idx].end()
+          && itEvent->first.first == iDateTimeStamp) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ShardedEventQueueBackend::
+  getSortedEventList (EventStructPtrList_T& ioEventList,
+                      EventSequenceList_T* ioSequenceList_ptr) const {
+    ioEventList.reserve (ioEventList.size() + _nbOfEvents);
+
+    // Merge the sub-queues, picking the earliest head at each step
+    EventOrderedList_T::const_iterator lHeadList[NB_OF_SHARDS];
+    for (ShardIndex_T idx = 0; idx != NB_OF_SHARDS; ++idx) {
+      lHeadList[idx] = _shardList[idx].begin();
+    }
+    for (stdair::Count_T lNbOfEvents = 0; lNbOfEvents != _nbOfEvents;
+         ++lNbOfEvents) {
+      ShardIndex_T lBestShard = NB_OF_SHARDS;
+      for (ShardIndex_T idx = 0; idx != NB_OF_SHARDS; ++idx) {
+        if (lHeadList[idx] != _shardList[idx].end()
+            && (lBestShard == NB_OF_SHARDS
+                || lHeadList[idx]->first < lHeadList[lBestShard]->first)) {
+          lBestShard = idx;
+        }
+      }
+      assert (lBestShard != NB_OF_SHARDS);
+      ioEventList.push_back (&lHeadList[lBestShard]->second);
+      if (ioSequenceList_ptr != NULL) {
+        ioSequenceList_ptr->push_back (lHeadList[lBestShard]->first.second);
+      }
+      ++lHeadList[lBestShard];
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueCursor* ShardedEventQueueBackend::
+  createCursor (const stdair::LongDuration_T& iFromTimeStamp) const {
+    return new ShardedEventCursor (_shardList, iFromTimeStamp);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T ShardedEventQueueBackend::
+  count (const stdair::EventType::EN_EventType& iType) const {
+    assert (iType < NB_OF_SHARDS);
+    return _shardList[iType].size();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ShardedEventQueueBackend::
+  getSortedEventListOfType (EventStructPtrList_T& ioEventList,
+                            const stdair::EventType::EN_EventType& iType,
+                            EventSequenceList_T* ioSequenceList_ptr) const {
+    assert (iType < NB_OF_SHARDS);
+    const EventOrderedList_T& lShard = _shardList[iType];
+    ioEventList.reserve (ioEventList.size() + lShard.size());
+    for (EventOrderedList_T::const_iterator itEvent = lShard.begin();
+         itEvent != lShard.end(); ++itEvent) {
+      ioEventList.push_back (&itEvent->second);
+      if (ioSequenceList_ptr != NULL) {
+        ioSequenceList_ptr->push_back (itEvent->first.second);
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool ShardedEventQueueBackend::
+  insert (const stdair::EventStruct& iEventStruct,
+          const EventSequence_T& iSequence) {
+    // As the sequence number is unique, so is the ordering key, and the
+    // insertion cannot fail
+    const stdair::EventType::EN_EventType& lType =
+      iEventStruct.getEventType();
+    const EventOrderingKey_T lKey (iEventStruct.getEventTimeStamp(),
+                                   iSequence);
+    EventOrderedList_T& lShard = getShard (lType);
+    lShard.emplace_hint (lShard.end(), lKey, iEventStruct);
+    ++_nbOfEvents;
+
+    // Only the matches of that sub-queue may have changed
+    replay (lType);
+    return true;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ShardedEventQueueBackend::
+  bulkInsert (const EventStructList_T& iEventStructList,
+              const EventSequence_T& iFirstSequence) {
+    EventSequence_T lSequence = iFirstSequence;
+    for (EventStructList_T::const_iterator itEvent = iEventStructList.begin();
+         itEvent != iEventStructList.end(); ++itEvent) {
+      const EventOrderingKey_T lKey (itEvent->getEventTimeStamp(),
+                                     lSequence);
+      ++lSequence;
+      EventOrderedList_T& lShard = getShard (itEvent->getEventType());
+      lShard.emplace_hint (lShard.end(), lKey, *itEvent);
+    }
+    _nbOfEvents += iEventStructList.size();
+    rebuild();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ShardedEventQueueBackend::pop (stdair::EventStruct& ioEventStruct) {
+    assert (_nbOfEvents != 0);
+
+    // The winner of the tournament holds the next event
+    const ShardIndex_T lShardIndex = _winnerTree[1];
+    assert (lShardIndex < NB_OF_SHARDS);
+    EventOrderedList_T& lShard = _shardList[lShardIndex];
+    assert (lShard.empty() == false);
+    ioEventStruct = lShard.begin()->second;
+    lShard.erase (lShard.begin());
+    --_nbOfEvents;
+
+    replay (lShardIndex);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct& ShardedEventQueueBackend::extract() {
+    assert (_nbOfEvents != 0);
+
+    // Unlink the node of the next event, and keep it (the node of the
+    // previously extracted event, if any, is released)
+    const ShardIndex_T lShardIndex = _winnerTree[1];
+    assert (lShardIndex < NB_OF_SHARDS);
+    EventOrderedList_T& lShard = _shardList[lShardIndex];
+    assert (lShard.empty() == false);
+    _extractedNode = lShard.extract (lShard.begin());
+    --_nbOfEvents;
+
+    replay (lShardIndex);
+    return _extractedNode.mapped();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T ShardedEventQueueBackend::
+  removeBefore (const stdair::LongDuration_T& iDateTimeStamp,
+                const EventTypeMask_T& iTypeMask,
+                EventStructList_T* ioEventStructList_ptr,
+                EventTypeCountList_T& ioNbOfEventsList) {
+    // The removal stops before the first event of a type outside of the
+    // mask: the bound is the earliest of those events, if any
+    EventOrderingKey_T lBoundKey (iDateTimeStamp, 0);
+    for (ShardIndex_T idx = 0; idx != NB_OF_SHARDS; ++idx) {
+      if ((iTypeMask & (static_cast<EventTypeMask_T> (1) << idx)) == 0
+          && _shardList[idx].empty() == false
+          && _shardList[idx].begin()->first < lBoundKey) {
+        lBoundKey = _shardList[idx].begin()->first;
+      }
+    }
+
+    // Range of the events to be removed within each sub-queue
+    EventOrderedList_T::iterator lHeadList[NB_OF_SHARDS];
+    EventOrderedList_T::iterator lBoundList[NB_OF_SHARDS];
+    for (ShardIndex_T idx = 0; idx != NB_OF_SHARDS; ++idx) {
+      lHeadList[idx] = _shardList[idx].begin();
+      lBoundList[idx] = _shardList[idx].lower_bound (lBoundKey);
+    }
+
+    // Copy the removed events, if needed, merging the sub-queues
+    if (ioEventStructList_ptr != NULL) {
+      while (true) {
+        ShardIndex_T lBestShard = NB_OF_SHARDS;
+        for (ShardIndex_T idx = 0; idx != NB_OF_SHARDS; ++idx) {
+          if (lHeadList[idx] != lBoundList[idx]
+              && (lBestShard == NB_OF_SHARDS
+                  || lHeadList[idx]->first < lHeadList[lBestShard]->first)) {
+            lBestShard = idx;
+          }
+        }
+        if (lBestShard == NB_OF_SHARDS) {
+          break;
+        }
+        ioEventStructList_ptr->push_back (lHeadList[lBestShard]->second);
+        ++lHeadList[lBestShard];
+      }
+    }
+
+    // Erase the ranges, and replay the whole tree once
+    stdair::Count_T oNbOfRemovedEvents = 0;
+    for (ShardIndex_T idx = 0; idx != NB_OF_SHARDS; ++idx) {
+      EventOrderedList_T& lShard = _shardList[idx];
+      const stdair::Count_T lNbOfEvents =
+        std::distance (lShard.begin(), lBoundList[idx]);
+      lShard.erase (lShard.begin(), lBoundList[idx]);
+      ioNbOfEventsList[idx] += lNbOfEvents;
+      oNbOfRemovedEvents += lNbOfEvents;
+    }
+    _nbOfEvents -= oNbOfRemovedEvents;
+    rebuild();
+
+    return oNbOfRemovedEvents;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ShardedEventQueueBackend::clear() {
+    _extractedNode = EventOrderedList_T::node_type();
+    for (ShardIndex_T idx = 0; idx != NB_OF_SHARDS; ++idx) {
+      _shardList[idx].clear();
+    }
+    _nbOfEvents = 0;
+    rebuild();
+  }
+
+}
@@ -0,0 +1,185 @@
+#ifndef __SEVMGR_BOM_SHARDEDEVENTQUEUEBACKEND_HPP
+#define __SEVMGR_BOM_SHARDEDEVENTQUEUEBACKEND_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <map>
+#include <vector>
+// StdAir
+#include <stdair/basic/EventType.hpp>
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/bom/EventQueueBackend.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Event queue backend sharded by event type: the events of each
+   * type are held by their own (STL) map, keyed by (date-time stamp,
+   * insertion sequence number).
+   *
+   * The next event of the whole queue is given by a tournament (winner)
+   * tree, the leaves of which are the sub-queues: each internal node
+   * holds the sub-queue having the earliest next event among the ones
+   * below it. After an insertion into, or a removal from, a sub-queue,
+   * only the path from its leaf up to the root is replayed, i.e., a few
+   * comparisons (there are only a handful of event types).
+   *
+   * The insertion sequence numbers are unique across all the
+   * sub-queues, so that the events having the same date-time stamp are
+   * popped in the order they were added, whatever their types. The
+   * events of a given type are counted and listed without browsing the
+   * other ones.
+   */
+  class ShardedEventQueueBackend : public EventQueueBackend {
+  public:
+    // ////////// Type definitions ////////////
+    /** (STL) map of the events of a given type, sorted by ordering key. */
+    typedef std::map<EventOrderingKey_T,
+                     stdair::EventStruct> EventOrderedList_T;
+
+    /** Index of a sub-queue, i.e., the event type. */
+    typedef unsigned int ShardIndex_T;
+
+    /** Number of sub-queues. */
+    static const ShardIndex_T NB_OF_SHARDS = stdair::EventType::LAST_VALUE;
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    ShardedEventQueueBackend();
+    /** Destructor. */
+    ~ShardedEventQueueBackend();
+
+  private:
+    /** Copy constructor (not to be used). */
+    ShardedEventQueueBackend (const ShardedEventQueueBackend&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the type of the backend. */
+    EventQueueBackendType::EN_EventQueueBackendType getType() const {
+      return EventQueueBackendType::SHARDED;
+    }
+
+    /** Get the number of events. */
+    stdair::Count_T size() const {
+      return _nbOfEvents;
+    }
+
+    /** State whether there is no event. */
+    bool empty() const {
+      return (_nbOfEvents == 0);
+    }
+
+    /** Get the next coming (in time) event. */
+    const stdair::EventStruct& top() const;
+
+    /** Get the insertion sequence number of the next coming event. */
+    EventSequence_T getTopSequence() const;
+
+    /** State whether there is an event with the given date-time stamp. */
+    bool hasTimeStamp (const stdair::LongDuration_T&) const;
+
+    /**
+     * Fill the given list with all the events, sorted by date-time, by
+     * merging the sub-queues.
+     */
+    void getSortedEventList (EventStructPtrList_T&,
+                             EventSequenceList_T*) const;
+
+    /**
+     * Create a cursor merging the sub-queues on the fly, each one being
+     * searched for the given date-time stamp.
+     */
+    EventQueueCursor* createCursor (const stdair::LongDuration_T&) const;
+
+    /** Get the number of events of the given type (constant time). */
+    stdair::Count_T count (const stdair::EventType::EN_EventType&) const;
+
+    /**
+     * Fill the given list with the events of the given type, sorted by
+     * date-time, browsing their sub-queue only.
+     */
+    void getSortedEventListOfType (EventStructPtrList_T&,
+                                   const stdair::EventType::EN_EventType&,
+                                   EventSequenceList_T*) const;
+
+  public:
+    // ////////// Business methods /////////
+    /** Insert the given event into the sub-queue of its type. */
+    bool insert (const stdair::EventStruct&, const EventSequence_T&);
+
+    /**
+     * Insert all the events of the given list, the tournament tree
+     * being replayed once for all.
+     */
+    void bulkInsert (const EventStructList_T&, const EventSequence_T&);
+
+    /** Extract the next coming (in time) event. */
+    void pop (stdair::EventStruct&);
+
+    /**
+     * Extract the next coming (in time) event, without copying it: its
+     * map node is unlinked, and kept until the next extraction.
+     */
+    const stdair::EventStruct& extract();
+
+    /**
+     * Remove all the events earlier than the given date-time stamp: each
+     * sub-queue is cut by a logarithmic search, and erased as one range,
+     * the tournament tree being replayed once for all.
+     */
+    stdair::Count_T removeBefore (const stdair::LongDuration_T&,
+                                  const EventTypeMask_T&,
+                                  EventStructList_T*,
+                                  EventTypeCountList_T&);
+
+    /** Remove all the events. */
+    void clear();
+
+  private:
+    // ////////// Helpers /////////
+    /** Sub-queue of the given event type. */
+    EventOrderedList_T& getShard (const stdair::EventType::EN_EventType&);
+
+    /**
+     * State whether the next event of the first given sub-queue comes
+     * before the one of the second given sub-queue. The empty sub-queues
+     * (and the padding leaves) come last.
+     */
+    bool isBefore (const ShardIndex_T&, const ShardIndex_T&) const;
+
+    /** Replay the matches from the leaf of the given sub-queue. */
+    void replay (const ShardIndex_T&);
+
+    /** Replay all the matches of the tournament tree. */
+    void rebuild();
+
+  private:
+    // ////////// Attributes /////////
+    /** Sub-queues, one per event type. */
+    EventOrderedList_T _shardList[NB_OF_SHARDS];
+
+    /**
+     * Tournament tree, stored as an implicit binary tree: the node of
+     * rank i (starting at 1) has the children of ranks 2i and 2i+1, the
+     * leaves being the (padded) sub-queues. Each node holds the index of
+     * its winning sub-queue.
+     */
+    std::vector<ShardIndex_T> _winnerTree;
+
+    /** Number of leaves of the tree (a power of two). */
+    ShardIndex_T _nbOfLeaves;
+
+    /** Node of the last extracted event, unlinked from its sub-queue. */
+    EventOrderedList_T::node_type _extractedNode;
+
+    /** Total number of events. */
+    stdair::Count_T _nbOfEvents;
+  };
+
+}
+#endif // __SEVMGR_BOM_SHARDEDEVENTQUEUEBACKEND_HPP
@@ -0,0 +1,442 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <exception>
+#include <limits>
+#include <sstream>
+#include <thread>
+// StdAir
+#include <stdair/basic/BasConst_Event.hpp>
+#include <stdair/bom/EventStruct.hpp>
+#include <stdair/service/Logger.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Exceptions.hpp>
+#include <sevmgr/bom/EventQueue.hpp>
+#include <sevmgr/bom/EventQueueBackend.hpp>
+#include <sevmgr/factory/FacEventQueueBackend.hpp>
+#include <sevmgr/command/ConservativeSynchroniser.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Worker of a partition: it holds the events of the partition,
+   * and hands them, in date-time order, to the event handler of the
+   * partition.
+   */
+  class ConservativeSynchroniser::PartitionWorker
+    : public PartitionEventScheduler {
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    PartitionWorker (ConservativeSynchroniser& ioSynchroniser,
+                     const PartitionIndex_T& iIndex,
+                     const EventQueueBackendType::EN_EventQueueBackendType& iType)
+      : _synchroniser (ioSynchroniser), _index (iIndex),
+        _backend (FacEventQueueBackend::create (iType)), _nextSequence (0),
+        _outboxList (ioSynchroniser._handlerList.size()),
+        _currentEvent_ptr (NULL),
+        _windowEnd (std::numeric_limits<stdair::LongDuration_T>::max()) {
+      assert (_backend != NULL);
+      for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+        _nbOfHandledEventsPerType[idx] = 0;
+      }
+    }
+
+    /** Destructor. */
+    ~PartitionWorker() {
+      delete _backend; _backend = NULL;
+    }
+
+  private:
+    /** Copy constructor (not to be used). */
+    PartitionWorker (const PartitionWorker&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the index of the partition. */
+    const PartitionIndex_T& getPartitionIndex() const {
+      return _index;
+    }
+
+    /** Get the date-time of the handled event. */
+    stdair::DateTime_T getCurrentTime() const {
+      assert (_currentEvent_ptr != NULL);
+      return _currentEvent_ptr->getEventTime();
+    }
+
+    /** Get the number of handled events of the given type. */
+    const stdair::Count_T&
+    getNbOfHandledEvents (const stdair::EventType::EN_EventType& iType) const {
+      return _nbOfHandledEventsPerType[iType];
+    }
+
+    /** Get the exception thrown while handling the events, if any. */
+    const std::exception_ptr& getException() const {
+      return _exception;
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /** Add the given event to the partition. */
+    void insertEvent (const stdair::EventStruct& iEventStruct) {
+      _backend->insert (iEventStruct, _nextSequence);
+      ++_nextSequence;
+    }
+
+    /** Schedule the given event (called by the event handler). */
+    void scheduleEvent (const stdair::EventStruct&);
+
+    /** Handle the events of the partition, until there is no more event. */
+    void run();
+
+    /**
+     * Give back the events not handled yet, i.e., the ones of the
+     * partition and the ones kept for the other partitions.
+     */
+    void transferEvents (EventStructList_T&);
+
+  private:
+    // ////////// Helpers /////////
+    /**
+     * Insert the events sent by the other partitions, and compute the
+     * lower bound of the date-time stamps of the events the partition
+     * may send to the others.
+     */
+    stdair::LongDuration_T receiveEvents();
+
+    /** Handle the events of the partition, up to the end of the window. */
+    void handleEvents();
+
+    /** Throw an exception telling that the given event may not be scheduled. */
+    void throwSchedulingException (const stdair::EventStruct&,
+                                   const std::string&) const;
+
+  private:
+    // ////////// Attributes /////////
+    /** Synchroniser, to which the worker belongs. */
+    ConservativeSynchroniser& _synchroniser;
+
+    /** Index of the partition. */
+    const PartitionIndex_T _index;
+
+    /** Events of the partition. */
+    EventQueueBackend* _backend;
+
+    /** Sequence number to be given to the next inserted event. */
+    EventSequence_T _nextSequence;
+
+    /** Events sent to the other partitions, indexed by partition. */
+    std::vector<EventStructList_T> _outboxList;
+
+    /** Number of handled events, for each event type. */
+    stdair::Count_T _nbOfHandledEventsPerType[stdair::EventType::LAST_VALUE];
+
+    /** Event being handled, and end (excluded) of the current window. */
+    const stdair::EventStruct* _currentEvent_ptr;
+    stdair::LongDuration_T _windowEnd;
+
+    /** Exception thrown while handling the events, if any. */
+    std::exception_ptr _exception;
+  };
+
+  // //////////////////////////////////////////////////////////////////////
+  void ConservativeSynchroniser::PartitionWorker::
+  throwSchedulingException (const stdair::EventStruct& iEventStruct,
+                            const std::string& iReason) const {
+    std::ostringstream oStr;
+    oStr << "The event '" << iEventStruct.describe() << "' cannot be "
+         << "scheduled by partition #" << _index << ": " << iReason;
+    throw EventQueueException (oStr.str());
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ConservativeSynchroniser::PartitionWorker::
+  scheduleEvent (const stdair::EventStruct& iEventStruct) {
+    assert (_currentEvent_ptr != NULL);
+    const stdair::LongDuration_T& lCurrentTimeStamp =
+      _currentEvent_ptr->getEventTimeStamp();
+    const stdair::LongDuration_T& lTimeStamp =
+      iEventStruct.getEventTimeStamp();
+    if (lTimeStamp < lCurrentTimeStamp) {
+      throwSchedulingException (iEventStruct,
+                                "it occurs before the handled event");
+    }
+
+    const PartitionIndex_T lPartition =
+      _synchroniser.getPartition (iEventStruct);
+    if (lPartition == _index) {
+      insertEvent (iEventStruct);
+      return;
+    }
+
+    // The events sent to the other partitions must respect the
+    // lookahead of the type of the handled event and, whatever that
+    // type, occur after the current window
+    const stdair::LongDuration_T& lLookahead =
+      _synchroniser.getLookahead (_currentEvent_ptr->getEventType());
+    if (lTimeStamp < lCurrentTimeStamp + lLookahead
+        || lTimeStamp < _windowEnd) {
+      throwSchedulingException (iEventStruct,
+                                "it does not respect the lookahead");
+    }
+    _outboxList[lPartition].push_back (iEventStruct);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::LongDuration_T ConservativeSynchroniser::PartitionWorker::
+  receiveEvents() {
+    // Insert the events sent by the other partitions during the last
+    // window, in the order of the sending partitions
+    const PartitionWorkerList_T& lWorkerList = _synchroniser._workerList;
+    for (PartitionWorkerList_T::const_iterator itWorker = lWorkerList.begin();
+         itWorker != lWorkerList.end(); ++itWorker) {
+      EventStructList_T& lInbox = (*itWorker)->_outboxList[_index];
+      for (EventStructList_T::const_iterator itEvent = lInbox.begin();
+           itEvent != lInbox.end(); ++itEvent) {
+        insertEvent (*itEvent);
+      }
+      lInbox.clear();
+    }
+
+    if (_backend->empty() == true) {
+      return std::numeric_limits<stdair::LongDuration_T>::max();
+    }
+
+    // The events of the partition will not send any event to the others
+    // before the date-time stamp of the next event plus the smallest
+    // lookahead of all the event types: within the window, the handlers
+    // may schedule local events of any type, which may in turn send
+    // events to the others
+    return (_backend->top().getEventTimeStamp()
+            + _synchroniser.getMinLookahead());
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ConservativeSynchroniser::PartitionWorker::handleEvents() {
+    PartitionEventHandler* lHandler_ptr = _synchroniser._handlerList[_index];
+    assert (lHandler_ptr != NULL);
+
+    stdair::EventStruct lEventStruct;
+    while (_backend->empty() == false
+           && _backend->top().getEventTimeStamp() < _windowEnd) {
+      _backend->pop (lEventStruct);
+      const stdair::EventType::EN_EventType& lType =
+        lEventStruct.getEventType();
+
+      _currentEvent_ptr = &lEventStruct;
+      lHandler_ptr->handle (lEventStruct, *this);
+      ++_nbOfHandledEventsPerType[lType];
+    }
+    _currentEvent_ptr = NULL;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ConservativeSynchroniser::PartitionWorker::run() {
+    PartitionBarrier& lBarrier = _synchroniser._barrier;
+
+    bool hasFailed = false;
+    while (true) {
+      // Receive the events of the other partitions, and agree with them
+      // on the end of the next window
+      const stdair::LongDuration_T lLowerBound = receiveEvents();
+      _windowEnd = lBarrier.reduce (lLowerBound, hasFailed);
+      if (hasFailed == true
+          || _windowEnd == std::numeric_limits<stdair::LongDuration_T>::max()) {
+        break;
+      }
+
+      // Handle the events of the window. A failure is reported to the
+      // other workers at the next meeting.
+      try {
+        handleEvents();
+
+      } catch (...) {
+        _exception = std::current_exception();
+        _currentEvent_ptr = NULL;
+        hasFailed = true;
+      }
+
+      // Wait for the other workers, before their events be received
+      lBarrier.wait();
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void ConservativeSynchroniser::PartitionWorker::
+  transferEvents (EventStructList_T& ioEventStructList) {
+    stdair::EventStruct lEventStruct;
+    while (_backend->empty() == false) {
+      _backend->pop (lEventStruct);
+      ioEventStructList.push_back (lEventStruct);
+    }
+    for (std::vector<EventStructList_T>::iterator itOutbox =
+           _outboxList.begin(); itOutbox != _outboxList.end(); ++itOutbox) {
+      ioEventStructList.insert (ioEventStructList.end(),
+                                itOutbox->begin(), itOutbox->end());
+      itOutbox->clear();
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  ConservativeSynchroniser::
+  ConservativeSynchroniser (EventQueue& ioEventQueue,
+                            const EventPartitioner& iPartitioner,
+                            const PartitionEventHandlerList_T& iHandlerList,
+                            const EventLookaheadMap_T& iLookaheadMap)
+    : _eventQueue (ioEventQueue), _partitioner (iPartitioner),
+      _handlerList (iHandlerList),
+      _minLookahead (std::numeric_limits<stdair::LongDuration_T>::max()),
+      _declaredTypeMask (ioEventQueue.getProgressStatusMask()),
+      _barrier (iHandlerList.empty() == true ? 1 : iHandlerList.size()) {
+
+    if (_handlerList.empty() == true) {
+      throw EventQueueException ("At least one partition (i.e., one event "
+                                 "handler) is needed");
+    }
+    for (PartitionEventHandlerList_T::const_iterator itHandler =
+           _handlerList.begin(); itHandler != _handlerList.end(); ++itHandler) {
+      if (*itHandler == NULL) {
+        throw EventQueueException ("Each partition needs an event handler");
+      }
+    }
+
+    // Convert the lookaheads into milliseconds
+    for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+      _lookaheadList[idx] = 0;
+    }
+    for (EventLookaheadMap_T::const_iterator itLookahead =
+           iLookaheadMap.begin(); itLookahead != iLookaheadMap.end();
+         ++itLookahead) {
+      const stdair::EventType::EN_EventType& lType = itLookahead->first;
+      const stdair::LongDuration_T lLookahead =
+        itLookahead->second.total_milliseconds();
+      if (lType >= stdair::EventType::LAST_VALUE || lLookahead <= 0) {
+        std::ostringstream oStr;
+        oStr << "The lookahead of the '" << stdair::EventType::getLabel (lType)
+             << "' event type must be strictly positive";
+        throw EventQueueException (oStr.str());
+      }
+      _lookaheadList[lType] = lLookahead;
+      if (lLookahead < _minLookahead) {
+        _minLookahead = lLookahead;
+      }
+    }
+
+    // Create the workers
+    const EventQueueBackendType::EN_EventQueueBackendType lBackendType =
+      _eventQueue.getBackendType();
+    for (PartitionIndex_T idx = 0; idx != _handlerList.size(); ++idx) {
+      _workerList.push_back (new PartitionWorker (*this, idx, lBackendType));
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  ConservativeSynchroniser::
+  ConservativeSynchroniser (const ConservativeSynchroniser& iSynchroniser)
+    : _eventQueue (iSynchroniser._eventQueue),
+      _partitioner (iSynchroniser._partitioner),
+      _handlerList (iSynchroniser._handlerList), _minLookahead (0),
+      _declaredTypeMask (0), _barrier (1) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  ConservativeSynchroniser::~ConservativeSynchroniser() {
+    for (PartitionWorkerList_T::iterator itWorker = _workerList.begin();
+         itWorker != _workerList.end(); ++itWorker) {
+      delete *itWorker;
+    }
+    _workerList.clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  PartitionIndex_T ConservativeSynchroniser::
+  getPartition (const stdair::EventStruct& iEventStruct) const {
+    const stdair::EventType::EN_EventType& lType = iEventStruct.getEventType();
+    if (lType >= stdair::EventType::LAST_VALUE
+        || (_declaredTypeMask & (static_cast<EventTypeMask_T> (1) << lType)) == 0
+        || _lookaheadList[lType] == 0) {
+      std::ostringstream oStr;
+      oStr << "The '" << stdair::EventType::getLabel (lType) << "' events "
+           << "cannot be simulated in parallel: that event type needs both "
+           << "a progress status and a lookahead";
+      throw EventQueueException (oStr.str());
+    }
+
+    const PartitionIndex_T oPartition =
+      _partitioner.getPartition (iEventStruct);
+    if (oPartition >= _workerList.size()) {
+      std::ostringstream oStr;
+      oStr << "The event '" << iEventStruct.describe() << "' is assigned "
+           << "to partition #" << oPartition << ", whereas there are only "
+           << _workerList.size() << " partitions";
+      throw EventQueueException (oStr.str());
+    }
+    return oPartition;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T ConservativeSynchroniser::run() {
+    // Spread the events of the event queue over the partitions
+    EventStructList_T lEventStructList;
+    _eventQueue.transferEvents (lEventStructList);
+    try {
+      for (EventStructList_T::const_iterator itEvent =
+             lEventStructList.begin(); itEvent != lEventStructList.end();
+           ++itEvent) {
+        const PartitionIndex_T lPartition = getPartition (*itEvent);
+        _workerList[lPartition]->insertEvent (*itEvent);
+      }
+
+    } catch (...) {
+      // Give the events back to the event queue
+      _eventQueue.addEvents (lEventStructList);
+      throw;
+    }
+    lEventStructList.clear();
+
+    // Run a worker per partition, the current thread taking the first one
+    std::vector<std::thread> lThreadList;
+    for (PartitionWorkerList_T::iterator itWorker = _workerList.begin() + 1;
+         itWorker != _workerList.end(); ++itWorker) {
+      lThreadList.push_back (std::thread (&PartitionWorker::run, *itWorker));
+    }
+    _workerList.front()->run();
+    for (std::vector<std::thread>::iterator itThread = lThreadList.begin();
+         itThread != lThreadList.end(); ++itThread) {
+      itThread->join();
+    }
+
+    // Account for the handled events, and give the other events (if the
+    // simulation has failed) back to the event queue
+    stdair::Count_T oNbOfHandledEvents = 0;
+    std::exception_ptr lException;
+    for (PartitionWorkerList_T::const_iterator itWorker = _workerList.begin();
+         itWorker != _workerList.end(); ++itWorker) {
+      PartitionWorker& lWorker = **itWorker;
+      for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE;
+           ++idx) {
+        const stdair::EventType::EN_EventType lType =
+          static_cast<stdair::EventType::EN_EventType> (idx);
+        const stdair::Count_T& lNbOfEvents = lWorker.getNbOfHandledEvents (lType);
+        if (lNbOfEvents != 0) {
+          _eventQueue.accountForEvents (lType, lNbOfEvents);
+          oNbOfHandledEvents += lNbOfEvents;
+        }
+      }
+      lWorker.transferEvents (lEventStructList);
+      if (lException == NULL && lWorker.getException() != NULL) {
+        lException = lWorker.getException();
+      }
+    }
+    _eventQueue.addEvents (lEventStructList);
+
+    if (lException != NULL) {
+      std::rethrow_exception (lException);
+    }
+    return oNbOfHandledEvents;
+  }
+
+}
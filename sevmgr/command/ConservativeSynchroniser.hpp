@@ -0,0 +1,140 @@
+#ifndef __SEVMGR_CMD_CONSERVATIVESYNCHRONISER_HPP
+#define __SEVMGR_CMD_CONSERVATIVESYNCHRONISER_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <vector>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_date_time_types.hpp>
+#include <stdair/basic/EventType.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Types.hpp>
+#include <sevmgr/SEVMGR_PartitionTypes.hpp>
+#include <sevmgr/bom/EventQueueTypes.hpp>
+#include <sevmgr/command/PartitionBarrier.hpp>
+
+namespace SEVMGR {
+
+  // Forward declarations
+  class EventQueue;
+
+  /**
+   * @brief Partitioned simulation of the events of an event queue,
+   * under a conservative synchronisation protocol.
+   *
+   * The events are spread over partitions (see EventPartitioner), each
+   * one being handled by its own worker (thread), with its own event
+   * handler, in date-time order. The workers proceed by windows: the
+   * end of the window is the lower bound of the date-time stamps of the
+   * events any partition may still send to another one, i.e., the
+   * minimum, over the partitions, of the date-time stamp of their next
+   * event plus the smallest lookahead of all the event types (as the
+   * handlers may schedule, within the window, local events of any type).
+   * Within a window, each worker handles its events independently;
+   * the events sent to the other partitions are kept aside, and
+   * delivered when all the workers have reached the end of the window.
+   *
+   * Hence, every worker gets its events in date-time order, exactly as
+   * with a single event queue, provided that the handlers respect the
+   * lookahead of the event types (which is checked).
+   */
+  class ConservativeSynchroniser {
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     *
+     * @param EventQueue& Event queue, the events of which are simulated.
+     * @param const EventPartitioner& Assignment of the events to the
+     *        partitions.
+     * @param const PartitionEventHandlerList_T& Event handlers, one per
+     *        partition.
+     * @param const EventLookaheadMap_T& Lookahead of each event type.
+     */
+    ConservativeSynchroniser (EventQueue&, const EventPartitioner&,
+                              const PartitionEventHandlerList_T&,
+                              const EventLookaheadMap_T&);
+    /** Destructor. */
+    ~ConservativeSynchroniser();
+
+  private:
+    /** Copy constructor (not to be used). */
+    ConservativeSynchroniser (const ConservativeSynchroniser&);
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Simulate all the events of the event queue, including the ones
+     * scheduled by the handlers, until there is no more event. The
+     * progress statuses of the event queue are updated accordingly.
+     *
+     * When a handler throws an exception, the workers stop at the end
+     * of the current window, the events not handled yet are given back
+     * to the event queue, and the exception is thrown again.
+     *
+     * @return stdair::Count_T Number of handled events.
+     */
+    stdair::Count_T run();
+
+  private:
+    // ////////// Helpers /////////
+    /** Worker of a partition (defined in the implementation file). */
+    class PartitionWorker;
+    friend class PartitionWorker;
+
+    /** List of workers, indexed by partition. */
+    typedef std::vector<PartitionWorker*> PartitionWorkerList_T;
+
+    /**
+     * Get the partition of the given event, after having checked that
+     * the event may be handled (its type has a lookahead and a progress
+     * status).
+     */
+    PartitionIndex_T getPartition (const stdair::EventStruct&) const;
+
+    /** Get the lookahead (in milliseconds) of the given event type. */
+    const stdair::LongDuration_T&
+    getLookahead (const stdair::EventType::EN_EventType& iType) const {
+      return _lookaheadList[iType];
+    }
+
+    /** Get the smallest lookahead (in milliseconds) of the event types. */
+    const stdair::LongDuration_T& getMinLookahead() const {
+      return _minLookahead;
+    }
+
+  private:
+    // ////////// Attributes /////////
+    /** Event queue, the events of which are simulated. */
+    EventQueue& _eventQueue;
+
+    /** Assignment of the events to the partitions. */
+    const EventPartitioner& _partitioner;
+
+    /** Event handlers, one per partition. */
+    const PartitionEventHandlerList_T& _handlerList;
+
+    /**
+     * Lookahead (in milliseconds) of each event type; zero when no
+     * lookahead has been given for that type.
+     */
+    stdair::LongDuration_T _lookaheadList[stdair::EventType::LAST_VALUE];
+
+    /** Smallest lookahead (in milliseconds) of the event types. */
+    stdair::LongDuration_T _minLookahead;
+
+    /** Event types which have a progress status in the event queue. */
+    EventTypeMask_T _declaredTypeMask;
+
+    /** Workers, one per partition. */
+    PartitionWorkerList_T _workerList;
+
+    /** Barrier on which the workers meet between two steps. */
+    PartitionBarrier _barrier;
+  };
+
+}
+#endif // __SEVMGR_CMD_CONSERVATIVESYNCHRONISER_HPP
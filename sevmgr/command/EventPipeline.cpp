@@ -0,0 +1,204 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <limits>
+#include <set>
+#include <sstream>
+#include <utility>
+// StdAir
+#include <stdair/basic/EventType.hpp>
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Exceptions.hpp>
+#include <sevmgr/bom/EventQueue.hpp>
+#include <sevmgr/command/EventPipeline.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  EventPipeline::EventPipeline (EventQueue& ioEventQueue,
+                                const PipelineEventGeneratorList_T& iGeneratorList,
+                                const stdair::Duration_T& iHorizon,
+                                const unsigned int& iBufferCapacity)
+    : _eventQueue (ioEventQueue), _generatorList (iGeneratorList),
+      _horizon (iHorizon.total_milliseconds()), _buffer (iBufferCapacity),
+      _generatedTimeStamp (std::numeric_limits<stdair::LongDuration_T>::min()),
+      _simulatedTimeStamp (std::numeric_limits<stdair::LongDuration_T>::min()),
+      _isStopping (false), _hasFailed (false) {
+    if (_horizon < 0) {
+      throw EventQueueException ("The generation horizon must be positive");
+    }
+    if (iBufferCapacity == 0) {
+      throw EventQueueException ("The capacity of the buffer must be "
+                                 "strictly positive");
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventPipeline::EventPipeline (const EventPipeline& iPipeline)
+    : _eventQueue (iPipeline._eventQueue),
+      _generatorList (iPipeline._generatorList), _horizon (0), _buffer (1),
+      _generatedTimeStamp (0), _simulatedTimeStamp (0),
+      _isStopping (false), _hasFailed (false) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventPipeline::~EventPipeline() {
+    stop();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventPipeline::stop() {
+    _isStopping.store (true, std::memory_order_relaxed);
+    if (_generationThread.joinable() == true) {
+      _generationThread.join();
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventPipeline::generate() {
+    try {
+      generateEvents();
+
+    } catch (...) {
+      _exception = std::current_exception();
+      _hasFailed.store (true, std::memory_order_release);
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventPipeline::generateEvents() {
+    // Next event of each generator, the generators being ordered by the
+    // date-time stamp of their next event (then by index)
+    typedef std::pair<stdair::LongDuration_T, std::size_t> NextEventKey_T;
+    std::set<NextEventKey_T> lNextEventKeySet;
+    std::vector<stdair::EventStruct> lNextEventList (_generatorList.size());
+    for (std::size_t idx = 0; idx != _generatorList.size(); ++idx) {
+      assert (_generatorList[idx] != NULL);
+      if (_generatorList[idx]->generateNextEvent (lNextEventList[idx]) == true) {
+        lNextEventKeySet.
+          insert (NextEventKey_T (lNextEventList[idx].getEventTimeStamp(),
+                                  idx));
+      }
+    }
+
+    while (lNextEventKeySet.empty() == false) {
+      // All the events earlier than the next one have been handed over
+      const NextEventKey_T lNextEventKey = *lNextEventKeySet.begin();
+      const stdair::LongDuration_T& lTimeStamp = lNextEventKey.first;
+      const std::size_t& lGeneratorIndex = lNextEventKey.second;
+      _generatedTimeStamp.store (lTimeStamp, std::memory_order_release);
+
+      // Wait for the simulation to come within the horizon
+      while (lTimeStamp - _horizon
+             > _simulatedTimeStamp.load (std::memory_order_acquire)) {
+        if (_isStopping.load (std::memory_order_relaxed) == true) {
+          return;
+        }
+        std::this_thread::yield();
+      }
+
+      // Hand the event over, waiting for room in the buffer if needed
+      while (_buffer.push (lNextEventList[lGeneratorIndex]) == false) {
+        if (_isStopping.load (std::memory_order_relaxed) == true) {
+          return;
+        }
+        std::this_thread::yield();
+      }
+
+      // Draw the next event of that generator
+      lNextEventKeySet.erase (lNextEventKeySet.begin());
+      stdair::EventStruct& lNextEvent = lNextEventList[lGeneratorIndex];
+      if (_generatorList[lGeneratorIndex]->generateNextEvent (lNextEvent)
+          == true) {
+        if (lNextEvent.getEventTimeStamp() < lTimeStamp) {
+          std::ostringstream oStr;
+          oStr << "The events of the generator #" << lGeneratorIndex
+               << " are not generated in chronological order: "
+               << lNextEvent.describe();
+          throw EventQueueException (oStr.str());
+        }
+        lNextEventKeySet.
+          insert (NextEventKey_T (lNextEvent.getEventTimeStamp(),
+                                  lGeneratorIndex));
+      }
+    }
+
+    // All the generators are exhausted
+    _generatedTimeStamp.store (std::numeric_limits<stdair::LongDuration_T>::max(),
+                               std::memory_order_release);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventPipeline::run (const EventHandlerRegistry& iRegistry) {
+    assert (_generationThread.joinable() == false);
+    _generationThread = std::thread (&EventPipeline::generate, this);
+
+    stdair::Count_T oNbOfHandledEvents = 0;
+
+    // The events added by the handlers are kept aside until the next
+    // extraction, so that the extracted event stays valid while handled
+    _eventQueue.setInsertionsDeferred (true);
+    try {
+
+      while (true) {
+        if (_hasFailed.load (std::memory_order_acquire) == true) {
+          std::rethrow_exception (_exception);
+        }
+
+        // The stamp is read before the buffer is emptied, so that all
+        // the events earlier than it are then in the event queue
+        const stdair::LongDuration_T lGeneratedTimeStamp =
+          _generatedTimeStamp.load (std::memory_order_acquire);
+        if (_buffer.popAll (_transferredEventList) != 0) {
+          _eventQueue.addEvents (_transferredEventList);
+          _transferredEventList.clear();
+        }
+
+        // Handle the next event, when no earlier event may come anymore
+        const stdair::EventStruct* lEventStruct_ptr = _eventQueue.peekEvent();
+        if (lEventStruct_ptr != NULL
+            && lEventStruct_ptr->getEventTimeStamp() < lGeneratedTimeStamp) {
+          _eventQueue.extractEvent (lEventStruct_ptr);
+          assert (lEventStruct_ptr != NULL);
+          _simulatedTimeStamp.store (lEventStruct_ptr->getEventTimeStamp(),
+                                     std::memory_order_release);
+          if (iRegistry.hasHandler (lEventStruct_ptr->getEventType()) == true) {
+            iRegistry.dispatch (*lEventStruct_ptr);
+            ++oNbOfHandledEvents;
+          }
+          continue;
+        }
+
+        // All the events have been generated and handled
+        if (lEventStruct_ptr == NULL
+            && lGeneratedTimeStamp
+            == std::numeric_limits<stdair::LongDuration_T>::max()) {
+          break;
+        }
+
+        // Let the generation go on beyond the horizon, up to the next
+        // event to be handled, and wait for it
+        if (lGeneratedTimeStamp
+            > _simulatedTimeStamp.load (std::memory_order_relaxed)) {
+          _simulatedTimeStamp.store (lGeneratedTimeStamp,
+                                     std::memory_order_release);
+        }
+        std::this_thread::yield();
+      }
+
+    } catch (...) {
+      _eventQueue.setInsertionsDeferred (false);
+      stop();
+      throw;
+    }
+    _eventQueue.setInsertionsDeferred (false);
+    stop();
+
+    return oNbOfHandledEvents;
+  }
+
+}
@@ -0,0 +1,132 @@
+#ifndef __SEVMGR_CMD_EVENTPIPELINE_HPP
+#define __SEVMGR_CMD_EVENTPIPELINE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <atomic>
+#include <exception>
+#include <thread>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_date_time_types.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_PipelineTypes.hpp>
+#include <sevmgr/SEVMGR_DispatchTypes.hpp>
+#include <sevmgr/bom/EventQueueTypes.hpp>
+#include <sevmgr/bom/EventRingBuffer.hpp>
+
+namespace SEVMGR {
+
+  // Forward declarations
+  class EventQueue;
+
+  /**
+   * @brief Pipelined simulation: the events are generated by a
+   * background thread, ahead of the simulation thread handling them.
+   *
+   * The generation thread keeps the next event of each generator, and
+   * hands the earliest one over to the simulation thread, through a
+   * lock-free buffer (see EventRingBuffer), as long as it does not lie
+   * beyond the given horizon after the simulated date-time. It publishes
+   * the date-time stamp of the earliest event still to be handed over:
+   * all the earlier events are in the buffer (or already in the queue),
+   * so that the simulation thread may handle them safely.
+   *
+   * The simulation thread moves the buffered events into the event
+   * queue, and handles the next event as soon as it is earlier than
+   * that published stamp; otherwise, it lets the generation thread go
+   * beyond the horizon, and waits for it.
+   */
+  class EventPipeline {
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     *
+     * @param EventQueue& Event queue, in which the events are handled.
+     * @param const PipelineEventGeneratorList_T& Event generators.
+     * @param const stdair::Duration_T& Horizon of the generation, ahead
+     *        of the simulated date-time.
+     * @param const unsigned int& Capacity of the buffer.
+     */
+    EventPipeline (EventQueue&, const PipelineEventGeneratorList_T&,
+                   const stdair::Duration_T& iHorizon,
+                   const unsigned int& iBufferCapacity);
+    /** Destructor. The generation thread, if any, is stopped. */
+    ~EventPipeline();
+
+  private:
+    /** Copy constructor (not to be used). */
+    EventPipeline (const EventPipeline&);
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Generate and handle all the events, until all the generators are
+     * exhausted and the event queue is empty. Each event is given, in
+     * place, to the handler registered for its type, if any (otherwise,
+     * it is dropped).
+     *
+     * When a generator or a handler throws an exception, the generation
+     * is stopped, and the exception is thrown again.
+     *
+     * @return stdair::Count_T Number of events given to the handlers.
+     */
+    stdair::Count_T run (const EventHandlerRegistry&);
+
+  private:
+    // ////////// Helpers /////////
+    /** Main loop of the generation thread. */
+    void generate();
+
+    /** Generate the events, until exhausted or stopped. */
+    void generateEvents();
+
+    /** Stop the generation thread, and wait for it. */
+    void stop();
+
+  private:
+    // ////////// Attributes /////////
+    /** Event queue, in which the events are handled. */
+    EventQueue& _eventQueue;
+
+    /** Event generators. */
+    const PipelineEventGeneratorList_T& _generatorList;
+
+    /** Horizon of the generation (in milliseconds). */
+    const stdair::LongDuration_T _horizon;
+
+    /** Buffer between the generation and simulation threads. */
+    EventRingBuffer _buffer;
+
+    /** Events moved from the buffer into the queue. */
+    EventStructList_T _transferredEventList;
+
+    /** Generation thread. */
+    std::thread _generationThread;
+
+    /**
+     * Date-time stamp of the earliest event still to be handed over by
+     * the generation thread (the largest stamp once all the generators
+     * are exhausted).
+     */
+    std::atomic<stdair::LongDuration_T> _generatedTimeStamp;
+
+    /**
+     * Simulated date-time stamp, from which the generation horizon is
+     * counted.
+     */
+    std::atomic<stdair::LongDuration_T> _simulatedTimeStamp;
+
+    /** Whether the generation thread has to stop. */
+    std::atomic<bool> _isStopping;
+
+    /** Exception thrown by a generator, if any. */
+    std::atomic<bool> _hasFailed;
+    std::exception_ptr _exception;
+  };
+
+}
+#endif // __SEVMGR_CMD_EVENTPIPELINE_HPP
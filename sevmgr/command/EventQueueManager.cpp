@@ -3,12 +3,14 @@
 // //////////////////////////////////////////////////////////////////////
 // STL
 #include <cassert>
+#include <limits>
 // Boost
 #include <boost/make_shared.hpp>
 // StdAir
 #include <stdair/basic/ProgressStatusSet.hpp>
 #include <stdair/basic/EventType.hpp>
 #include <stdair/basic/BasConst_Event.hpp>
+#include <stdair/basic/BasChronometer.hpp>
 #include <stdair/bom/BomManager.hpp>
 #include <stdair/bom/EventStruct.hpp>
 #include <stdair/bom/BookingRequestStruct.hpp>
@@ -16,7 +18,12 @@
 #include <stdair/service/Logger.hpp>
 #include <stdair/STDAIR_Service.hpp>
 // SEvMgr
+#include <sevmgr/basic/BasConst_EventQueueManager.hpp>
 #include <sevmgr/bom/EventQueue.hpp>
+#include <sevmgr/command/ConservativeSynchroniser.hpp>
+#include <sevmgr/command/OptimisticSynchroniser.hpp>
+#include <sevmgr/command/EventWindowExecutor.hpp>
+#include <sevmgr/command/EventPipeline.hpp>
 #include <sevmgr/command/EventQueueManager.hpp>
 
 namespace SEVMGR {
@@ -123,6 +130,48 @@ namespace SEVMGR {
     ioEventQueue.reset();
   } 
 
+  // ////////////////////////////////////////////////////////////////////
+  void EventQueueManager::
+  setBackendType (EventQueue& ioEventQueue,
+                  const EventQueueBackendType::EN_EventQueueBackendType& iType) {
+
+    /**
+     * Switch the storage backend of the EventQueue object.
+     */
+    ioEventQueue.setBackendType (iType);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  EventQueueBackendType::EN_EventQueueBackendType EventQueueManager::
+  getBackendType (const EventQueue& iEventQueue) {
+    return iEventQueue.getBackendType();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void EventQueueManager::setMultiProducer (EventQueue& ioEventQueue,
+                                            const bool& iIsMultiProducer) {
+
+    /**
+     * Switch the EventQueue object to (or from) the multi-producer mode.
+     */
+    ioEventQueue.setMultiProducer (iIsMultiProducer);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  bool EventQueueManager::isMultiProducer (const EventQueue& iEventQueue) {
+    return iEventQueue.isMultiProducer();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void EventQueueManager::setTimeIndexed (EventQueue& ioEventQueue,
+                                          const bool& iIsTimeIndexed) {
+
+    /**
+     * Switch the date-time index of the EventQueue object on (or off).
+     */
+    ioEventQueue.setTimeIndexed (iIsTimeIndexed);
+  }
+
   // ////////////////////////////////////////////////////////////////////
   bool EventQueueManager::
   hasProgressStatus (const EventQueue& iEventQueue,
@@ -138,15 +187,65 @@ namespace SEVMGR {
   }
 
   // ////////////////////////////////////////////////////////////////////
-  void EventQueueManager::addEvent (EventQueue& ioEventQueue,
-                                     stdair::EventStruct& iEventStruct) {
+  EventHandle EventQueueManager::
+  addEvent (EventQueue& ioEventQueue, const stdair::EventStruct& iEventStruct) {
 
     /**
      * Add the event to the event queue.
      */
-    ioEventQueue.addEvent(iEventStruct);
+    return ioEventQueue.addEvent(iEventStruct);
   } 
 
+  // //////////////////////////////////////////////////////////////////////
+  bool EventQueueManager::cancelEvent (EventQueue& ioEventQueue,
+                                       const EventHandle& iEventHandle) {
+
+    const bool hasBeenCancelled = ioEventQueue.cancelEvent (iEventHandle);
+
+    // DEBUG
+    if (hasBeenCancelled == false) {
+      STDAIR_LOG_DEBUG ("The event to be cancelled (sequence number "
+                        << iEventHandle.getSequence() << ") is no longer "
+                        << "within the event queue");
+    }
+
+    return hasBeenCancelled;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventHandle EventQueueManager::
+  rescheduleEvent (EventQueue& ioEventQueue, const EventHandle& iEventHandle,
+                   const stdair::EventStruct& iEventStruct) {
+
+    const EventHandle oEventHandle =
+      ioEventQueue.rescheduleEvent (iEventHandle, iEventStruct);
+
+    // DEBUG
+    if (oEventHandle.isValid() == false) {
+      STDAIR_LOG_DEBUG ("The event to be rescheduled (sequence number "
+                        << iEventHandle.getSequence() << ") is no longer "
+                        << "within the event queue");
+    }
+
+    return oEventHandle;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool EventQueueManager::isEventQueued (const EventQueue& iEventQueue,
+                                         const EventHandle& iEventHandle) {
+    return iEventQueue.isEventQueued (iEventHandle);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventQueueManager::addEvents (EventQueue& ioEventQueue,
+                                     const EventStructList_T& iEventStructList) {
+
+    /**
+     * Add the events, in one go, to the event queue.
+     */
+    ioEventQueue.addEvents (iEventStructList);
+  }
+
   // //////////////////////////////////////////////////////////////////////
   const std::string EventQueueManager::
   list (const EventQueue& iEventQueue) {
@@ -222,6 +321,259 @@ namespace SEVMGR {
     return stdair::ProgressStatusSet(stdair::EventType::BKG_REQ);
   }
 
+  // ////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet EventQueueManager::
+  extractEvent (EventQueue& ioEventQueue,
+                const stdair::EventStruct*& oEventStruct_ptr) {
+
+    /**
+     * Extract the first event from the queue
+     */
+    const stdair::ProgressStatusSet& lProgressStatusSet =
+      ioEventQueue.extractEvent (oEventStruct_ptr);
+    assert (oEventStruct_ptr != NULL);
+
+    // DEBUG
+    std::ostringstream oEventStr;
+    oEventStr << "Extracted event: '" << oEventStruct_ptr->describe() << "'.";
+    STDAIR_LOG_DEBUG (oEventStr.str());
+
+    //
+    return lProgressStatusSet;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const stdair::EventStruct* EventQueueManager::
+  peekEvent (EventQueue& ioEventQueue) {
+    return ioEventQueue.peekEvent();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::DateTime_T EventQueueManager::
+  getNextEventDateTime (EventQueue& ioEventQueue) {
+    return ioEventQueue.getNextEventDateTime();
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  EventBrowserPtr_T EventQueueManager::
+  browseEvents (EventQueue& ioEventQueue,
+                const stdair::DateTime_T& iHorizonDateTime) {
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Browse the events up to " << iHorizonDateTime);
+
+    // The browser is released along with the returned pointer
+    return EventBrowserPtr_T (ioEventQueue.createBrowser (iHorizonDateTime));
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  EventBrowserPtr_T EventQueueManager::
+  browseEvents (EventQueue& ioEventQueue,
+                const stdair::DateTime_T& iFromDateTime,
+                const stdair::DateTime_T& iToDateTime) {
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Browse the events from " << iFromDateTime
+                      << " to " << iToDateTime);
+
+    // The browser is released along with the returned pointer
+    return EventBrowserPtr_T (ioEventQueue.createBrowser (iFromDateTime,
+                                                          iToDateTime));
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  EventBrowserPtr_T EventQueueManager::
+  browseEvents (EventQueue& ioEventQueue,
+                const stdair::DateTime_T& iFromDateTime,
+                const stdair::DateTime_T& iToDateTime,
+                const stdair::EventType::EN_EventType& iEventType) {
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Browse the " << stdair::EventType::getLabel (iEventType)
+                      << " events from " << iFromDateTime
+                      << " to " << iToDateTime);
+
+    // The browser is released along with the returned pointer
+    return EventBrowserPtr_T (ioEventQueue.createBrowser (iFromDateTime,
+                                                          iToDateTime,
+                                                          iEventType));
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueManager::
+  countEvents (EventQueue& ioEventQueue,
+               const stdair::DateTime_T& iFromDateTime,
+               const stdair::DateTime_T& iToDateTime) {
+    return ioEventQueue.countEvents (iFromDateTime, iToDateTime);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueManager::
+  countEvents (EventQueue& ioEventQueue,
+               const stdair::DateTime_T& iFromDateTime,
+               const stdair::DateTime_T& iToDateTime,
+               const stdair::EventType::EN_EventType& iEventType) {
+    return ioEventQueue.countEvents (iFromDateTime, iToDateTime, iEventType);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet EventQueueManager::
+  popEvents (EventQueue& ioEventQueue,
+             EventStructList_T& ioEventStructList,
+             const stdair::Count_T& iMaxNbOfEvents) {
+
+    /**
+     * Extract the first events from the queue
+     */
+    const EventStructList_T::size_type lInitialSize = ioEventStructList.size();
+    const stdair::ProgressStatusSet& lProgressStatusSet =
+      ioEventQueue.popEvents (ioEventStructList, iMaxNbOfEvents);
+
+    // DEBUG
+    std::ostringstream oEventStr;
+    oEventStr << "Poped " << ioEventStructList.size() - lInitialSize
+              << " event(s), out of at most " << iMaxNbOfEvents << ".";
+    STDAIR_LOG_DEBUG (oEventStr.str());
+
+    //
+    return lProgressStatusSet;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet EventQueueManager::
+  popEventsUntil (EventQueue& ioEventQueue,
+                  EventStructList_T& ioEventStructList,
+                  const stdair::DateTime_T& iDateTime) {
+
+    /**
+     * Extract the events occurring up to the given date-time
+     */
+    const EventStructList_T::size_type lInitialSize = ioEventStructList.size();
+    const stdair::ProgressStatusSet& lProgressStatusSet =
+      ioEventQueue.popEventsUntil (ioEventStructList, iDateTime);
+
+    // DEBUG
+    std::ostringstream oEventStr;
+    oEventStr << "Poped " << ioEventStructList.size() - lInitialSize
+              << " event(s), up to " << iDateTime << ".";
+    STDAIR_LOG_DEBUG (oEventStr.str());
+
+    //
+    return lProgressStatusSet;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueManager::
+  skipEventsBefore (EventQueue& ioEventQueue,
+                    const stdair::DateTime_T& iDateTime) {
+
+    /**
+     * Remove the events occurring before the given date-time
+     */
+    const stdair::Count_T lNbOfSkippedEvents =
+      ioEventQueue.skipEventsBefore (iDateTime);
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Skipped " << lNbOfSkippedEvents
+                      << " event(s), before " << iDateTime << ".");
+
+    //
+    return lNbOfSkippedEvents;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueManager::
+  popEventsBefore (EventQueue& ioEventQueue,
+                   EventStructList_T& ioEventStructList,
+                   const stdair::DateTime_T& iDateTime) {
+
+    /**
+     * Extract the events occurring before the given date-time
+     */
+    const stdair::Count_T lNbOfPoppedEvents =
+      ioEventQueue.popEventsBefore (ioEventStructList, iDateTime);
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Poped " << lNbOfPoppedEvents
+                      << " event(s), before " << iDateTime << ".");
+
+    //
+    return lNbOfPoppedEvents;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueManager::
+  runPartitioned (EventQueue& ioEventQueue,
+                  const EventPartitioner& iPartitioner,
+                  const PartitionEventHandlerList_T& iHandlerList,
+                  const EventLookaheadMap_T& iLookaheadMap) {
+
+    /**
+     * Simulate the events, each partition on its own thread
+     */
+    ConservativeSynchroniser lSynchroniser (ioEventQueue, iPartitioner,
+                                            iHandlerList, iLookaheadMap);
+    const stdair::Count_T lNbOfHandledEvents = lSynchroniser.run();
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Handled " << lNbOfHandledEvents << " event(s) over "
+                      << iHandlerList.size() << " partition(s).");
+
+    //
+    return lNbOfHandledEvents;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueManager::
+  runOptimistic (EventQueue& ioEventQueue,
+                 const EventPartitioner& iPartitioner,
+                 const PartitionEventHandlerList_T& iHandlerList,
+                 const PartitionStateHandlerList_T& iStateHandlerList,
+                 const stdair::Count_T& iCheckpointPeriod,
+                 const stdair::Count_T& iGVTPeriod) {
+
+    /**
+     * Simulate the events speculatively, each partition on its own thread
+     */
+    OptimisticSynchroniser lSynchroniser (ioEventQueue, iPartitioner,
+                                          iHandlerList, iStateHandlerList,
+                                          iCheckpointPeriod, iGVTPeriod);
+    const stdair::Count_T lNbOfHandledEvents = lSynchroniser.run();
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Handled " << lNbOfHandledEvents << " event(s) over "
+                      << iHandlerList.size() << " partition(s), with "
+                      << lSynchroniser.getNbOfRollbacks() << " rollback(s).");
+
+    //
+    return lNbOfHandledEvents;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueManager::
+  runWindowed (EventQueue& ioEventQueue,
+               const stdair::Duration_T& iWindowLength,
+               const EventConflictKeyExtractor& iConflictKeyExtractor,
+               ConcurrentEventHandler& ioHandler,
+               const unsigned int& iNbOfThreads) {
+
+    /**
+     * Simulate the events window by window, on a pool of threads
+     */
+    EventWindowExecutor lExecutor (ioEventQueue, iWindowLength,
+                                   iConflictKeyExtractor, ioHandler,
+                                   iNbOfThreads);
+    const stdair::Count_T lNbOfHandledEvents = lExecutor.run();
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Handled " << lNbOfHandledEvents << " event(s) over "
+                      << lExecutor.getNbOfWindows() << " window(s), with "
+                      << iNbOfThreads << " thread(s).");
+
+    //
+    return lNbOfHandledEvents;
+  }
+
   // ////////////////////////////////////////////////////////////////////
   void EventQueueManager::run (EventQueue& ioEventQueue,
                                stdair::EventStruct& iEventStruct) {
@@ -242,6 +594,170 @@ namespace SEVMGR {
 
   }
 
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueManager::
+  run (EventQueue& ioEventQueue, const EventHandlerRegistry& iRegistry) {
+
+    stdair::Count_T oNbOfHandledEvents = 0;
+
+    // The events added by the handlers are kept aside until the next
+    // extraction, so that the extracted event stays valid while handled
+    ioEventQueue.setInsertionsDeferred (true);
+    try {
+
+      while (ioEventQueue.isQueueDone() == false) {
+        /**
+         * Extract the first event from the queue, without copying it
+         */
+        const stdair::EventStruct* lEventStruct_ptr = NULL;
+        ioEventQueue.extractEvent (lEventStruct_ptr);
+        assert (lEventStruct_ptr != NULL);
+        const stdair::EventType::EN_EventType lEventType =
+          lEventStruct_ptr->getEventType();
+
+        /**
+         * Give it to its handler, if any. Otherwise, it is dropped; a
+         * break point without handler stops the run.
+         */
+        if (iRegistry.hasHandler (lEventType) == true) {
+          iRegistry.dispatch (*lEventStruct_ptr);
+          ++oNbOfHandledEvents;
+
+        } else if (lEventType == stdair::EventType::BRK_PT) {
+          break;
+        }
+      }
+
+    } catch (...) {
+      ioEventQueue.setInsertionsDeferred (false);
+      throw;
+    }
+    ioEventQueue.setInsertionsDeferred (false);
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Dispatched " << oNbOfHandledEvents << " event(s).");
+
+    //
+    return oNbOfHandledEvents;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  RunReport EventQueueManager::
+  run (EventQueue& ioEventQueue, const EventHandlerRegistry& iRegistry,
+       const RunStopCondition& iStopCondition) {
+
+    stdair::BasChronometer lRunChronometer;
+    lRunChronometer.start();
+
+    // Date-time stamp up to which (included) the events are played
+    stdair::LongDuration_T lUntilDateTimeStamp =
+      std::numeric_limits<stdair::LongDuration_T>::max();
+    if (iStopCondition.hasUntilDateTime() == true) {
+      const stdair::Duration_T lDuration =
+        iStopCondition.getUntilDateTime()
+        - stdair::DEFAULT_EVENT_OLDEST_DATETIME;
+      lUntilDateTimeStamp = lDuration.total_milliseconds();
+    }
+    const stdair::Count_T& lMaxNbOfEvents = iStopCondition.getMaxNbOfEvents();
+    const bool hasStopEventTypes = iStopCondition.getStopEventTypeSet().any();
+    const bool hasPredicate = iStopCondition.hasPredicate();
+
+    stdair::Count_T lNbOfEvents = 0;
+    stdair::Count_T lNbOfHandledEvents = 0;
+    RunStopReason::EN_RunStopReason lStopReason = RunStopReason::QUEUE_DONE;
+
+    // The events added by the handlers are kept aside until the next
+    // extraction, so that the extracted event stays valid while handled
+    ioEventQueue.setInsertionsDeferred (true);
+    try {
+
+      while (true) {
+        if (lNbOfEvents >= lMaxNbOfEvents) {
+          lStopReason = RunStopReason::EVENT_COUNT;
+          break;
+        }
+
+        // Leave the next event within the queue when it is too late
+        const stdair::EventStruct* lEventStruct_ptr = ioEventQueue.peekEvent();
+        if (lEventStruct_ptr == NULL) {
+          lStopReason = RunStopReason::QUEUE_DONE;
+          break;
+        }
+        if (lEventStruct_ptr->getEventTimeStamp() > lUntilDateTimeStamp) {
+          lStopReason = RunStopReason::DATE_TIME;
+          break;
+        }
+
+        /**
+         * Extract the first event from the queue, without copying it,
+         * and give it to its handler, if any
+         */
+        ioEventQueue.extractEvent (lEventStruct_ptr);
+        assert (lEventStruct_ptr != NULL);
+        ++lNbOfEvents;
+        const stdair::EventType::EN_EventType lEventType =
+          lEventStruct_ptr->getEventType();
+        if (iRegistry.hasHandler (lEventType) == true) {
+          iRegistry.dispatch (*lEventStruct_ptr);
+          ++lNbOfHandledEvents;
+        }
+
+        // Check the conditions on the played event
+        if (hasStopEventTypes == true
+            && iStopCondition.isStopEventType (lEventType) == true) {
+          lStopReason = RunStopReason::EVENT_TYPE;
+          break;
+        }
+        if (hasPredicate == true
+            && iStopCondition.checkPredicate (*lEventStruct_ptr) == true) {
+          lStopReason = RunStopReason::PREDICATE;
+          break;
+        }
+      }
+
+    } catch (...) {
+      ioEventQueue.setInsertionsDeferred (false);
+      throw;
+    }
+    ioEventQueue.setInsertionsDeferred (false);
+
+    const RunReport oRunReport (lNbOfEvents, lNbOfHandledEvents,
+                                lRunChronometer.elapsed(), lStopReason);
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Played " << lNbOfEvents << " event(s), among which "
+                      << lNbOfHandledEvents << " were dispatched, in "
+                      << oRunReport.getElapsedTime() << " s; stopped on: "
+                      << RunStopReason::getLabel (lStopReason) << ".");
+
+    //
+    return oRunReport;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueManager::
+  runPipelined (EventQueue& ioEventQueue,
+                const PipelineEventGeneratorList_T& iGeneratorList,
+                const stdair::Duration_T& iHorizon,
+                const EventHandlerRegistry& iRegistry) {
+
+    /**
+     * Generate the events on a background thread, and handle them on
+     * the calling one
+     */
+    EventPipeline lPipeline (ioEventQueue, iGeneratorList, iHorizon,
+                             DEFAULT_EVENT_PIPELINE_BUFFER_CAPACITY);
+    const stdair::Count_T lNbOfHandledEvents = lPipeline.run (iRegistry);
+
+    // DEBUG
+    STDAIR_LOG_DEBUG ("Dispatched " << lNbOfHandledEvents << " event(s), "
+                      << "generated by " << iGeneratorList.size()
+                      << " generator(s) in the background.");
+
+    //
+    return lNbOfHandledEvents;
+  }
+
   // ////////////////////////////////////////////////////////////////////
   bool EventQueueManager::select (EventQueue& ioEventQueue,
                                   stdair::EventStruct& iEventStruct,
@@ -257,23 +773,36 @@ namespace SEVMGR {
     }
     assert (hasResearchBeenSuccessful == true);
 
-    // Default date time
-    stdair::DateTime_T lDateTime = stdair::DEFAULT_EVENT_OLDEST_DATETIME;
-
-    // While the event with the given key has not been retrieved, keep on
-    // extracting events
-    while (ioEventQueue.isQueueDone() == false
-           && lDateTime != iDateTime) {
-      ioEventQueue.popEvent (iEventStruct);
-      lDateTime = iEventStruct.getEventTime ();
-           
-    }
+    // Remove all the earlier events in one go: the first remaining
+    // event is then the one with the given key
+    ioEventQueue.skipEventsBefore (iDateTime);
+    assert (ioEventQueue.isQueueDone() == false);
+    ioEventQueue.popEvent (iEventStruct);
 
-    assert (lDateTime == iDateTime);
+    assert (iEventStruct.getEventTime() == iDateTime);
     return hasResearchBeenSuccessful;
 
   }
 
+  // ////////////////////////////////////////////////////////////////////
+  bool EventQueueManager::seek (EventQueue& ioEventQueue,
+                                stdair::EventStruct& iEventStruct,
+                                const stdair::DateTime_T& iDateTime) {
+
+    // Remove all the events occurring before the given date time
+    skipEventsBefore (ioEventQueue, iDateTime);
+
+    // If no event is left, return
+    if (ioEventQueue.isQueueDone() == true) {
+      return false;
+    }
+
+    // The first remaining event is the one at, or after, the date time
+    ioEventQueue.popEvent (iEventStruct);
+    assert (iEventStruct.getEventTime() >= iDateTime);
+    return true;
+  }
+
   // ////////////////////////////////////////////////////////////////////
   void EventQueueManager::
   updateStatus (EventQueue& ioEventQueue,
@@ -325,6 +854,20 @@ namespace SEVMGR {
     return lQueueSize;
   }  
 
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventQueueManager::
+  getQueueSize (const EventQueue& iEventQueue,
+                const stdair::EventType::EN_EventType& iEventType) {
+
+    /**
+     * Count the events of the given type
+     */
+    const stdair::Count_T lQueueSize = iEventQueue.getQueueSize (iEventType);
+
+    //
+    return lQueueSize;
+  }
+
   // ////////////////////////////////////////////////////////////////////
   const stdair::Count_T& EventQueueManager::
   getExpectedTotalNumberOfEventsToBeGenerated (const EventQueue& ioEventQueue) {
@@ -408,4 +951,25 @@ namespace SEVMGR {
 
   }
  
+  //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatus EventQueueManager::
+  getMonitoredStatus (const EventQueue& iEventQueue) {
+
+    // Read the progress status published towards the monitor
+    const ProgressStatusMonitor& lProgressMonitor =
+      iEventQueue.getProgressMonitor();
+    return lProgressMonitor.getStatus();
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet EventQueueManager::
+  getMonitoredStatus (const EventQueue& iEventQueue,
+                      const stdair::EventType::EN_EventType& iEventType) {
+
+    // Read the progress statuses published towards the monitor
+    const ProgressStatusMonitor& lProgressMonitor =
+      iEventQueue.getProgressMonitor();
+    return lProgressMonitor.getStatusSet (iEventType);
+  }
+
 }
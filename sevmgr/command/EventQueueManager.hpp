@@ -10,9 +10,16 @@
 #include <stdair/stdair_service_types.hpp>
 // SEvMgr
 #include <sevmgr/SEVMGR_Types.hpp>
+#include <sevmgr/SEVMGR_PartitionTypes.hpp>
+#include <sevmgr/SEVMGR_ConcurrentTypes.hpp>
+#include <sevmgr/SEVMGR_DispatchTypes.hpp>
+#include <sevmgr/SEVMGR_PipelineTypes.hpp>
+#include <sevmgr/SEVMGR_RunTypes.hpp>
+#include <sevmgr/SEVMGR_BrowserTypes.hpp>
 
 // Forward declarations
 namespace stdair {
+  struct ProgressStatus;
   struct ProgressStatusSet;
 }
 
@@ -46,10 +53,62 @@ namespace SEVMGR {
      */
     static void reset (EventQueue&);
 
+    /**
+     * Set the type of the storage backend of the event queue.
+     */
+    static void setBackendType (EventQueue&,
+                                const EventQueueBackendType::EN_EventQueueBackendType&);
+
+    /**
+     * Get the type of the storage backend of the event queue.
+     */
+    static EventQueueBackendType::EN_EventQueueBackendType
+    getBackendType (const EventQueue&);
+
+    /**
+     * Set whether the events may be added from several threads.
+     */
+    static void setMultiProducer (EventQueue&, const bool&);
+
+    /**
+     * State whether the events may be added from several threads.
+     */
+    static bool isMultiProducer (const EventQueue&);
+
+    /**
+     * Set whether the events are indexed by date-time.
+     */
+    static void setTimeIndexed (EventQueue&, const bool&);
+
     /**
      * Add an event the event queue.
+     *
+     * @return EventHandle Handle on the added event.
      */
-    static void addEvent (EventQueue&, stdair::EventStruct&);
+    static EventHandle addEvent (EventQueue&, const stdair::EventStruct&);
+
+    /**
+     * Cancel the event referred to by the given handle, if still queued.
+     */
+    static bool cancelEvent (EventQueue&, const EventHandle&);
+
+    /**
+     * Replace the event referred to by the given handle, if still
+     * queued, by the given one.
+     */
+    static EventHandle rescheduleEvent (EventQueue&, const EventHandle&,
+                                        const stdair::EventStruct&);
+
+    /**
+     * State whether the event referred to by the given handle is still
+     * within the event queue.
+     */
+    static bool isEventQueued (const EventQueue&, const EventHandle&);
+
+    /**
+     * Add a list (batch) of events to the event queue.
+     */
+    static void addEvents (EventQueue&, const EventStructList_T&);
 
     /**
      * Describe the event queue key
@@ -73,11 +132,180 @@ namespace SEVMGR {
     static stdair::ProgressStatusSet popEvent (EventQueue&,
                                                stdair::EventStruct&);
 
+    /**
+     * Extract the first event from the queue, without copying it.
+     */
+    static stdair::ProgressStatusSet extractEvent (EventQueue&,
+                                                   const stdair::EventStruct*&);
+
+    /**
+     * Give access to the first event of the queue, without removing it.
+     */
+    static const stdair::EventStruct* peekEvent (EventQueue&);
+
+    /**
+     * Get the date-time of the first event of the queue (not-a-date-time
+     * when the queue is empty).
+     */
+    static stdair::DateTime_T getNextEventDateTime (EventQueue&);
+
+    /**
+     * Create a browser of the first events of the queue, up to the
+     * given date-time.
+     */
+    static EventBrowserPtr_T browseEvents (EventQueue&,
+                                           const stdair::DateTime_T&);
+
+    /**
+     * Create a browser of the events of the queue, within the given
+     * date-time range [from, to).
+     */
+    static EventBrowserPtr_T browseEvents (EventQueue&,
+                                           const stdair::DateTime_T&,
+                                           const stdair::DateTime_T&);
+
+    /**
+     * Create a browser of the events of the given type, within the given
+     * date-time range [from, to).
+     */
+    static EventBrowserPtr_T
+    browseEvents (EventQueue&, const stdair::DateTime_T&,
+                  const stdair::DateTime_T&,
+                  const stdair::EventType::EN_EventType&);
+
+    /**
+     * Get the number of events of the queue, within the given date-time
+     * range [from, to).
+     */
+    static stdair::Count_T countEvents (EventQueue&,
+                                        const stdair::DateTime_T&,
+                                        const stdair::DateTime_T&);
+
+    /**
+     * Get the number of events of the given type, within the given
+     * date-time range [from, to).
+     */
+    static stdair::Count_T countEvents (EventQueue&,
+                                        const stdair::DateTime_T&,
+                                        const stdair::DateTime_T&,
+                                        const stdair::EventType::EN_EventType&);
+
+    /**
+     * Extract (at most) the given number of first events from the queue,
+     * and append them to the given list.
+     */
+    static stdair::ProgressStatusSet popEvents (EventQueue&,
+                                                EventStructList_T&,
+                                                const stdair::Count_T&);
+
+    /**
+     * Extract all the events occurring at, or before, the given
+     * date-time from the queue, and append them to the given list.
+     */
+    static stdair::ProgressStatusSet popEventsUntil (EventQueue&,
+                                                     EventStructList_T&,
+                                                     const stdair::DateTime_T&);
+
+    /**
+     * Remove, in one go, all the events occurring strictly before the
+     * given date-time from the queue.
+     */
+    static stdair::Count_T skipEventsBefore (EventQueue&,
+                                             const stdair::DateTime_T&);
+
+    /**
+     * Extract, in one go, all the events occurring strictly before the
+     * given date-time from the queue, and append them to the given list.
+     */
+    static stdair::Count_T popEventsBefore (EventQueue&, EventStructList_T&,
+                                            const stdair::DateTime_T&);
+
     /**
      * Played all events and stopped when the first break point was encountered
      */
     static void run (EventQueue&, stdair::EventStruct&);
 
+    /**
+     * Extract the events, and dispatch each of them, in place, to the
+     * handler registered for its type, until the queue is done, or a
+     * break point without handler has been extracted.
+     */
+    static stdair::Count_T run (EventQueue&, const EventHandlerRegistry&);
+
+    /**
+     * Extract the events, and dispatch each of them, in place, to the
+     * handler registered for its type (the events without handler are
+     * dropped), until the queue is done, or the given stop condition
+     * is met.
+     */
+    static RunReport run (EventQueue&, const EventHandlerRegistry&,
+                          const RunStopCondition&);
+
+    /**
+     * Generate the events on a background thread, up to the given
+     * horizon ahead of the simulated date-time, while the events are
+     * dispatched to their handlers by the calling thread.
+     */
+    static stdair::Count_T runPipelined (EventQueue&,
+                                         const PipelineEventGeneratorList_T&,
+                                         const stdair::Duration_T& iHorizon,
+                                         const EventHandlerRegistry&);
+
+    /**
+     * Simulate all the events of the queue, spread over partitions, each
+     * one being handled by its own thread, under a conservative
+     * synchronisation protocol (see ConservativeSynchroniser).
+     *
+     * @return stdair::Count_T Number of handled events.
+     */
+    static stdair::Count_T runPartitioned (EventQueue&,
+                                           const EventPartitioner&,
+                                           const PartitionEventHandlerList_T&,
+                                           const EventLookaheadMap_T&);
+
+    /**
+     * Simulate all the events of the given event queue over partitions,
+     * each one on its own thread, under an optimistic (Time Warp)
+     * synchronisation protocol (see OptimisticSynchroniser).
+     *
+     * @param EventQueue& Queue containing all the events.
+     * @param const EventPartitioner& Assignment of the events to the
+     *        partitions.
+     * @param const PartitionEventHandlerList_T& Event handlers, one per
+     *        partition.
+     * @param const PartitionStateHandlerList_T& State handlers, one per
+     *        partition (or none).
+     * @param const stdair::Count_T& Number of handled events between two
+     *        checkpoints of the state of a partition.
+     * @param const stdair::Count_T& Number of handled events between two
+     *        computations of the global virtual time.
+     * @return stdair::Count_T Number of handled events.
+     */
+    static stdair::Count_T runOptimistic (EventQueue&,
+                                          const EventPartitioner&,
+                                          const PartitionEventHandlerList_T&,
+                                          const PartitionStateHandlerList_T&,
+                                          const stdair::Count_T&,
+                                          const stdair::Count_T&);
+
+    /**
+     * Simulate all the events of the given event queue by time windows,
+     * the events of a window being handled concurrently, grouped by
+     * conflict key (see EventWindowExecutor).
+     *
+     * @param EventQueue& Queue containing all the events.
+     * @param const stdair::Duration_T& Length of the time windows.
+     * @param const EventConflictKeyExtractor& Conflict key of the events.
+     * @param ConcurrentEventHandler& Event handler.
+     * @param const unsigned int& Number of threads.
+     * @return stdair::Count_T Number of handled events.
+     */
+    static stdair::Count_T runWindowed (EventQueue&,
+                                        const stdair::Duration_T&,
+                                        const EventConflictKeyExtractor&,
+                                        ConcurrentEventHandler&,
+                                        const unsigned int&);
+
     /**
      * 
      * Selected the event with the given date time, if such event existed.
@@ -95,6 +323,21 @@ namespace SEVMGR {
      *   the queue.
      */
     static bool select (EventQueue&, stdair::EventStruct&, const stdair::DateTime_T&); 
+
+    /**
+     * Select the first event occurring at, or after, the given date
+     * time, if any. All the events occurring before the given date time
+     * are removed in one go (see EventQueue::skipEventsBefore()).
+     *
+     * @param EventQueue& Queue containing all the events.
+     * @param stdair::EventStruct& A copy of the selected event, if any.
+     * @param const stdair::DateTime_T Date time from which the event is
+     *   selected.
+     * @return bool States whether an event has been selected, i.e.,
+     *   whether the queue was not empty after the given date time.
+     */
+    static bool seek (EventQueue&, stdair::EventStruct&,
+                      const stdair::DateTime_T&);
     
     /**
      * Update the status of the given event type with the given count
@@ -128,6 +371,12 @@ namespace SEVMGR {
      */
     static const stdair::Count_T getQueueSize(const EventQueue&); 
 
+    /**
+     * Calculate the number of events of the given type
+     */
+    static stdair::Count_T getQueueSize (const EventQueue&,
+                                         const stdair::EventType::EN_EventType&);
+
     /**
      * Calculate the expected total number of events
      */
@@ -166,6 +415,21 @@ namespace SEVMGR {
      */
     static const stdair::ProgressStatus& getStatus (const EventQueue&);
 
+    /**
+     * Get (a consistent copy of) the overall progress status, as
+     * published by the thread altering the event queue.
+     */
+    static stdair::ProgressStatus getMonitoredStatus (const EventQueue&);
+
+    /**
+     * Get (a consistent copy of) both the overall progress status and
+     * the one specific to the given event type, as published by the
+     * thread altering the event queue.
+     */
+    static stdair::ProgressStatusSet
+    getMonitoredStatus (const EventQueue&,
+                        const stdair::EventType::EN_EventType&);
+
   };
 
 }
@@ -0,0 +1,135 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <map>
+// StdAir
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Exceptions.hpp>
+#include <sevmgr/bom/EventQueue.hpp>
+#include <sevmgr/command/EventWindowExecutor.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  EventWindowExecutor::
+  EventWindowExecutor (EventQueue& ioEventQueue,
+                       const stdair::Duration_T& iWindowLength,
+                       const EventConflictKeyExtractor& iConflictKeyExtractor,
+                       ConcurrentEventHandler& ioHandler,
+                       const unsigned int& iNbOfThreads)
+    : _eventQueue (ioEventQueue), _windowLength (iWindowLength),
+      _conflictKeyExtractor (iConflictKeyExtractor), _handler (ioHandler),
+      _pool (iNbOfThreads), _nbOfWindows (0) {
+    if (_windowLength.total_milliseconds() <= 0) {
+      throw EventQueueException ("The length of the time windows must be "
+                                 "strictly positive");
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventWindowExecutor::
+  EventWindowExecutor (const EventWindowExecutor& iExecutor)
+    : _eventQueue (iExecutor._eventQueue),
+      _windowLength (iExecutor._windowLength),
+      _conflictKeyExtractor (iExecutor._conflictKeyExtractor),
+      _handler (iExecutor._handler), _pool (1), _nbOfWindows (0) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventWindowExecutor::~EventWindowExecutor() {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventWindowExecutor::groupEvents() {
+    _eventGroupList.clear();
+
+    // The groups are numbered in the order of their first event
+    typedef std::map<ConflictKey_T, std::size_t> GroupIndexMap_T;
+    GroupIndexMap_T lGroupIndexMap;
+    for (EventStructList_T::const_iterator itEvent = _windowEventList.begin();
+         itEvent != _windowEventList.end(); ++itEvent) {
+      const ConflictKey_T& lConflictKey =
+        _conflictKeyExtractor.getConflictKey (*itEvent);
+      std::pair<GroupIndexMap_T::iterator, bool> lInsertion =
+        lGroupIndexMap.insert (GroupIndexMap_T::
+                               value_type (lConflictKey,
+                                           _eventGroupList.size()));
+      if (lInsertion.second == true) {
+        _eventGroupList.push_back (EventGroup());
+        _eventGroupList.back()._nbOfHandledEvents = 0;
+      }
+      EventGroup& lEventGroup = _eventGroupList[lInsertion.first->second];
+      lEventGroup._eventList.push_back (&*itEvent);
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventWindowExecutor::
+  execute (const WorkStealingPool::TaskIndex_T& iGroupIndex) {
+    assert (iGroupIndex < _eventGroupList.size());
+    EventGroup& lEventGroup = _eventGroupList[iGroupIndex];
+    for (std::vector<const stdair::EventStruct*>::const_iterator itEvent =
+           lEventGroup._eventList.begin();
+         itEvent != lEventGroup._eventList.end(); ++itEvent) {
+      assert (*itEvent != NULL);
+      _handler.handle (**itEvent);
+      ++lEventGroup._nbOfHandledEvents;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void EventWindowExecutor::restoreEvents() {
+    // The events not handled are no longer accounted for as popped
+    EventStructList_T lEventStructList;
+    for (EventGroupList_T::const_iterator itGroup = _eventGroupList.begin();
+         itGroup != _eventGroupList.end(); ++itGroup) {
+      const std::vector<const stdair::EventStruct*>& lEventList =
+        itGroup->_eventList;
+      for (std::size_t idx = itGroup->_nbOfHandledEvents;
+           idx != lEventList.size(); ++idx) {
+        const stdair::EventStruct& lEventStruct = *lEventList[idx];
+        _eventQueue.accountForEvents (lEventStruct.getEventType(), -1);
+        lEventStructList.push_back (lEventStruct);
+      }
+    }
+    _eventQueue.addEvents (lEventStructList);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T EventWindowExecutor::run() {
+    _nbOfWindows = 0;
+
+    stdair::Count_T oNbOfHandledEvents = 0;
+    while (true) {
+      // Pop the events of the next window, which starts with the next
+      // event, and ends (excluded) after the given length
+      _windowEventList.clear();
+      _eventQueue.popEvents (_windowEventList, 1);
+      if (_windowEventList.empty() == true) {
+        break;
+      }
+      const stdair::DateTime_T lWindowLastDateTime =
+        _windowEventList.front().getEventTime() + _windowLength
+        - boost::posix_time::milliseconds (1);
+      _eventQueue.popEventsUntil (_windowEventList, lWindowLastDateTime);
+      ++_nbOfWindows;
+
+      // Handle the groups of events concurrently
+      groupEvents();
+      try {
+        _pool.execute (*this, _eventGroupList.size());
+
+      } catch (...) {
+        restoreEvents();
+        throw;
+      }
+      oNbOfHandledEvents += _windowEventList.size();
+    }
+    return oNbOfHandledEvents;
+  }
+
+}
@@ -0,0 +1,128 @@
+#ifndef __SEVMGR_CMD_EVENTWINDOWEXECUTOR_HPP
+#define __SEVMGR_CMD_EVENTWINDOWEXECUTOR_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <vector>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_date_time_types.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Types.hpp>
+#include <sevmgr/SEVMGR_ConcurrentTypes.hpp>
+#include <sevmgr/bom/EventQueueTypes.hpp>
+#include <sevmgr/command/WorkStealingPool.hpp>
+
+namespace SEVMGR {
+
+  // Forward declarations
+  class EventQueue;
+
+  /**
+   * @brief Simulation of the events of an event queue, by time windows,
+   * the events of a window being handled concurrently.
+   *
+   * The events of the next time window (starting at the date-time of the
+   * next event) are popped, and grouped by conflict key (see
+   * EventConflictKeyExtractor). The groups are then handled by a
+   * work-stealing thread pool (see WorkStealingPool), the events of each
+   * group being handled in date-time order. Once all the groups have
+   * been handled, the simulation goes on with the next window.
+   */
+  class EventWindowExecutor : public WorkStealingPool::TaskExecutor {
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     *
+     * @param EventQueue& Event queue, the events of which are simulated.
+     * @param const stdair::Duration_T& Length of the time windows. It
+     *        must be strictly positive.
+     * @param const EventConflictKeyExtractor& Conflict key of the events.
+     * @param ConcurrentEventHandler& Event handler.
+     * @param const unsigned int& Number of threads (including the
+     *        calling one).
+     */
+    EventWindowExecutor (EventQueue&, const stdair::Duration_T&,
+                         const EventConflictKeyExtractor&,
+                         ConcurrentEventHandler&, const unsigned int&);
+    /** Destructor. */
+    ~EventWindowExecutor();
+
+  private:
+    /** Copy constructor (not to be used). */
+    EventWindowExecutor (const EventWindowExecutor&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the number of simulated windows. */
+    const stdair::Count_T& getNbOfWindows() const {
+      return _nbOfWindows;
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Simulate all the events of the event queue, window by window,
+     * until there is no more event. The progress statuses are updated as
+     * the events are popped, i.e., at the beginning of each window.
+     *
+     * When the handler throws an exception, the other groups of the
+     * window are completed (the groups not started yet being skipped),
+     * the events of the window not handled are given back to the event
+     * queue, and the exception is thrown again.
+     *
+     * @return stdair::Count_T Number of handled events.
+     */
+    stdair::Count_T run();
+
+    /** Handle the events of the given group (called by the thread pool). */
+    void execute (const WorkStealingPool::TaskIndex_T&);
+
+  private:
+    // ////////// Helpers /////////
+    /** Group of events having the same conflict key. */
+    struct EventGroup {
+      std::vector<const stdair::EventStruct*> _eventList;
+      std::size_t _nbOfHandledEvents;
+    };
+    typedef std::vector<EventGroup> EventGroupList_T;
+
+    /** Group the events of the current window by conflict key. */
+    void groupEvents();
+
+    /**
+     * Give the events of the current window, which have not been
+     * handled, back to the event queue.
+     */
+    void restoreEvents();
+
+  private:
+    // ////////// Attributes /////////
+    /** Event queue, the events of which are simulated. */
+    EventQueue& _eventQueue;
+
+    /** Length of the windows. */
+    const stdair::Duration_T _windowLength;
+
+    /** Conflict key of the events. */
+    const EventConflictKeyExtractor& _conflictKeyExtractor;
+
+    /** Event handler. */
+    ConcurrentEventHandler& _handler;
+
+    /** Thread pool. */
+    WorkStealingPool _pool;
+
+    /** Events of the current window, and their groups. */
+    EventStructList_T _windowEventList;
+    EventGroupList_T _eventGroupList;
+
+    /** Number of simulated windows. */
+    stdair::Count_T _nbOfWindows;
+  };
+
+}
+#endif // __SEVMGR_CMD_EVENTWINDOWEXECUTOR_HPP
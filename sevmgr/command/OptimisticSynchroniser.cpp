@@ -0,0 +1,834 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+// StdAir
+#include <stdair/bom/EventStruct.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Exceptions.hpp>
+#include <sevmgr/bom/EventQueue.hpp>
+#include <sevmgr/command/OptimisticSynchroniser.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Worker of a partition: it handles the events of the partition
+   * speculatively, and rolls back when needed.
+   */
+  class OptimisticSynchroniser::PartitionWorker
+    : public PartitionEventScheduler {
+  public:
+    // ////////// Type definitions ////////////
+    /**
+     * Key of an event, ordering the events of a partition: date-time
+     * stamp first, then the generation of the event, i.e., the number of
+     * its ancestors (the events having scheduled it, directly or not)
+     * having the same date-time stamp, then the sending partition and
+     * the sequence number of the event within that partition, which
+     * make the key unique.
+     *
+     * Hence, the key of a scheduled event always comes after the one of
+     * the event having scheduled it, so that the handled events stay
+     * sorted by key, and the tied events are handled in an order which
+     * does not depend on the timing of the threads.
+     */
+    struct EventKey {
+      stdair::LongDuration_T _timeStamp;
+      unsigned long _generation;
+      PartitionIndex_T _sender;
+      unsigned long _sequence;
+
+      bool operator< (const EventKey& iKey) const {
+        if (_timeStamp != iKey._timeStamp) {
+          return (_timeStamp < iKey._timeStamp);
+        }
+        if (_generation != iKey._generation) {
+          return (_generation < iKey._generation);
+        }
+        if (_sender != iKey._sender) {
+          return (_sender < iKey._sender);
+        }
+        return (_sequence < iKey._sequence);
+      }
+      bool operator== (const EventKey& iKey) const {
+        return (_timeStamp == iKey._timeStamp
+                && _generation == iKey._generation && _sender == iKey._sender
+                && _sequence == iKey._sequence);
+      }
+    };
+
+    /** Message between two partitions: an event, or its anti-event. */
+    struct Message {
+      EventKey _key;
+      stdair::EventStruct _event;
+      bool _isAntiEvent;
+    };
+    typedef std::vector<Message> MessageList_T;
+
+    /** Event scheduled while handling an event. */
+    struct ScheduledEvent {
+      PartitionIndex_T _partition;
+      EventKey _key;
+    };
+    typedef std::vector<ScheduledEvent> ScheduledEventList_T;
+
+    /** Handled event, along with the events it has scheduled. */
+    struct HandledEvent {
+      EventKey _key;
+      stdair::EventStruct _event;
+      ScheduledEventList_T _scheduledEventList;
+    };
+    typedef std::deque<HandledEvent> HandledEventList_T;
+
+    /**
+     * Checkpoint of the state of the partition, saved before handling
+     * the event at the given position within the handled events.
+     */
+    struct Checkpoint {
+      CheckpointID_T _id;
+      HandledEventList_T::size_type _position;
+    };
+    typedef std::deque<Checkpoint> CheckpointList_T;
+
+    /** Events not handled yet, ordered by key. */
+    typedef std::map<EventKey, stdair::EventStruct> PendingEventMap_T;
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor. */
+    PartitionWorker (OptimisticSynchroniser& ioSynchroniser,
+                     const PartitionIndex_T& iIndex,
+                     PartitionEventHandler& ioHandler,
+                     PartitionStateHandler* ioStateHandler_ptr)
+      : _synchroniser (ioSynchroniser), _index (iIndex),
+        _handler (ioHandler), _stateHandler_ptr (ioStateHandler_ptr),
+        _nextCheckpointID (0), _lastSequence (0), _nbOfSentMessages (0),
+        _nbOfReceivableMessages (0), _currentEvent_ptr (NULL),
+        _isCoastingForward (false), _gvt (0), _failureTimeStamp (0),
+        _nbOfRollbacks (0) {
+      for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE; ++idx) {
+        _nbOfHandledEventsPerType[idx] = 0;
+      }
+    }
+
+    /** Destructor. */
+    ~PartitionWorker() {
+    }
+
+  private:
+    /** Copy constructor (not to be used). */
+    PartitionWorker (const PartitionWorker&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the index of the partition. */
+    const PartitionIndex_T& getPartitionIndex() const {
+      return _index;
+    }
+
+    /** Get the date-time of the handled event. */
+    stdair::DateTime_T getCurrentTime() const {
+      assert (_currentEvent_ptr != NULL);
+      return _currentEvent_ptr->getEventTime();
+    }
+
+    /** Get the number of (committed) handled events of the given type. */
+    const stdair::Count_T&
+    getNbOfHandledEvents (const stdair::EventType::EN_EventType& iType) const {
+      return _nbOfHandledEventsPerType[iType];
+    }
+
+    /** Get the number of rollbacks. */
+    const stdair::Count_T& getNbOfRollbacks() const {
+      return _nbOfRollbacks;
+    }
+
+    /** Get the exception thrown while handling the events, if any. */
+    const std::exception_ptr& getException() const {
+      return _exception;
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /** Add the given event (from the event queue) to the partition. */
+    void insertEvent (const stdair::EventStruct& iEventStruct,
+                      const unsigned long& iSequence) {
+      // The events of the event queue are sent by a virtual partition,
+      // before the actual ones (see scheduleEvent()), as they have been
+      // queued before any event has been handled
+      const EventKey lKey = { iEventStruct.getEventTimeStamp(), 0, 0,
+                              iSequence };
+      _pendingEventMap.insert (PendingEventMap_T::value_type (lKey,
+                                                              iEventStruct));
+    }
+
+    /** Schedule the given event (called by the event handler). */
+    void scheduleEvent (const stdair::EventStruct&);
+
+    /** Handle the events of the partition, until there is no more event. */
+    void run();
+
+    /** Give back the events not handled yet. */
+    void transferEvents (EventStructList_T&);
+
+  private:
+    // ////////// Helpers /////////
+    /** Send the given message to the given partition. */
+    void sendMessage (const PartitionIndex_T&, const Message&);
+
+    /** Handle the messages sent by the other partitions. */
+    void receiveMessages();
+
+    /**
+     * Handle events, up to the number of events between two
+     * computations of the GVT, or until there is no more event.
+     */
+    void handleEvents();
+
+    /**
+     * Roll back, so that the handled event at the given position (and
+     * all the following ones) be handled again.
+     */
+    void rollback (const HandledEventList_T::size_type&);
+
+    /** Get the position of the first handled event not older than iTimeStamp. */
+    HandledEventList_T::size_type
+    getPosition (const stdair::LongDuration_T& iTimeStamp) const;
+
+    /**
+     * Get the position of the last checkpoint before the given position,
+     * i.e., the position the state of the partition can be restored at.
+     */
+    HandledEventList_T::size_type
+    getRestorablePosition (const HandledEventList_T::size_type&) const;
+
+    /**
+     * Commit the handled events before the given position: they will
+     * never be rolled back.
+     */
+    void commitEvents (const HandledEventList_T::size_type&);
+
+    /**
+     * Get the lower bound of the date-time stamps of the events the
+     * partition will handle (again), or will send to the others.
+     */
+    stdair::LongDuration_T getLowerBound() const;
+
+    /** Record the exception being thrown. */
+    void recordException();
+
+  private:
+    // ////////// Attributes /////////
+    /** Synchroniser, to which the worker belongs. */
+    OptimisticSynchroniser& _synchroniser;
+
+    /** Index of the partition. */
+    const PartitionIndex_T _index;
+
+    /** Event handler, and state handler (if any), of the partition. */
+    PartitionEventHandler& _handler;
+    PartitionStateHandler* _stateHandler_ptr;
+
+    /** Events not handled yet. */
+    PendingEventMap_T _pendingEventMap;
+
+    /** Handled events, which have not been committed yet. */
+    HandledEventList_T _handledEventList;
+
+    /** Checkpoints of the handled events, not committed yet. */
+    CheckpointList_T _checkpointList;
+    CheckpointID_T _nextCheckpointID;
+
+    /** Sequence number of the last event scheduled by the partition. */
+    unsigned long _lastSequence;
+
+    /** Number of messages (events and anti-events) sent so far. */
+    unsigned long _nbOfSentMessages;
+
+    /** Messages sent by the other partitions, not received yet. */
+    std::mutex _inboxMutex;
+    MessageList_T _inbox;
+    std::atomic<unsigned long> _nbOfReceivableMessages;
+
+    /** Event being handled, and whether it is handled again. */
+    const stdair::EventStruct* _currentEvent_ptr;
+    bool _isCoastingForward;
+
+    /** Last computed GVT. */
+    stdair::LongDuration_T _gvt;
+
+    /**
+     * Date-time stamp from which the events are rolled back, when the
+     * simulation fails.
+     */
+    stdair::LongDuration_T _failureTimeStamp;
+
+    /** Number of committed events, for each event type. */
+    stdair::Count_T _nbOfHandledEventsPerType[stdair::EventType::LAST_VALUE];
+
+    /** Number of rollbacks. */
+    stdair::Count_T _nbOfRollbacks;
+
+    /** Exception thrown while handling the events, if any. */
+    std::exception_ptr _exception;
+  };
+
+  // //////////////////////////////////////////////////////////////////////
+  void OptimisticSynchroniser::PartitionWorker::
+  sendMessage (const PartitionIndex_T& iPartition, const Message& iMessage) {
+    PartitionWorker& lWorker = *_synchroniser._workerList[iPartition];
+    {
+      std::lock_guard<std::mutex> lLock (lWorker._inboxMutex);
+      lWorker._inbox.push_back (iMessage);
+    }
+    lWorker._nbOfReceivableMessages.fetch_add (1, std::memory_order_release);
+    ++_nbOfSentMessages;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void OptimisticSynchroniser::PartitionWorker::
+  scheduleEvent (const stdair::EventStruct& iEventStruct) {
+    assert (_currentEvent_ptr != NULL);
+
+    // When the event is handled again, the events it schedules have
+    // already been scheduled the first time
+    if (_isCoastingForward == true) {
+      return;
+    }
+
+    const stdair::LongDuration_T& lTimeStamp =
+      iEventStruct.getEventTimeStamp();
+    if (lTimeStamp < _currentEvent_ptr->getEventTimeStamp()) {
+      std::ostringstream oStr;
+      oStr << "The event '" << iEventStruct.describe() << "' cannot be "
+           << "scheduled by partition #" << _index << ": it occurs before "
+           << "the handled event";
+      throw EventQueueException (oStr.str());
+    }
+
+    const PartitionIndex_T lPartition =
+      _synchroniser.getPartition (iEventStruct);
+    // The scheduled event comes after the handled one: either later, or
+    // at the same date-time stamp but of a further generation
+    assert (_handledEventList.empty() == false);
+    const EventKey& lCurrentKey = _handledEventList.back()._key;
+    const unsigned long lGeneration =
+      (lTimeStamp == lCurrentKey._timeStamp ? lCurrentKey._generation + 1 : 0);
+    const EventKey lKey = { lTimeStamp, lGeneration, _index + 1,
+                            ++_lastSequence };
+    const ScheduledEvent lScheduledEvent = { lPartition, lKey };
+    _handledEventList.back()._scheduledEventList.push_back (lScheduledEvent);
+
+    if (lPartition == _index) {
+      _pendingEventMap.insert (PendingEventMap_T::value_type (lKey,
+                                                              iEventStruct));
+      return;
+    }
+    const Message lMessage = { lKey, iEventStruct, false };
+    sendMessage (lPartition, lMessage);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  OptimisticSynchroniser::PartitionWorker::HandledEventList_T::size_type
+  OptimisticSynchroniser::PartitionWorker::
+  getPosition (const stdair::LongDuration_T& iTimeStamp) const {
+    // The handled events are in date-time order
+    HandledEventList_T::size_type oPosition = _handledEventList.size();
+    while (oPosition != 0
+           && _handledEventList[oPosition - 1]._key._timeStamp >= iTimeStamp) {
+      --oPosition;
+    }
+    return oPosition;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  OptimisticSynchroniser::PartitionWorker::HandledEventList_T::size_type
+  OptimisticSynchroniser::PartitionWorker::
+  getRestorablePosition (const HandledEventList_T::size_type& iPosition) const {
+    // Without any state (or handled event), the partition can be
+    // restored at any position
+    if (_stateHandler_ptr == NULL || _handledEventList.empty() == true) {
+      return iPosition;
+    }
+
+    CheckpointList_T::const_reverse_iterator itCheckpoint =
+      _checkpointList.rbegin();
+    while (itCheckpoint != _checkpointList.rend()
+           && itCheckpoint->_position > iPosition) {
+      ++itCheckpoint;
+    }
+    // The first handled event (not committed yet) has always a checkpoint
+    assert (itCheckpoint != _checkpointList.rend());
+    return itCheckpoint->_position;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void OptimisticSynchroniser::PartitionWorker::
+  rollback (const HandledEventList_T::size_type& iPosition) {
+    if (iPosition >= _handledEventList.size()) {
+      return;
+    }
+    ++_nbOfRollbacks;
+
+    // Cancel the events scheduled by the rolled back events: the ones of
+    // the partition are removed, anti-events are sent for the others
+    std::set<EventKey> lCancelledEventSet;
+    for (HandledEventList_T::size_type idx = iPosition;
+         idx != _handledEventList.size(); ++idx) {
+      const ScheduledEventList_T& lScheduledEventList =
+        _handledEventList[idx]._scheduledEventList;
+      for (ScheduledEventList_T::const_iterator itEvent =
+             lScheduledEventList.begin();
+           itEvent != lScheduledEventList.end(); ++itEvent) {
+        if (itEvent->_partition == _index) {
+          lCancelledEventSet.insert (itEvent->_key);
+          _pendingEventMap.erase (itEvent->_key);
+
+        } else {
+          const Message lAntiMessage = { itEvent->_key, stdair::EventStruct(),
+                                         true };
+          sendMessage (itEvent->_partition, lAntiMessage);
+        }
+      }
+    }
+
+    // The rolled back events are to be handled again, except the ones
+    // which have just been cancelled
+    for (HandledEventList_T::size_type idx = iPosition;
+         idx != _handledEventList.size(); ++idx) {
+      const HandledEvent& lHandledEvent = _handledEventList[idx];
+      if (lCancelledEventSet.find (lHandledEvent._key)
+          == lCancelledEventSet.end()) {
+        _pendingEventMap.insert (PendingEventMap_T::
+                                 value_type (lHandledEvent._key,
+                                             lHandledEvent._event));
+      }
+    }
+    _handledEventList.resize (iPosition);
+
+    if (_stateHandler_ptr == NULL) {
+      return;
+    }
+
+    // Discard the checkpoints taken after the rolled back position
+    while (_checkpointList.empty() == false
+           && _checkpointList.back()._position > iPosition) {
+      _stateHandler_ptr->discardState (_checkpointList.back()._id);
+      _checkpointList.pop_back();
+    }
+
+    // Restore the last checkpoint, and coast forward up to the rolled
+    // back position. The events scheduled by the events handled again
+    // are still valid, and are not scheduled a second time.
+    assert (_checkpointList.empty() == false);
+    const Checkpoint& lCheckpoint = _checkpointList.back();
+    _stateHandler_ptr->restoreState (lCheckpoint._id);
+
+    _isCoastingForward = true;
+    for (HandledEventList_T::size_type idx = lCheckpoint._position;
+         idx != iPosition; ++idx) {
+      _currentEvent_ptr = &_handledEventList[idx]._event;
+      _handler.handle (*_currentEvent_ptr, *this);
+    }
+    _currentEvent_ptr = NULL;
+    _isCoastingForward = false;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void OptimisticSynchroniser::PartitionWorker::receiveMessages() {
+    if (_nbOfReceivableMessages.load (std::memory_order_acquire) == 0) {
+      return;
+    }
+    MessageList_T lMessageList;
+    {
+      std::lock_guard<std::mutex> lLock (_inboxMutex);
+      lMessageList.swap (_inbox);
+      _nbOfReceivableMessages.store (0, std::memory_order_relaxed);
+    }
+
+    // The messages sent by a given partition are received in the order
+    // they have been sent: an anti-event always follows its event
+    for (MessageList_T::const_iterator itMessage = lMessageList.begin();
+         itMessage != lMessageList.end(); ++itMessage) {
+      const EventKey& lKey = itMessage->_key;
+
+      if (itMessage->_isAntiEvent == false) {
+        // Roll back the events handled after a straggler, i.e., the
+        // handled events the key of which (hence including the tied
+        // events) comes after the one of the message
+        if (_handledEventList.empty() == false
+            && lKey < _handledEventList.back()._key) {
+          HandledEventList_T::size_type lPosition = _handledEventList.size();
+          while (lPosition != 0
+                 && lKey < _handledEventList[lPosition-1]._key) {
+            --lPosition;
+          }
+          rollback (lPosition);
+        }
+        _pendingEventMap.insert (PendingEventMap_T::
+                                 value_type (lKey, itMessage->_event));
+        continue;
+      }
+
+      // Annihilate the cancelled event, after having rolled it back when
+      // already handled
+      if (_pendingEventMap.erase (lKey) != 0) {
+        continue;
+      }
+      HandledEventList_T::size_type lPosition = _handledEventList.size();
+      while (lPosition != 0
+             && (_handledEventList[lPosition-1]._key == lKey) == false) {
+        --lPosition;
+      }
+      // An event not older than the GVT is never committed
+      assert (lPosition != 0);
+      rollback (lPosition - 1);
+      _pendingEventMap.erase (lKey);
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void OptimisticSynchroniser::PartitionWorker::handleEvents() {
+    const stdair::Count_T& lCheckpointPeriod = _synchroniser._checkpointPeriod;
+    for (stdair::Count_T lNbOfEvents = 0;
+         lNbOfEvents != _synchroniser._gvtPeriod; ++lNbOfEvents) {
+      receiveMessages();
+      if (_pendingEventMap.empty() == true) {
+        break;
+      }
+
+      // Save the state of the partition, when due
+      const HandledEventList_T::size_type lPosition = _handledEventList.size();
+      if (_stateHandler_ptr != NULL
+          && (_checkpointList.empty() == true
+              || lPosition - _checkpointList.back()._position
+              >= static_cast<HandledEventList_T::size_type> (lCheckpointPeriod))) {
+        const Checkpoint lCheckpoint = { _nextCheckpointID++, lPosition };
+        _stateHandler_ptr->saveState (lCheckpoint._id);
+        _checkpointList.push_back (lCheckpoint);
+      }
+
+      // Handle the next event. It is recorded beforehand, so as to keep
+      // track of the events it schedules.
+      PendingEventMap_T::iterator itEvent = _pendingEventMap.begin();
+      HandledEvent lHandledEvent;
+      lHandledEvent._key = itEvent->first;
+      lHandledEvent._event = itEvent->second;
+      _pendingEventMap.erase (itEvent);
+      _handledEventList.push_back (lHandledEvent);
+
+      _currentEvent_ptr = &_handledEventList.back()._event;
+      _handler.handle (*_currentEvent_ptr, *this);
+      _currentEvent_ptr = NULL;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void OptimisticSynchroniser::PartitionWorker::
+  commitEvents (const HandledEventList_T::size_type& iPosition) {
+    assert (iPosition <= _handledEventList.size());
+    for (HandledEventList_T::size_type idx = 0; idx != iPosition; ++idx) {
+      ++_nbOfHandledEventsPerType[_handledEventList.front()._event.getEventType()];
+      _handledEventList.pop_front();
+    }
+
+    if (_stateHandler_ptr == NULL) {
+      return;
+    }
+
+    // Keep the checkpoint at the first event not committed (there is
+    // always one, see getRestorablePosition())
+    while (_checkpointList.empty() == false
+           && _checkpointList.front()._position < iPosition) {
+      _stateHandler_ptr->discardState (_checkpointList.front()._id);
+      _checkpointList.pop_front();
+    }
+    for (CheckpointList_T::iterator itCheckpoint = _checkpointList.begin();
+         itCheckpoint != _checkpointList.end(); ++itCheckpoint) {
+      itCheckpoint->_position -= iPosition;
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::LongDuration_T OptimisticSynchroniser::PartitionWorker::
+  getLowerBound() const {
+    stdair::LongDuration_T oLowerBound =
+      std::numeric_limits<stdair::LongDuration_T>::max();
+    if (_pendingEventMap.empty() == false) {
+      oLowerBound = _pendingEventMap.begin()->first._timeStamp;
+    }
+    if (_exception != NULL && _failureTimeStamp < oLowerBound) {
+      oLowerBound = _failureTimeStamp;
+    }
+    return oLowerBound;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void OptimisticSynchroniser::PartitionWorker::recordException() {
+    if (_exception == NULL) {
+      _exception = std::current_exception();
+      // The events from the failing one onwards are to be rolled back
+      _failureTimeStamp = _gvt;
+      if (_currentEvent_ptr != NULL
+          && _currentEvent_ptr->getEventTimeStamp() > _gvt) {
+        _failureTimeStamp = _currentEvent_ptr->getEventTimeStamp();
+      }
+    }
+    _currentEvent_ptr = NULL;
+    _isCoastingForward = false;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void OptimisticSynchroniser::PartitionWorker::run() {
+    PartitionBarrier& lBarrier = _synchroniser._barrier;
+
+    bool hasFailed = false;
+    while (true) {
+      // Handle events speculatively. A failure is reported to the other
+      // workers at the computation of the GVT.
+      if (hasFailed == false) {
+        try {
+          handleEvents();
+
+        } catch (...) {
+          recordException();
+          hasFailed = true;
+        }
+      }
+
+      // Wait for the other workers, and receive all the messages still
+      // in transit, including the anti-events sent by the rollbacks
+      // they trigger, until no message has been sent anymore
+      lBarrier.wait();
+      bool hasSentMessages = true;
+      while (hasSentMessages == true) {
+        const unsigned long lNbOfSentMessages = _nbOfSentMessages;
+        try {
+          receiveMessages();
+
+        } catch (...) {
+          recordException();
+          hasFailed = true;
+        }
+        hasSentMessages = (_nbOfSentMessages != lNbOfSentMessages);
+        lBarrier.reduce (0, hasSentMessages);
+      }
+
+      // Compute the GVT
+      _gvt = lBarrier.reduce (getLowerBound(), hasFailed);
+      if (hasFailed == true) {
+        // Roll back the events not older than the GVT (the ones they
+        // have scheduled are annihilated once all the anti-events are
+        // received), and give up
+        try {
+          rollback (getPosition (_gvt));
+
+        } catch (...) {
+          recordException();
+        }
+        lBarrier.wait();
+        receiveMessages();
+        break;
+      }
+      if (_gvt == std::numeric_limits<stdair::LongDuration_T>::max()) {
+        break;
+      }
+
+      // Fossil collection: the events older than the GVT are committed,
+      // up to the last checkpoint before them
+      commitEvents (getRestorablePosition (getPosition (_gvt)));
+    }
+
+    // All the remaining handled events are now committed
+    commitEvents (_handledEventList.size());
+    if (_stateHandler_ptr != NULL) {
+      while (_checkpointList.empty() == false) {
+        _stateHandler_ptr->discardState (_checkpointList.front()._id);
+        _checkpointList.pop_front();
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void OptimisticSynchroniser::PartitionWorker::
+  transferEvents (EventStructList_T& ioEventStructList) {
+    for (PendingEventMap_T::const_iterator itEvent = _pendingEventMap.begin();
+         itEvent != _pendingEventMap.end(); ++itEvent) {
+      ioEventStructList.push_back (itEvent->second);
+    }
+    _pendingEventMap.clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  OptimisticSynchroniser::
+  OptimisticSynchroniser (EventQueue& ioEventQueue,
+                          const EventPartitioner& iPartitioner,
+                          const PartitionEventHandlerList_T& iHandlerList,
+                          const PartitionStateHandlerList_T& iStateHandlerList,
+                          const stdair::Count_T& iCheckpointPeriod,
+                          const stdair::Count_T& iGVTPeriod)
+    : _eventQueue (ioEventQueue), _partitioner (iPartitioner),
+      _handlerList (iHandlerList), _stateHandlerList (iStateHandlerList),
+      _checkpointPeriod (iCheckpointPeriod), _gvtPeriod (iGVTPeriod),
+      _declaredTypeMask (ioEventQueue.getProgressStatusMask()),
+      _barrier (iHandlerList.empty() == true ? 1 : iHandlerList.size()),
+      _nbOfRollbacks (0) {
+
+    if (_handlerList.empty() == true) {
+      throw EventQueueException ("At least one partition (i.e., one event "
+                                 "handler) is needed");
+    }
+    for (PartitionEventHandlerList_T::const_iterator itHandler =
+           _handlerList.begin(); itHandler != _handlerList.end(); ++itHandler) {
+      if (*itHandler == NULL) {
+        throw EventQueueException ("Each partition needs an event handler");
+      }
+    }
+    if (_stateHandlerList.empty() == false
+        && _stateHandlerList.size() != _handlerList.size()) {
+      throw EventQueueException ("There must be either no state handler, "
+                                 "or one per partition");
+    }
+    if (_checkpointPeriod <= 0 || _gvtPeriod <= 0) {
+      throw EventQueueException ("The checkpoint and GVT periods must be "
+                                 "strictly positive");
+    }
+
+    // Create the workers
+    for (PartitionIndex_T idx = 0; idx != _handlerList.size(); ++idx) {
+      PartitionStateHandler* lStateHandler_ptr =
+        (_stateHandlerList.empty() == true ? NULL : _stateHandlerList[idx]);
+      _workerList.push_back (new PartitionWorker (*this, idx,
+                                                  *_handlerList[idx],
+                                                  lStateHandler_ptr));
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  OptimisticSynchroniser::
+  OptimisticSynchroniser (const OptimisticSynchroniser& iSynchroniser)
+    : _eventQueue (iSynchroniser._eventQueue),
+      _partitioner (iSynchroniser._partitioner),
+      _handlerList (iSynchroniser._handlerList),
+      _stateHandlerList (iSynchroniser._stateHandlerList),
+      _checkpointPeriod (0), _gvtPeriod (0), _declaredTypeMask (0),
+      _barrier (1), _nbOfRollbacks (0) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  OptimisticSynchroniser::~OptimisticSynchroniser() {
+    for (PartitionWorkerList_T::iterator itWorker = _workerList.begin();
+         itWorker != _workerList.end(); ++itWorker) {
+      delete *itWorker;
+    }
+    _workerList.clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  PartitionIndex_T OptimisticSynchroniser::
+  getPartition (const stdair::EventStruct& iEventStruct) const {
+    const stdair::EventType::EN_EventType& lType = iEventStruct.getEventType();
+    if (lType >= stdair::EventType::LAST_VALUE
+        || (_declaredTypeMask & (static_cast<EventTypeMask_T> (1) << lType)) == 0) {
+      std::ostringstream oStr;
+      oStr << "The '" << stdair::EventType::getLabel (lType) << "' events "
+           << "cannot be simulated in parallel: that event type needs "
+           << "a progress status";
+      throw EventQueueException (oStr.str());
+    }
+
+    const PartitionIndex_T oPartition =
+      _partitioner.getPartition (iEventStruct);
+    if (oPartition >= _workerList.size()) {
+      std::ostringstream oStr;
+      oStr << "The event '" << iEventStruct.describe() << "' is assigned "
+           << "to partition #" << oPartition << ", whereas there are only "
+           << _workerList.size() << " partitions";
+      throw EventQueueException (oStr.str());
+    }
+    return oPartition;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::Count_T OptimisticSynchroniser::run() {
+    _nbOfRollbacks = 0;
+
+    // Spread the events of the event queue over the partitions
+    EventStructList_T lEventStructList;
+    _eventQueue.transferEvents (lEventStructList);
+    try {
+      unsigned long lSequence = 0;
+      for (EventStructList_T::const_iterator itEvent =
+             lEventStructList.begin(); itEvent != lEventStructList.end();
+           ++itEvent, ++lSequence) {
+        const PartitionIndex_T lPartition = getPartition (*itEvent);
+        _workerList[lPartition]->insertEvent (*itEvent, lSequence);
+      }
+
+    } catch (...) {
+      // Give the events back to the event queue
+      for (PartitionWorkerList_T::iterator itWorker = _workerList.begin();
+           itWorker != _workerList.end(); ++itWorker) {
+        EventStructList_T lIgnoredEventList;
+        (*itWorker)->transferEvents (lIgnoredEventList);
+      }
+      _eventQueue.addEvents (lEventStructList);
+      throw;
+    }
+    lEventStructList.clear();
+
+    // Run a worker per partition, the current thread taking the first one
+    std::vector<std::thread> lThreadList;
+    for (PartitionWorkerList_T::iterator itWorker = _workerList.begin() + 1;
+         itWorker != _workerList.end(); ++itWorker) {
+      lThreadList.push_back (std::thread (&PartitionWorker::run, *itWorker));
+    }
+    _workerList.front()->run();
+    for (std::vector<std::thread>::iterator itThread = lThreadList.begin();
+         itThread != lThreadList.end(); ++itThread) {
+      itThread->join();
+    }
+
+    // Account for the handled events, and give the other events (if the
+    // simulation has failed) back to the event queue
+    stdair::Count_T oNbOfHandledEvents = 0;
+    std::exception_ptr lException;
+    for (PartitionWorkerList_T::const_iterator itWorker = _workerList.begin();
+         itWorker != _workerList.end(); ++itWorker) {
+      PartitionWorker& lWorker = **itWorker;
+      for (unsigned short idx = 0; idx != stdair::EventType::LAST_VALUE;
+           ++idx) {
+        const stdair::EventType::EN_EventType lType =
+          static_cast<stdair::EventType::EN_EventType> (idx);
+        const stdair::Count_T& lNbOfEvents = lWorker.getNbOfHandledEvents (lType);
+        if (lNbOfEvents != 0) {
+          _eventQueue.accountForEvents (lType, lNbOfEvents);
+          oNbOfHandledEvents += lNbOfEvents;
+        }
+      }
+      _nbOfRollbacks += lWorker.getNbOfRollbacks();
+      lWorker.transferEvents (lEventStructList);
+      if (lException == NULL && lWorker.getException() != NULL) {
+        lException = lWorker.getException();
+      }
+    }
+    _eventQueue.addEvents (lEventStructList);
+
+    if (lException != NULL) {
+      std::rethrow_exception (lException);
+    }
+    return oNbOfHandledEvents;
+  }
+
+}
@@ -0,0 +1,156 @@
+#ifndef __SEVMGR_CMD_OPTIMISTICSYNCHRONISER_HPP
+#define __SEVMGR_CMD_OPTIMISTICSYNCHRONISER_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <vector>
+// StdAir
+#include <stdair/stdair_basic_types.hpp>
+#include <stdair/stdair_date_time_types.hpp>
+// SEvMgr
+#include <sevmgr/SEVMGR_Types.hpp>
+#include <sevmgr/SEVMGR_PartitionTypes.hpp>
+#include <sevmgr/bom/EventQueueTypes.hpp>
+#include <sevmgr/command/PartitionBarrier.hpp>
+
+namespace SEVMGR {
+
+  // Forward declarations
+  class EventQueue;
+
+  /**
+   * @brief Partitioned simulation of the events of an event queue,
+   * under an optimistic (Time Warp) synchronisation protocol.
+   *
+   * As with the conservative protocol (see ConservativeSynchroniser),
+   * the events are spread over partitions, each one being handled by its
+   * own worker (thread) and event handler. However, no lookahead is
+   * needed: each worker handles its events as soon as it can, and the
+   * events sent to the other partitions are delivered straight away.
+   *
+   * The events having the same date-time stamp are ordered by causality
+   * first (an event comes after the one having scheduled it), then by
+   * sending partition and sequence, so that the simulation does not
+   * depend on the timing of the workers.
+   *
+   * When a worker receives an event ordered before the last one it has
+   * handled (a straggler), it rolls back: the state of its event handler
+   * is restored from the last checkpoint before the straggler (see
+   * PartitionStateHandler), the events handled between the checkpoint
+   * and the straggler are handled again without scheduling anything
+   * (coast forward), and the events scheduled by the following ones are
+   * cancelled, by sending anti-events to their partitions.
+   *
+   * Every given number of handled events, the workers meet and compute
+   * the global virtual time (GVT), i.e., the date-time stamp of the
+   * oldest event not handled yet. No event older than the GVT may be
+   * rolled back anymore: the corresponding checkpoints are discarded
+   * (fossil collection), and the progress statuses are updated.
+   */
+  class OptimisticSynchroniser {
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     *
+     * @param EventQueue& Event queue, the events of which are simulated.
+     * @param const EventPartitioner& Assignment of the events to the
+     *        partitions.
+     * @param const PartitionEventHandlerList_T& Event handlers, one per
+     *        partition.
+     * @param const PartitionStateHandlerList_T& State handlers, either
+     *        one per partition, or none when the event handlers have no
+     *        state.
+     * @param const stdair::Count_T& Number of handled events between two
+     *        checkpoints of the state of a partition.
+     * @param const stdair::Count_T& Number of handled events (per
+     *        partition) between two computations of the GVT.
+     */
+    OptimisticSynchroniser (EventQueue&, const EventPartitioner&,
+                            const PartitionEventHandlerList_T&,
+                            const PartitionStateHandlerList_T&,
+                            const stdair::Count_T& iCheckpointPeriod,
+                            const stdair::Count_T& iGVTPeriod);
+    /** Destructor. */
+    ~OptimisticSynchroniser();
+
+  private:
+    /** Copy constructor (not to be used). */
+    OptimisticSynchroniser (const OptimisticSynchroniser&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the number of rollbacks of the last simulation. */
+    const stdair::Count_T& getNbOfRollbacks() const {
+      return _nbOfRollbacks;
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Simulate all the events of the event queue, including the ones
+     * scheduled by the handlers, until there is no more event. The
+     * progress statuses of the event queue are updated accordingly.
+     *
+     * When a handler throws an exception, the workers roll back to the
+     * GVT, the events not handled yet are given back to the event queue,
+     * and the exception is thrown again.
+     *
+     * @return stdair::Count_T Number of handled events (each one being
+     *         counted once, whatever the number of times it has been
+     *         rolled back).
+     */
+    stdair::Count_T run();
+
+  private:
+    // ////////// Helpers /////////
+    /** Worker of a partition (defined in the implementation file). */
+    class PartitionWorker;
+    friend class PartitionWorker;
+
+    /** List of workers, indexed by partition. */
+    typedef std::vector<PartitionWorker*> PartitionWorkerList_T;
+
+    /**
+     * Get the partition of the given event, after having checked that
+     * the event may be handled (its type has a progress status).
+     */
+    PartitionIndex_T getPartition (const stdair::EventStruct&) const;
+
+  private:
+    // ////////// Attributes /////////
+    /** Event queue, the events of which are simulated. */
+    EventQueue& _eventQueue;
+
+    /** Assignment of the events to the partitions. */
+    const EventPartitioner& _partitioner;
+
+    /** Event handlers, one per partition. */
+    const PartitionEventHandlerList_T& _handlerList;
+
+    /** State handlers, one per partition (or none). */
+    const PartitionStateHandlerList_T& _stateHandlerList;
+
+    /** Number of handled events between two checkpoints. */
+    const stdair::Count_T _checkpointPeriod;
+
+    /** Number of handled events between two computations of the GVT. */
+    const stdair::Count_T _gvtPeriod;
+
+    /** Event types which have a progress status in the event queue. */
+    EventTypeMask_T _declaredTypeMask;
+
+    /** Workers, one per partition. */
+    PartitionWorkerList_T _workerList;
+
+    /** Barrier on which the workers meet to compute the GVT. */
+    PartitionBarrier _barrier;
+
+    /** Number of rollbacks of the last simulation. */
+    stdair::Count_T _nbOfRollbacks;
+  };
+
+}
+#endif // __SEVMGR_CMD_OPTIMISTICSYNCHRONISER_HPP
@@ -0,0 +1,79 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+#include <limits>
+// SEvMgr
+#include <sevmgr/command/PartitionBarrier.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  PartitionBarrier::PartitionBarrier (const unsigned int& iNbOfWorkers)
+    : _nbOfWorkers (iNbOfWorkers), _nbOfWaitingWorkers (0), _generation (0),
+      _minDateTimeStamp (std::numeric_limits<stdair::LongDuration_T>::max()),
+      _hasAnyFailed (false),
+      _lastMinDateTimeStamp (std::numeric_limits<stdair::LongDuration_T>::max()),
+      _lastHasAnyFailed (false) {
+    assert (_nbOfWorkers > 0);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  PartitionBarrier::PartitionBarrier (const PartitionBarrier& iBarrier)
+    : _nbOfWorkers (0), _nbOfWaitingWorkers (0), _generation (0),
+      _minDateTimeStamp (0), _hasAnyFailed (false),
+      _lastMinDateTimeStamp (0), _lastHasAnyFailed (false) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  PartitionBarrier::~PartitionBarrier() {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void PartitionBarrier::wait() {
+    const stdair::LongDuration_T lNoDateTimeStamp =
+      std::numeric_limits<stdair::LongDuration_T>::max();
+    bool hasFailed = false;
+    reduce (lNoDateTimeStamp, hasFailed);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  stdair::LongDuration_T PartitionBarrier::
+  reduce (const stdair::LongDuration_T& iDateTimeStamp, bool& ioHasFailed) {
+    std::unique_lock<std::mutex> lLock (_mutex);
+
+    // Account for the contribution of that worker
+    if (iDateTimeStamp < _minDateTimeStamp) {
+      _minDateTimeStamp = iDateTimeStamp;
+    }
+    if (ioHasFailed == true) {
+      _hasAnyFailed = true;
+    }
+
+    ++_nbOfWaitingWorkers;
+    if (_nbOfWaitingWorkers == _nbOfWorkers) {
+      // Last worker: publish the reductions, and release the others
+      _lastMinDateTimeStamp = _minDateTimeStamp;
+      _lastHasAnyFailed = _hasAnyFailed;
+      _minDateTimeStamp = std::numeric_limits<stdair::LongDuration_T>::max();
+      _hasAnyFailed = false;
+      _nbOfWaitingWorkers = 0;
+      ++_generation;
+      _condition.notify_all();
+
+    } else {
+      const unsigned long lGeneration = _generation;
+      while (lGeneration == _generation) {
+        _condition.wait (lLock);
+      }
+    }
+
+    // The reductions of that meeting stay available until the next one
+    // completes, which cannot happen before every worker has read them
+    ioHasFailed = _lastHasAnyFailed;
+    return _lastMinDateTimeStamp;
+  }
+
+}
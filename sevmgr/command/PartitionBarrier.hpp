@@ -0,0 +1,77 @@
+#ifndef __SEVMGR_CMD_PARTITIONBARRIER_HPP
+#define __SEVMGR_CMD_PARTITIONBARRIER_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <condition_variable>
+#include <mutex>
+// StdAir
+#include <stdair/stdair_date_time_types.hpp>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Barrier on which the workers of the partitions meet, between
+   * two steps of a partitioned simulation.
+   *
+   * While meeting, the workers may share a date-time stamp (e.g., the
+   * lower bound of the date-time stamps of the events they may still
+   * send to the others) and a flag (e.g., telling that they have failed):
+   * every worker gets back the minimum of the date-time stamps and the
+   * disjunction of the flags, so that they all take the same decision.
+   */
+  class PartitionBarrier {
+  public:
+    // ////////// Constructors and destructors /////////
+    /** Constructor, for the given number of workers. */
+    PartitionBarrier (const unsigned int& iNbOfWorkers);
+    /** Destructor. */
+    ~PartitionBarrier();
+
+  private:
+    /** Copy constructor (not to be used). */
+    PartitionBarrier (const PartitionBarrier&);
+
+  public:
+    // ////////// Business methods /////////
+    /** Wait for all the workers. */
+    void wait();
+
+    /**
+     * Wait for all the workers, sharing the given date-time stamp and
+     * failure flag.
+     *
+     * @param const stdair::LongDuration_T& Date-time stamp of the worker.
+     * @param bool& Failure flag of the worker; on return, whether any
+     *        worker has failed.
+     * @return stdair::LongDuration_T Minimum of the date-time stamps of
+     *         all the workers.
+     */
+    stdair::LongDuration_T reduce (const stdair::LongDuration_T&, bool&);
+
+  private:
+    // ////////// Attributes /////////
+    /** Number of workers meeting on the barrier. */
+    const unsigned int _nbOfWorkers;
+
+    /** Number of workers waiting on the barrier. */
+    unsigned int _nbOfWaitingWorkers;
+
+    /** Number of times all the workers have met. */
+    unsigned long _generation;
+
+    /** Reductions being computed, and those of the last meeting. */
+    stdair::LongDuration_T _minDateTimeStamp;
+    bool _hasAnyFailed;
+    stdair::LongDuration_T _lastMinDateTimeStamp;
+    bool _lastHasAnyFailed;
+
+    /** Synchronisation primitives. */
+    std::mutex _mutex;
+    std::condition_variable _condition;
+  };
+
+}
+#endif // __SEVMGR_CMD_PARTITIONBARRIER_HPP
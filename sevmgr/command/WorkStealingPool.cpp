@@ -0,0 +1,177 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// SEvMgr
+#include <sevmgr/SEVMGR_Exceptions.hpp>
+#include <sevmgr/command/WorkStealingPool.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  WorkStealingPool::WorkStealingPool (const unsigned int& iNbOfThreads)
+    : _generation (0), _nbOfBusyThreads (0), _isStopping (false),
+      _executor_ptr (NULL), _hasFailed (false) {
+    if (iNbOfThreads == 0) {
+      throw EventQueueException ("At least one thread is needed");
+    }
+    for (unsigned int idx = 0; idx != iNbOfThreads; ++idx) {
+      _taskListList.push_back (new TaskList());
+    }
+    for (unsigned int idx = 1; idx != iNbOfThreads; ++idx) {
+      _threadList.push_back (std::thread (&WorkStealingPool::run, this, idx));
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  WorkStealingPool::WorkStealingPool (const WorkStealingPool& iPool)
+    : _generation (0), _nbOfBusyThreads (0), _isStopping (false),
+      _executor_ptr (NULL), _hasFailed (false) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  WorkStealingPool::~WorkStealingPool() {
+    {
+      std::lock_guard<std::mutex> lLock (_mutex);
+      _isStopping = true;
+    }
+    _startCondition.notify_all();
+    for (std::vector<std::thread>::iterator itThread = _threadList.begin();
+         itThread != _threadList.end(); ++itThread) {
+      itThread->join();
+    }
+    for (TaskListList_T::iterator itTaskList = _taskListList.begin();
+         itTaskList != _taskListList.end(); ++itTaskList) {
+      delete *itTaskList;
+    }
+    _taskListList.clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool WorkStealingPool::takeTask (TaskList& ioTaskList,
+                                   const bool& iIsNewest,
+                                   TaskIndex_T& oTaskIndex) {
+    std::lock_guard<std::mutex> lLock (ioTaskList._mutex);
+    if (ioTaskList._taskList.empty() == true) {
+      return false;
+    }
+    if (iIsNewest == true) {
+      oTaskIndex = ioTaskList._taskList.back();
+      ioTaskList._taskList.pop_back();
+    } else {
+      oTaskIndex = ioTaskList._taskList.front();
+      ioTaskList._taskList.pop_front();
+    }
+    return true;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void WorkStealingPool::executeTasks (const unsigned int& iThreadIndex) {
+    assert (_executor_ptr != NULL);
+    const unsigned int lNbOfThreads = _taskListList.size();
+
+    TaskIndex_T lTaskIndex = 0;
+    while (true) {
+      // Take the newest task of the thread, or else steal the oldest
+      // task of another thread. As no task is added during the
+      // execution, there is no more task once all the lists are empty.
+      bool hasTask = takeTask (*_taskListList[iThreadIndex], true, lTaskIndex);
+      for (unsigned int idx = 1; hasTask == false && idx != lNbOfThreads;
+           ++idx) {
+        TaskList& lVictimTaskList =
+          *_taskListList[(iThreadIndex + idx) % lNbOfThreads];
+        hasTask = takeTask (lVictimTaskList, false, lTaskIndex);
+      }
+      if (hasTask == false) {
+        return;
+      }
+
+      // Skip the remaining tasks, once a task has failed
+      if (_hasFailed.load (std::memory_order_relaxed) == true) {
+        continue;
+      }
+      try {
+        _executor_ptr->execute (lTaskIndex);
+
+      } catch (...) {
+        std::lock_guard<std::mutex> lLock (_mutex);
+        if (_exception == NULL) {
+          _exception = std::current_exception();
+        }
+        _hasFailed.store (true, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void WorkStealingPool::run (const unsigned int& iThreadIndex) {
+    unsigned long lLastGeneration = 0;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lLock (_mutex);
+        while (_isStopping == false && _generation == lLastGeneration) {
+          _startCondition.wait (lLock);
+        }
+        if (_isStopping == true) {
+          return;
+        }
+        lLastGeneration = _generation;
+      }
+
+      executeTasks (iThreadIndex);
+
+      {
+        std::lock_guard<std::mutex> lLock (_mutex);
+        --_nbOfBusyThreads;
+      }
+      _endCondition.notify_one();
+    }
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void WorkStealingPool::execute (TaskExecutor& ioExecutor,
+                                  const TaskIndex_T& iNbOfTasks) {
+    if (iNbOfTasks == 0) {
+      return;
+    }
+
+    // Spread the tasks over the threads, in a round-robin way
+    const unsigned int lNbOfThreads = _taskListList.size();
+    for (TaskIndex_T idx = 0; idx != iNbOfTasks; ++idx) {
+      TaskList& lTaskList = *_taskListList[idx % lNbOfThreads];
+      std::lock_guard<std::mutex> lLock (lTaskList._mutex);
+      lTaskList._taskList.push_back (idx);
+    }
+
+    // Wake the other threads up, and take part in the execution
+    {
+      std::lock_guard<std::mutex> lLock (_mutex);
+      _executor_ptr = &ioExecutor;
+      _exception = NULL;
+      _hasFailed.store (false, std::memory_order_relaxed);
+      _nbOfBusyThreads = lNbOfThreads - 1;
+      ++_generation;
+    }
+    _startCondition.notify_all();
+    executeTasks (0);
+
+    // Wait for the other threads
+    std::exception_ptr lException;
+    {
+      std::unique_lock<std::mutex> lLock (_mutex);
+      while (_nbOfBusyThreads != 0) {
+        _endCondition.wait (lLock);
+      }
+      _executor_ptr = NULL;
+      lException = _exception;
+      _exception = NULL;
+    }
+
+    if (lException != NULL) {
+      std::rethrow_exception (lException);
+    }
+  }
+
+}
@@ -0,0 +1,129 @@
+#ifndef __SEVMGR_CMD_WORKSTEALINGPOOL_HPP
+#define __SEVMGR_CMD_WORKSTEALINGPOOL_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SEVMGR {
+
+  /**
+   * @brief Pool of threads, executing sets of independent tasks.
+   *
+   * The tasks of a set are spread over the (double-ended) task lists of
+   * the threads. Each thread executes the tasks of its own list, newest
+   * first; once its list is empty, it steals the oldest tasks of the
+   * other lists. Hence, the threads stay busy even when the tasks have
+   * very different durations.
+   *
+   * The thread calling execute() takes part in the execution, as the
+   * first thread of the pool.
+   */
+  class WorkStealingPool {
+  public:
+    // ////////// Type definitions ////////////
+    /** Index of a task within a set of tasks. */
+    typedef std::size_t TaskIndex_T;
+
+    /**
+     * @brief Interface executing the tasks of a set, given their index.
+     */
+    class TaskExecutor {
+    public:
+      /** Destructor. */
+      virtual ~TaskExecutor() {}
+
+      /** Execute the task of the given index. */
+      virtual void execute (const TaskIndex_T&) = 0;
+    };
+
+  public:
+    // ////////// Constructors and destructors /////////
+    /**
+     * Constructor.
+     *
+     * @param const unsigned int& Number of threads, including the one
+     *        calling execute(). It must be strictly positive.
+     */
+    WorkStealingPool (const unsigned int& iNbOfThreads);
+    /** Destructor. The threads are stopped. */
+    ~WorkStealingPool();
+
+  private:
+    /** Copy constructor (not to be used). */
+    WorkStealingPool (const WorkStealingPool&);
+
+  public:
+    // /////////// Getters ///////////////
+    /** Get the number of threads, including the one calling execute(). */
+    unsigned int getNbOfThreads() const {
+      return _taskListList.size();
+    }
+
+  public:
+    // ////////// Business methods /////////
+    /**
+     * Execute the given number of tasks, and wait until all of them have
+     * been executed.
+     *
+     * When a task throws an exception, the tasks not started yet are
+     * skipped, and the (first) exception is thrown again.
+     */
+    void execute (TaskExecutor&, const TaskIndex_T& iNbOfTasks);
+
+  private:
+    // ////////// Helpers /////////
+    /** Task list of a thread. */
+    struct TaskList {
+      std::mutex _mutex;
+      std::deque<TaskIndex_T> _taskList;
+    };
+    typedef std::vector<TaskList*> TaskListList_T;
+
+    /** Main loop of the threads of the pool (but the first one). */
+    void run (const unsigned int& iThreadIndex);
+
+    /**
+     * Execute the tasks of the given thread, then steal the ones of the
+     * others, until there is no more task.
+     */
+    void executeTasks (const unsigned int& iThreadIndex);
+
+    /** Take a task from the given thread list, either the newest or the oldest. */
+    bool takeTask (TaskList&, const bool& iIsNewest, TaskIndex_T&);
+
+  private:
+    // ////////// Attributes /////////
+    /** Task lists, one per thread. */
+    TaskListList_T _taskListList;
+
+    /** Threads of the pool (but the first one). */
+    std::vector<std::thread> _threadList;
+
+    /** Synchronisation of the start and of the end of the executions. */
+    std::mutex _mutex;
+    std::condition_variable _startCondition;
+    std::condition_variable _endCondition;
+    unsigned long _generation;
+    unsigned int _nbOfBusyThreads;
+    bool _isStopping;
+
+    /** Executor of the current set of tasks. */
+    TaskExecutor* _executor_ptr;
+
+    /** First exception thrown by a task of the current set, if any. */
+    std::atomic<bool> _hasFailed;
+    std::exception_ptr _exception;
+  };
+
+}
+#endif // __SEVMGR_CMD_WORKSTEALINGPOOL_HPP
@@ -0,0 +1,43 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// Sevmgr
+#include <sevmgr/bom/EventQueue.hpp>
+#include <sevmgr/factory/FacEventQueue.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  FacEventQueue::FacEventQueue() {
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  FacEventQueue::FacEventQueue (const FacEventQueue& iFactory) {
+    assert (false);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  FacEventQueue::~FacEventQueue() {
+    for (std::vector<EventQueue*>::iterator itEventQueue = _pool.begin();
+         itEventQueue != _pool.end(); ++itEventQueue) {
+      delete *itEventQueue;
+    }
+    _pool.clear();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueue& FacEventQueue::create (const EventQueueKey& iKey) {
+    EventQueue* aEventQueue_ptr = NULL;
+
+    aEventQueue_ptr = new EventQueue (iKey);
+    assert (aEventQueue_ptr != NULL);
+
+    // The new object is added to the pool of the factory
+    _pool.push_back (aEventQueue_ptr);
+
+    return *aEventQueue_ptr;
+  }
+
+}
@@ -0,0 +1,49 @@
+#ifndef __SEVMGR_FAC_FACEVENTQUEUE_HPP
+#define __SEVMGR_FAC_FACEVENTQUEUE_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <vector>
+// Sevmgr
+#include <sevmgr/SEVMGR_Types.hpp>
+
+namespace SEVMGR {
+
+  /** Forward declarations. */
+  class EventQueue;
+  struct EventQueueKey;
+
+  /** Factory for the EventQueue objects of a service context.
+      <br>Contrary to the (process-wide) StdAir BOM factories, that factory
+      is owned by the service context: the event queues of a service are
+      neither shared with, nor visible from, the other services, which may
+      hence be created, used and destroyed concurrently. */
+  class FacEventQueue {
+  public:
+    /** Constructor. */
+    FacEventQueue();
+
+    /** Destructor.
+        <br>All the EventQueue objects created by that factory are
+        deleted. */
+    ~FacEventQueue();
+
+    /** Create a new EventQueue object.
+        <br>This new object is added to the list of instantiated objects.
+        @param const EventQueueKey& Key of the event queue.
+        @return EventQueue& The newly created object. */
+    EventQueue& create (const EventQueueKey&);
+
+  private:
+    /** Copy constructor (not to be used). */
+    FacEventQueue (const FacEventQueue&);
+
+  private:
+    /** The instantiated EventQueue objects. */
+    std::vector<EventQueue*> _pool;
+  };
+
+}
+#endif // __SEVMGR_FAC_FACEVENTQUEUE_HPP
@@ -0,0 +1,53 @@
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// STL
+#include <cassert>
+// Sevmgr
+#include <sevmgr/bom/MapEventQueueBackend.hpp>
+#include <sevmgr/bom/DAryHeapEventQueueBackend.hpp>
+#include <sevmgr/bom/CalendarEventQueueBackend.hpp>
+#include <sevmgr/bom/CompactHeapEventQueueBackend.hpp>
+#include <sevmgr/bom/ShardedEventQueueBackend.hpp>
+#include <sevmgr/factory/FacEventQueueBackend.hpp>
+
+namespace SEVMGR {
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueueBackend* FacEventQueueBackend::
+  create (const EventQueueBackendType::EN_EventQueueBackendType& iType) {
+    EventQueueBackend* oBackend_ptr = NULL;
+
+    switch (iType) {
+    case EventQueueBackendType::DARY_HEAP: {
+      oBackend_ptr = new DAryHeapEventQueueBackend();
+      break;
+    }
+    case EventQueueBackendType::CALENDAR: {
+      oBackend_ptr = new CalendarEventQueueBackend();
+      break;
+    }
+    case EventQueueBackendType::POOLED_MAP: {
+      oBackend_ptr = new MapEventQueueBackend (true);
+      break;
+    }
+    case EventQueueBackendType::COMPACT_HEAP: {
+      oBackend_ptr = new CompactHeapEventQueueBackend();
+      break;
+    }
+    case EventQueueBackendType::SHARDED: {
+      oBackend_ptr = new ShardedEventQueueBackend();
+      break;
+    }
+    case EventQueueBackendType::MAP:
+    default: {
+      oBackend_ptr = new MapEventQueueBackend();
+      break;
+    }
+    }
+    assert (oBackend_ptr != NULL);
+
+    return oBackend_ptr;
+  }
+
+}
@@ -0,0 +1,27 @@
+#ifndef __SEVMGR_FAC_FACEVENTQUEUEBACKEND_HPP
+#define __SEVMGR_FAC_FACEVENTQUEUEBACKEND_HPP
+
+// //////////////////////////////////////////////////////////////////////
+// Import section
+// //////////////////////////////////////////////////////////////////////
+// Sevmgr
+#include <sevmgr/SEVMGR_Types.hpp>
+
+namespace SEVMGR {
+
+  /** Forward declarations. */
+  class EventQueueBackend;
+
+  /** Factory for the storage backends of the EventQueue objects. */
+  class FacEventQueueBackend {
+  public:
+    /** Create a new backend of the given type (e.g., map, d-ary heap).
+        <br>The caller (usually, the EventQueue object) takes the ownership
+        of the newly created object, and is responsible for deleting it.
+        @return EventQueueBackend* The newly created object. */
+    static EventQueueBackend*
+    create (const EventQueueBackendType::EN_EventQueueBackendType&);
+  };
+
+}
+#endif // __SEVMGR_FAC_FACEVENTQUEUEBACKEND_HPP
@@ -3,6 +3,7 @@
 // //////////////////////////////////////////////////////////////////////
 // STL
 #include <cassert>
+#include <algorithm>
 // StdAir
 #include <stdair/service/FacSupervisor.hpp>
 // Sevmgr
@@ -12,6 +13,7 @@
 namespace SEVMGR {
 
   FacSEVMGRServiceContext* FacSEVMGRServiceContext::_instance = NULL;
+  std::mutex FacSEVMGRServiceContext::_mutex;
 
   // //////////////////////////////////////////////////////////////////////
   FacSEVMGRServiceContext::~FacSEVMGRServiceContext () {
@@ -20,6 +22,7 @@ namespace SEVMGR {
 
   // //////////////////////////////////////////////////////////////////////
   FacSEVMGRServiceContext& FacSEVMGRServiceContext::instance () {
+    std::lock_guard<std::mutex> lLock (_mutex);
 
     if (_instance == NULL) {
       _instance = new FacSEVMGRServiceContext();
@@ -31,16 +34,38 @@ namespace SEVMGR {
   }
 
   // //////////////////////////////////////////////////////////////////////
-  SEVMGR_ServiceContext& FacSEVMGRServiceContext::create () {
+  SEVMGR_ServiceContext& FacSEVMGRServiceContext::
+  create (const EventQueueBackendType::EN_EventQueueBackendType& iBackendType) {
     SEVMGR_ServiceContext* aServiceContext_ptr = NULL;
 
-    aServiceContext_ptr = new SEVMGR_ServiceContext ();
+    aServiceContext_ptr = new SEVMGR_ServiceContext (iBackendType);
     assert (aServiceContext_ptr != NULL);
 
     // The new object is added to the Bom pool
+    std::lock_guard<std::mutex> lLock (_mutex);
     _pool.push_back (aServiceContext_ptr);
 
     return *aServiceContext_ptr;
   }
 
+  // //////////////////////////////////////////////////////////////////////
+  void FacSEVMGRServiceContext::
+  destroy (SEVMGR_ServiceContext& ioServiceContext) {
+    {
+      std::lock_guard<std::mutex> lLock (_mutex);
+      ServicePool_T::iterator itServiceContext =
+        std::find (_pool.begin(), _pool.end(), &ioServiceContext);
+      if (itServiceContext == _pool.end()) {
+        // The object has already been deleted (e.g., along with the
+        // whole pool, at the end of the process)
+        return;
+      }
+      _pool.erase (itServiceContext);
+    }
+
+    // The object is deleted outside of the lock: it does not share
+    // any state with the other service contexts
+    delete &ioServiceContext;
+  }
+
 }
@@ -4,6 +4,8 @@
 // //////////////////////////////////////////////////////////////////////
 // Import section
 // //////////////////////////////////////////////////////////////////////
+// STL
+#include <mutex>
 // StdAir
 #include <stdair/service/FacServiceAbstract.hpp>
 // Sevmgr
@@ -19,7 +21,8 @@ namespace SEVMGR {
   public:
 
     /** Provide the unique instance.
-        <br> The singleton is instantiated when first used
+        <br> The singleton is instantiated when first used. That method
+        may be called from several threads.
         @return FacSEVMGRServiceContext& */
     static FacSEVMGRServiceContext& instance();
 
@@ -31,8 +34,19 @@ namespace SEVMGR {
 
     /** Create a new SEVMGR_ServiceContext object.
         <br>This new object is added to the list of instantiated objects.
+        @param const EventQueueBackendType::EN_EventQueueBackendType& Type
+        of the storage backend of the event queue.
+        <br>That method may be called from several threads.
         @return SEVMGR_ServiceContext& The newly created object. */
-    SEVMGR_ServiceContext& create ();
+    SEVMGR_ServiceContext&
+    create (const EventQueueBackendType::EN_EventQueueBackendType&);
+
+    /** Delete the given SEVMGR_ServiceContext object, and remove it from
+        the list of instantiated objects (e.g., when the owning service is
+        destroyed, so that the contexts do not pile up over the
+        replications of a simulation).
+        <br>That method may be called from several threads. */
+    void destroy (SEVMGR_ServiceContext&);
 
     
   protected:
@@ -44,6 +58,9 @@ namespace SEVMGR {
   private:
     /** The unique instance.*/
     static FacSEVMGRServiceContext* _instance;
+
+    /** Mutex protecting the unique instance and its pool of objects. */
+    static std::mutex _mutex;
   };
 
 }
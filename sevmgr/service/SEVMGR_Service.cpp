@@ -40,8 +40,10 @@ namespace SEVMGR {
   }
 
   // //////////////////////////////////////////////////////////////////////
-  SEVMGR_Service::SEVMGR_Service (const stdair::BasLogParams& iLogParams,
-                                  const stdair::BasDBParams& iDBParams)
+  SEVMGR_Service::
+  SEVMGR_Service (const stdair::BasLogParams& iLogParams,
+                  const stdair::BasDBParams& iDBParams,
+                  const EventQueueBackendType::EN_EventQueueBackendType& iBackendType)
     : _sevmgrServiceContext (NULL) {
     
     // Initialise the STDAIR service handler
@@ -49,7 +51,7 @@ namespace SEVMGR {
       initStdAirService (iLogParams, iDBParams);
     
     // Initialise the service context
-    initServiceContext();
+    initServiceContext (iBackendType);
 
     // Add the StdAir service context to the SEvMgr service context
     // \note SEvMgr owns the STDAIR service resources here.
@@ -61,7 +63,9 @@ namespace SEVMGR {
   }
 
   // //////////////////////////////////////////////////////////////////////
-  SEVMGR_Service::SEVMGR_Service (const stdair::BasLogParams& iLogParams)
+  SEVMGR_Service::
+  SEVMGR_Service (const stdair::BasLogParams& iLogParams,
+                  const EventQueueBackendType::EN_EventQueueBackendType& iBackendType)
     : _sevmgrServiceContext (NULL) {
     
     // Initialise the STDAIR service handler
@@ -69,7 +73,7 @@ namespace SEVMGR {
       initStdAirService (iLogParams);
     
     // Initialise the service context
-    initServiceContext();
+    initServiceContext (iBackendType);
 
     // Add the StdAir service context to the SEvMgr service context
     // \note SEvMgr owns the STDAIR service resources here.
@@ -82,11 +86,12 @@ namespace SEVMGR {
 
   // ////////////////////////////////////////////////////////////////////
   SEVMGR_Service::
-  SEVMGR_Service (stdair::STDAIR_ServicePtr_T ioSTDAIR_Service_ptr)
+  SEVMGR_Service (stdair::STDAIR_ServicePtr_T ioSTDAIR_Service_ptr,
+                  const EventQueueBackendType::EN_EventQueueBackendType& iBackendType)
     : _sevmgrServiceContext (NULL) {
 
     // Initialise the service context
-    initServiceContext();
+    initServiceContext (iBackendType);
 
     // Add the StdAir service context to the SEvMgr service context
     // \note SEvMgr does not own the STDAIR service resources here.
@@ -108,13 +113,18 @@ namespace SEVMGR {
     assert (_sevmgrServiceContext != NULL);
     // Reset the (Boost.)Smart pointer pointing on the STDAIR_Service object.
     _sevmgrServiceContext->reset();
+
+    // Delete the service context, along with its event queues
+    FacSEVMGRServiceContext::instance().destroy (*_sevmgrServiceContext);
+    _sevmgrServiceContext = NULL;
   }
 
   // //////////////////////////////////////////////////////////////////////
-  void SEVMGR_Service::initServiceContext() {
+  void SEVMGR_Service::
+  initServiceContext (const EventQueueBackendType::EN_EventQueueBackendType& iBackendType) {
     // Initialise the service context
     SEVMGR_ServiceContext& lSEVMGR_ServiceContext = 
-      FacSEVMGRServiceContext::instance().create();
+      FacSEVMGRServiceContext::instance().create (iBackendType);
     _sevmgrServiceContext = &lSEVMGR_ServiceContext;
   }
 
@@ -413,8 +423,8 @@ namespace SEVMGR {
   }
 
   // ////////////////////////////////////////////////////////////////////
-  void SEVMGR_Service::
-  run (stdair::EventStruct& iEventStruct) const {
+  stdair::ProgressStatusSet SEVMGR_Service::
+  extractEvent (const stdair::EventStruct*& oEventStruct_ptr) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -428,14 +438,11 @@ namespace SEVMGR {
     EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
     
     // Delegate the call to the dedicated command
-    EventQueueManager::run (lQueue, iEventStruct);
-    
+    return EventQueueManager::extractEvent (lQueue, oEventStruct_ptr);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  bool SEVMGR_Service::
-  select (stdair::EventStruct& iEventStruct,
-          const stdair::DateTime_T& iEventDateTime) const {
+  const stdair::EventStruct* SEVMGR_Service::peekNextEvent() const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -447,16 +454,13 @@ namespace SEVMGR {
 
     // Retrieve the event queue object instance
     EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
-    
+
     // Delegate the call to the dedicated command
-    return EventQueueManager::select (lQueue, iEventStruct, iEventDateTime);
-    
+    return EventQueueManager::peekEvent (lQueue);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  void SEVMGR_Service::
-  updateStatus (const stdair::EventType::EN_EventType& iEventType,
-                const stdair::Count_T& iEventCount) const {
+  stdair::DateTime_T SEVMGR_Service::getNextEventDateTime() const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -468,15 +472,14 @@ namespace SEVMGR {
 
     // Retrieve the event queue object instance
     EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
-    
+
     // Delegate the call to the dedicated command
-    EventQueueManager::updateStatus (lQueue, iEventType, iEventCount);
+    return EventQueueManager::getNextEventDateTime (lQueue);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  void SEVMGR_Service::
-  addStatus (const stdair::EventType::EN_EventType& iEventType,
-             const stdair::Count_T& iEventCount) const {
+  EventBrowserPtr_T SEVMGR_Service::
+  browseEvents (const stdair::DateTime_T& iHorizonDateTime) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -488,13 +491,15 @@ namespace SEVMGR {
 
     // Retrieve the event queue object instance
     EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
-    
-    // Delegate the call to the dedicated function
-    EventQueueManager::addStatus (lQueue, iEventType, iEventCount);
+
+    // Delegate the call to the dedicated command
+    return EventQueueManager::browseEvents (lQueue, iHorizonDateTime);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  bool SEVMGR_Service::isQueueDone() const {
+  EventBrowserPtr_T SEVMGR_Service::
+  browseEvents (const stdair::DateTime_T& iFromDateTime,
+                const stdair::DateTime_T& iToDateTime) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -502,21 +507,21 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
 
     // Retrieve the event queue object instance
-    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
-    
-    // Calculates whether the event queue has been fully emptied
-    const bool isQueueDone = EventQueueManager::isQueueDone(lQueue);
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
 
-    //
-    return isQueueDone;
-  } 
+    // Delegate the call to the dedicated command
+    return EventQueueManager::browseEvents (lQueue, iFromDateTime,
+                                            iToDateTime);
+  }
 
   // ////////////////////////////////////////////////////////////////////
-  bool SEVMGR_Service::hasProgressStatus(const stdair::EventType::EN_EventType& iEventType) const {
+  EventBrowserPtr_T SEVMGR_Service::
+  browseEvents (const stdair::DateTime_T& iFromDateTime,
+                const stdair::DateTime_T& iToDateTime,
+                const stdair::EventType::EN_EventType& iEventType) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -524,22 +529,20 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
 
     // Retrieve the event queue object instance
-    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
-    
-    // Calculates whether the event queue has been fully emptied
-    const bool hasProgressStatus = 
-       EventQueueManager::hasProgressStatus (lQueue, iEventType);
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
 
-    //
-    return hasProgressStatus;
+    // Delegate the call to the dedicated command
+    return EventQueueManager::browseEvents (lQueue, iFromDateTime,
+                                            iToDateTime, iEventType);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::Count_T SEVMGR_Service::getQueueSize() const {
+  stdair::Count_T SEVMGR_Service::
+  countEvents (const stdair::DateTime_T& iFromDateTime,
+               const stdair::DateTime_T& iToDateTime) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -547,18 +550,21 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
 
     // Retrieve the event queue object instance
-    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
-    
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+
     // Delegate the call to the dedicated command
-    return EventQueueManager::getQueueSize(lQueue);
+    return EventQueueManager::countEvents (lQueue, iFromDateTime,
+                                           iToDateTime);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  void SEVMGR_Service::reset() const {
+  stdair::Count_T SEVMGR_Service::
+  countEvents (const stdair::DateTime_T& iFromDateTime,
+               const stdair::DateTime_T& iToDateTime,
+               const stdair::EventType::EN_EventType& iEventType) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -566,34 +572,41 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
 
     // Retrieve the event queue object instance
     EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
-    
+
     // Delegate the call to the dedicated command
-    EventQueueManager::reset (lQueue);
-  }  
+    return EventQueueManager::countEvents (lQueue, iFromDateTime,
+                                           iToDateTime, iEventType);
+  }
 
-  // //////////////////////////////////////////////////////////////////////
-  EventQueue& SEVMGR_Service::getEventQueue() const {  
+  // ////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet SEVMGR_Service::
+  popEvents (EventStructList_T& ioEventStructList,
+             const stdair::Count_T& iMaxNbOfEvents) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
       throw stdair::NonInitialisedServiceException ("The SEvMgr service "
                                                     "has not been initialised");
     }
-    assert (_sevmgrServiceContext != NULL);  
-
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
 
-    return lSEVMGR_ServiceContext.getEventQueue();
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::popEvents (lQueue, ioEventStructList,
+                                         iMaxNbOfEvents);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  void SEVMGR_Service::addEvent(stdair::EventStruct& iEventStruct) const {
+  stdair::ProgressStatusSet SEVMGR_Service::
+  popEventsUntil (EventStructList_T& ioEventStructList,
+                  const stdair::DateTime_T& iDateTime) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -601,19 +614,19 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
 
     // Retrieve the event queue object instance
     EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
     
     // Delegate the call to the dedicated command
-    EventQueueManager::addEvent (lQueue, iEventStruct);
-  } 
+    return EventQueueManager::popEventsUntil (lQueue, ioEventStructList,
+                                              iDateTime);
+  }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::Count_T& SEVMGR_Service::
-  getExpectedTotalNumberOfEventsToBeGenerated() const {
+  stdair::Count_T SEVMGR_Service::
+  skipEventsBefore (const stdair::DateTime_T& iDateTime) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -621,19 +634,19 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
-    
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
     // Retrieve the event queue object instance
-    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
     
-    // Delegate the call to the dedicated function
-    return EventQueueManager::getExpectedTotalNumberOfEventsToBeGenerated (lQueue);
+    // Delegate the call to the dedicated command
+    return EventQueueManager::skipEventsBefore (lQueue, iDateTime);
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::Count_T& SEVMGR_Service::
-  getExpectedTotalNumberOfEventsToBeGenerated(const stdair::EventType::EN_EventType& iEventType) const {
+  stdair::Count_T SEVMGR_Service::
+  popEventsBefore (EventStructList_T& ioEventStructList,
+                   const stdair::DateTime_T& iDateTime) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -641,20 +654,19 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
-    
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
     // Retrieve the event queue object instance
-    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
     
-    // Delegate the call to the dedicated function
-    return EventQueueManager::getExpectedTotalNumberOfEventsToBeGenerated (lQueue,
-                                                                           iEventType);
-  } 
+    // Delegate the call to the dedicated command
+    return EventQueueManager::popEventsBefore (lQueue, ioEventStructList,
+                                               iDateTime);
+  }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::Count_T& SEVMGR_Service::
-  getActualTotalNumberOfEventsToBeGenerated() const {
+  void SEVMGR_Service::
+  run (stdair::EventStruct& iEventStruct) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -662,20 +674,19 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
-    
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
     // Retrieve the event queue object instance
-    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    EventQueueManager::run (lQueue, iEventStruct);
     
-    // Delegate the call to the dedicated function
-    return EventQueueManager::getActualTotalNumberOfEventsToBeGenerated(lQueue);
-
   }
 
   // ////////////////////////////////////////////////////////////////////
-  const stdair::Count_T& SEVMGR_Service::
-  getActualTotalNumberOfEventsToBeGenerated(const stdair::EventType::EN_EventType& iEventType) const {
+  stdair::Count_T SEVMGR_Service::
+  run (const EventHandlerRegistry& iRegistry) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -683,36 +694,89 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
     
+    // Delegate the call to the dedicated command
+    return EventQueueManager::run (lQueue, iRegistry);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  RunReport SEVMGR_Service::
+  run (const EventHandlerRegistry& iRegistry,
+       const RunStopCondition& iStopCondition) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
     // Retrieve the event queue object instance
-    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
     
-    // Delegate the call to the dedicated function
-    return EventQueueManager::getActualTotalNumberOfEventsToBeGenerated(lQueue,
-                                                                        iEventType);
+    // Delegate the call to the dedicated command
+    return EventQueueManager::run (lQueue, iRegistry, iStopCondition);
+  }
 
+  // ////////////////////////////////////////////////////////////////////
+  RunReport SEVMGR_Service::
+  runUntil (const stdair::DateTime_T& iDateTime,
+            const EventHandlerRegistry& iRegistry) const {
+    RunStopCondition lStopCondition;
+    lStopCondition.setUntilDateTime (iDateTime);
+    return run (iRegistry, lStopCondition);
   }
 
-  //////////////////////////////////////////////////////////////////////
-  const stdair::STDAIR_Service& SEVMGR_Service::getSTDAIR_Service() const {
+  // ////////////////////////////////////////////////////////////////////
+  RunReport SEVMGR_Service::
+  runFor (const stdair::Count_T& iNbOfEvents,
+          const EventHandlerRegistry& iRegistry) const {
+    RunStopCondition lStopCondition;
+    lStopCondition.setMaxNbOfEvents (iNbOfEvents);
+    return run (iRegistry, lStopCondition);
+  }
 
-      // Retrieve the StdAir service context
+  // ////////////////////////////////////////////////////////////////////
+  RunReport SEVMGR_Service::
+  runUntil (const EventTypeSet_T& iEventTypeSet,
+            const EventHandlerRegistry& iRegistry) const {
+    RunStopCondition lStopCondition;
+    lStopCondition.setStopEventTypeSet (iEventTypeSet);
+    return run (iRegistry, lStopCondition);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T SEVMGR_Service::
+  runPipelined (const PipelineEventGeneratorList_T& iGeneratorList,
+                const stdair::Duration_T& iHorizon,
+                const EventHandlerRegistry& iRegistry) const {
+
+    // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
       throw stdair::NonInitialisedServiceException ("The SEvMgr service "
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    const stdair::STDAIR_Service& lSTDAIR_Service =
-      _sevmgrServiceContext->getSTDAIR_Service();
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
 
-    //
-    return lSTDAIR_Service;
-  }  
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::runPipelined (lQueue, iGeneratorList, iHorizon,
+                                            iRegistry);
+  }
 
-  //////////////////////////////////////////////////////////////////////
-  const stdair::ProgressStatus& SEVMGR_Service::getStatus() const {  
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T SEVMGR_Service::
+  runPartitioned (const EventPartitioner& iPartitioner,
+                  const PartitionEventHandlerList_T& iHandlerList,
+                  const EventLookaheadMap_T& iLookaheadMap) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -720,20 +784,23 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
-    
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
     // Retrieve the event queue object instance
     EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
-
-    // Delegate the call to the dedicated function
-    return EventQueueManager::getStatus(lQueue);
-  
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::runPartitioned (lQueue, iPartitioner,
+                                              iHandlerList, iLookaheadMap);
   }
 
-  //////////////////////////////////////////////////////////////////////
-  const stdair::ProgressStatus& SEVMGR_Service::
-  getStatus(const stdair::EventType::EN_EventType& iEventType) const {  
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T SEVMGR_Service::
+  runOptimistic (const EventPartitioner& iPartitioner,
+                 const PartitionEventHandlerList_T& iHandlerList,
+                 const PartitionStateHandlerList_T& iStateHandlerList,
+                 const stdair::Count_T& iCheckpointPeriod,
+                 const stdair::Count_T& iGVTPeriod) const {
 
     // Retrieve the SEvMgr service context
     if (_sevmgrServiceContext == NULL) {
@@ -741,16 +808,688 @@ namespace SEVMGR {
                                                     "has not been initialised");
     }
     assert (_sevmgrServiceContext != NULL);
-    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
-      *_sevmgrServiceContext;
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
     
+    // Delegate the call to the dedicated command
+    return EventQueueManager::runOptimistic (lQueue, iPartitioner,
+                                             iHandlerList, iStateHandlerList,
+                                             iCheckpointPeriod, iGVTPeriod);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T SEVMGR_Service::
+  runWindowed (const stdair::Duration_T& iWindowLength,
+               const EventConflictKeyExtractor& iConflictKeyExtractor,
+               ConcurrentEventHandler& ioHandler,
+               const unsigned int& iNbOfThreads) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
     // Retrieve the event queue object instance
     EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::runWindowed (lQueue, iWindowLength,
+                                           iConflictKeyExtractor, ioHandler,
+                                           iNbOfThreads);
+  }
 
-    // Delegate the call to the dedicated function
-    return EventQueueManager::getStatus(lQueue, iEventType);
-  
+  // ////////////////////////////////////////////////////////////////////
+  bool SEVMGR_Service::
+  select (stdair::EventStruct& iEventStruct,
+          const stdair::DateTime_T& iEventDateTime) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::select (lQueue, iEventStruct, iEventDateTime);
+    
   }
 
+  // ////////////////////////////////////////////////////////////////////
+  bool SEVMGR_Service::
+  seek (stdair::EventStruct& iEventStruct,
+        const stdair::DateTime_T& iEventDateTime) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::seek (lQueue, iEventStruct, iEventDateTime);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void SEVMGR_Service::
+  updateStatus (const stdair::EventType::EN_EventType& iEventType,
+                const stdair::Count_T& iEventCount) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    EventQueueManager::updateStatus (lQueue, iEventType, iEventCount);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void SEVMGR_Service::
+  addStatus (const stdair::EventType::EN_EventType& iEventType,
+             const stdair::Count_T& iEventCount) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated function
+    EventQueueManager::addStatus (lQueue, iEventType, iEventCount);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  bool SEVMGR_Service::isQueueDone() const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Calculates whether the event queue has been fully emptied
+    const bool isQueueDone = EventQueueManager::isQueueDone(lQueue);
+
+    //
+    return isQueueDone;
+  } 
+
+  // ////////////////////////////////////////////////////////////////////
+  bool SEVMGR_Service::hasProgressStatus(const stdair::EventType::EN_EventType& iEventType) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Calculates whether the event queue has been fully emptied
+    const bool hasProgressStatus = 
+       EventQueueManager::hasProgressStatus (lQueue, iEventType);
+
+    //
+    return hasProgressStatus;
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const stdair::Count_T SEVMGR_Service::getQueueSize() const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::getQueueSize(lQueue);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  stdair::Count_T SEVMGR_Service::
+  getQueueSize (const stdair::EventType::EN_EventType& iEventType) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::getQueueSize (lQueue, iEventType);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void SEVMGR_Service::reset() const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    EventQueueManager::reset (lQueue);
+  }  
+
+  // ////////////////////////////////////////////////////////////////////
+  void SEVMGR_Service::
+  setQueueBackendType (const EventQueueBackendType::EN_EventQueueBackendType& iType) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service has "
+                                                    "not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    EventQueueManager::setBackendType (lQueue, iType);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  EventQueueBackendType::EN_EventQueueBackendType SEVMGR_Service::
+  getQueueBackendType() const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service has "
+                                                    "not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::getBackendType (lQueue);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void SEVMGR_Service::
+  setQueueMultiProducer (const bool& iIsMultiProducer) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service has "
+                                                    "not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    EventQueueManager::setMultiProducer (lQueue, iIsMultiProducer);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  bool SEVMGR_Service::isQueueMultiProducer() const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service has "
+                                                    "not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::isMultiProducer (lQueue);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  void SEVMGR_Service::
+  setQueueTimeIndexed (const bool& iIsTimeIndexed) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext = *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+
+    // Delegate the call to the dedicated command
+    EventQueueManager::setTimeIndexed (lQueue, iIsTimeIndexed);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueue& SEVMGR_Service::getEventQueue() const {  
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);  
+
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    return lSEVMGR_ServiceContext.getEventQueue();
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void SEVMGR_Service::
+  addEventQueue (const EventQueueID_T& iEventQueueID,
+                 const EventQueueBackendType::EN_EventQueueBackendType& iType) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Create the event queue
+    const EventQueueKey lKey (iEventQueueID);
+    lSEVMGR_ServiceContext.addEventQueue (lKey, iType);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool SEVMGR_Service::hasEventQueue (const EventQueueID_T& iEventQueueID) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    const SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    const EventQueueKey lKey (iEventQueueID);
+    return lSEVMGR_ServiceContext.hasEventQueue (lKey);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void SEVMGR_Service::
+  selectEventQueue (const EventQueueID_T& iEventQueueID) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Select the event queue
+    const EventQueueKey lKey (iEventQueueID);
+    lSEVMGR_ServiceContext.setEventQueue (lKey);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueue& SEVMGR_Service::
+  getEventQueue (const EventQueueID_T& iEventQueueID) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    const SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    const EventQueueKey lKey (iEventQueueID);
+    return lSEVMGR_ServiceContext.getEventQueue (lKey);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  EventHandle SEVMGR_Service::
+  addEvent(const stdair::EventStruct& iEventStruct) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated command
+    return EventQueueManager::addEvent (lQueue, iEventStruct);
+  } 
+
+  // //////////////////////////////////////////////////////////////////////
+  bool SEVMGR_Service::cancelEvent (const EventHandle& iEventHandle) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+
+    // Delegate the call to the dedicated command
+    return EventQueueManager::cancelEvent (lQueue, iEventHandle);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventHandle SEVMGR_Service::
+  rescheduleEvent (const EventHandle& iEventHandle,
+                   const stdair::EventStruct& iEventStruct) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+
+    // Delegate the call to the dedicated command
+    return EventQueueManager::rescheduleEvent (lQueue, iEventHandle,
+                                               iEventStruct);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool SEVMGR_Service::isEventQueued (const EventHandle& iEventHandle) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    const SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+
+    // Delegate the call to the dedicated command
+    return EventQueueManager::isEventQueued (lQueue, iEventHandle);
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void SEVMGR_Service::
+  addEvents(const EventStructList_T& iEventStructList) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+
+    // Delegate the call to the dedicated command
+    EventQueueManager::addEvents (lQueue, iEventStructList);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const stdair::Count_T& SEVMGR_Service::
+  getExpectedTotalNumberOfEventsToBeGenerated() const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+    
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated function
+    return EventQueueManager::getExpectedTotalNumberOfEventsToBeGenerated (lQueue);
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const stdair::Count_T& SEVMGR_Service::
+  getExpectedTotalNumberOfEventsToBeGenerated(const stdair::EventType::EN_EventType& iEventType) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+    
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated function
+    return EventQueueManager::getExpectedTotalNumberOfEventsToBeGenerated (lQueue,
+                                                                           iEventType);
+  } 
+
+  // ////////////////////////////////////////////////////////////////////
+  const stdair::Count_T& SEVMGR_Service::
+  getActualTotalNumberOfEventsToBeGenerated() const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+    
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated function
+    return EventQueueManager::getActualTotalNumberOfEventsToBeGenerated(lQueue);
+
+  }
+
+  // ////////////////////////////////////////////////////////////////////
+  const stdair::Count_T& SEVMGR_Service::
+  getActualTotalNumberOfEventsToBeGenerated(const stdair::EventType::EN_EventType& iEventType) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+    
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+    
+    // Delegate the call to the dedicated function
+    return EventQueueManager::getActualTotalNumberOfEventsToBeGenerated(lQueue,
+                                                                        iEventType);
+
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  const stdair::STDAIR_Service& SEVMGR_Service::getSTDAIR_Service() const {
+
+      // Retrieve the StdAir service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    const stdair::STDAIR_Service& lSTDAIR_Service =
+      _sevmgrServiceContext->getSTDAIR_Service();
+
+    //
+    return lSTDAIR_Service;
+  }  
+
+  //////////////////////////////////////////////////////////////////////
+  const stdair::ProgressStatus& SEVMGR_Service::getStatus() const {  
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+    
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+
+    // Delegate the call to the dedicated function
+    return EventQueueManager::getStatus(lQueue);
+  
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  const stdair::ProgressStatus& SEVMGR_Service::
+  getStatus(const stdair::EventType::EN_EventType& iEventType) const {  
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+    
+    // Retrieve the event queue object instance
+    EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+
+    // Delegate the call to the dedicated function
+    return EventQueueManager::getStatus(lQueue, iEventType);
+  
+  }
+
+
+  //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatus SEVMGR_Service::getMonitoredStatus() const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+    
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+
+    // Delegate the call to the dedicated function
+    return EventQueueManager::getMonitoredStatus (lQueue);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  stdair::ProgressStatusSet SEVMGR_Service::
+  getMonitoredStatus (const stdair::EventType::EN_EventType& iEventType) const {
+
+    // Retrieve the SEvMgr service context
+    if (_sevmgrServiceContext == NULL) {
+      throw stdair::NonInitialisedServiceException ("The SEvMgr service "
+                                                    "has not been initialised");
+    }
+    assert (_sevmgrServiceContext != NULL);
+    SEVMGR_ServiceContext& lSEVMGR_ServiceContext =
+      *_sevmgrServiceContext;
+    
+    // Retrieve the event queue object instance
+    const EventQueue& lQueue = lSEVMGR_ServiceContext.getEventQueue();
+
+    // Delegate the call to the dedicated function
+    return EventQueueManager::getMonitoredStatus (lQueue, iEventType);
+  }
 
 }
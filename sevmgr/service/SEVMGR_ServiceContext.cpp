@@ -7,8 +7,8 @@
 // StdAir
 #include <stdair/STDAIR_Service.hpp>
 #include <stdair/basic/BasConst_General.hpp>
-#include <stdair/factory/FacBom.hpp>
 // SEvMgr
+#include <sevmgr/SEVMGR_Exceptions.hpp>
 #include <sevmgr/basic/BasConst_EventQueueManager.hpp>
 #include <sevmgr/bom/EventQueue.hpp>
 #include <sevmgr/service/SEVMGR_ServiceContext.hpp>
@@ -16,15 +16,17 @@
 namespace SEVMGR {
 
   // //////////////////////////////////////////////////////////////////////
-  SEVMGR_ServiceContext::SEVMGR_ServiceContext() 
+  SEVMGR_ServiceContext::
+  SEVMGR_ServiceContext (const EventQueueBackendType::EN_EventQueueBackendType& iBackendType)
     : _eventQueue (NULL) {
-    init();
+    init (iBackendType);
   }
 
   // //////////////////////////////////////////////////////////////////////
   SEVMGR_ServiceContext::
   SEVMGR_ServiceContext (const SEVMGR_ServiceContext& iServiceContext)
-    : _eventQueue (iServiceContext._eventQueue) {
+    : _eventQueue (NULL) {
+    assert (false);
   }
 
   // //////////////////////////////////////////////////////////////////////
@@ -32,22 +34,50 @@ namespace SEVMGR {
   } 
 
   // //////////////////////////////////////////////////////////////////////
-  void SEVMGR_ServiceContext::init() {
+  void SEVMGR_ServiceContext::
+  init (const EventQueueBackendType::EN_EventQueueBackendType& iBackendType) {
     //
-    initEventQueue();
+    initEventQueue (iBackendType);
   }  
 
   // //////////////////////////////////////////////////////////////////////
-  void SEVMGR_ServiceContext::initEventQueue() {
+  void SEVMGR_ServiceContext::
+  initEventQueue (const EventQueueBackendType::EN_EventQueueBackendType& iBackendType) {
     
-    // The event queue key is just a string. For now, it is not used.
-    const EventQueueKey lKey ("EQ01");
+    // Create the default event queue, and select it
+    const EventQueueKey lKey (DEFAULT_EVENT_QUEUE_ID);
+    EventQueue& lEventQueue = addEventQueue (lKey, iBackendType);
+    _eventQueue = &lEventQueue;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  EventQueue& SEVMGR_ServiceContext::
+  addEventQueue (const EventQueueKey& iKey,
+                 const EventQueueBackendType::EN_EventQueueBackendType& iBackendType) {
 
-    // Create an EventQueue object instance
-    EventQueue& lEventQueue = stdair::FacBom<EventQueue>::instance().create (lKey);
+    const stdair::MapKey_T lMapKey = iKey.toString();
+    if (_eventQueueMap.find (lMapKey) != _eventQueueMap.end()) {
+      std::ostringstream oStr;
+      oStr << "There is already an event queue for the '" << lMapKey
+           << "' key";
+      throw EventQueueException (oStr.str());
+    }
+
+    // Create an EventQueue object instance, owned by the service context
+    EventQueue& lEventQueue = _eventQueueFactory.create (iKey);
+
+    // Set the storage backend (the queue is still empty)
+    if (iBackendType != lEventQueue.getBackendType()) {
+      lEventQueue.setBackendType (iBackendType);
+    }
 
     // Store the event queue object
-    _eventQueue = &lEventQueue;
+    const bool hasInsertionBeenSuccessful =
+      _eventQueueMap.insert (EventQueueMap_T::value_type (lMapKey,
+                                                          &lEventQueue)).second;
+    assert (hasInsertionBeenSuccessful == true);
+
+    return lEventQueue;
   }
 
   // //////////////////////////////////////////////////////////////////////
@@ -56,8 +86,10 @@ namespace SEVMGR {
     oStr << "SEVMGR_ServiceContext -- Owns StdAir service: "
          << _ownStdairService;
     if (_eventQueue != NULL) {
-      oStr << " -- Queue: " << _eventQueue->toString();
+      oStr << " -- Queue: " << _eventQueue->describeKey() << " "
+           << _eventQueue->toString();
     }
+    oStr << " -- Nb of queues: " << _eventQueueMap.size();
     return oStr.str();
   }
 
@@ -90,4 +122,34 @@ namespace SEVMGR {
     return *_eventQueue;
   }
 
+  // //////////////////////////////////////////////////////////////////////
+  EventQueue& SEVMGR_ServiceContext::
+  getEventQueue (const EventQueueKey& iKey) const {
+    const stdair::MapKey_T lMapKey = iKey.toString();
+    EventQueueMap_T::const_iterator itEventQueue = _eventQueueMap.find (lMapKey);
+    if (itEventQueue == _eventQueueMap.end()) {
+      std::ostringstream oStr;
+      oStr << "There is no event queue for the '" << lMapKey << "' key";
+      throw EventQueueException (oStr.str());
+    }
+
+    EventQueue* lEventQueue_ptr = itEventQueue->second;
+    assert (lEventQueue_ptr != NULL);
+    return *lEventQueue_ptr;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  bool SEVMGR_ServiceContext::hasEventQueue (const EventQueueKey& iKey) const {
+    const stdair::MapKey_T lMapKey = iKey.toString();
+    const bool hasEventQueue =
+      (_eventQueueMap.find (lMapKey) != _eventQueueMap.end());
+    return hasEventQueue;
+  }
+
+  // //////////////////////////////////////////////////////////////////////
+  void SEVMGR_ServiceContext::setEventQueue (const EventQueueKey& iKey) {
+    EventQueue& lEventQueue = getEventQueue (iKey);
+    _eventQueue = &lEventQueue;
+  }
+
 }
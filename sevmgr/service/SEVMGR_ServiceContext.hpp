@@ -12,6 +12,8 @@
 #include <stdair/service/ServiceAbstract.hpp>
 // SEvMgr
 #include <sevmgr/SEVMGR_Types.hpp>
+#include <sevmgr/bom/EventQueueTypes.hpp>
+#include <sevmgr/factory/FacEventQueue.hpp>
 
 /// Forward declarations
 namespace stdair {
@@ -23,6 +25,7 @@ namespace SEVMGR {
 
   /// Forward declarations
   class EventQueue;
+  struct EventQueueKey;
 
   /**
    * @brief Class holding the context of the Sevmgr services.
@@ -61,10 +64,31 @@ namespace SEVMGR {
     }   
 
     /**
-     * Get the pointer on the EventQueue instance.
+     * Get the selected EventQueue instance, i.e., the one the service
+     * methods work on.
      */
     EventQueue& getEventQueue() const;
 
+    /**
+     * Get the EventQueue instance corresponding to the given key.
+     *
+     * \note An EventQueueException exception is thrown when there is
+     *       no such event queue.
+     */
+    EventQueue& getEventQueue (const EventQueueKey&) const;
+
+    /**
+     * State whether there is an EventQueue instance for the given key.
+     */
+    bool hasEventQueue (const EventQueueKey&) const;
+
+    /**
+     * Get the map of all the EventQueue instances.
+     */
+    const EventQueueMap_T& getEventQueueMap() const {
+      return _eventQueueMap;
+    }
+
 
   private:
     // ///////// Setters //////////
@@ -77,6 +101,15 @@ namespace SEVMGR {
       _ownStdairService = iOwnStdairService;
     }
 
+    /**
+     * Select the EventQueue instance corresponding to the given key, so
+     * that the service methods work on it.
+     *
+     * \note An EventQueueException exception is thrown when there is
+     *       no such event queue.
+     */
+    void setEventQueue (const EventQueueKey&);
+
     
   private:
     // ///////// Display Methods //////////
@@ -100,8 +133,11 @@ namespace SEVMGR {
     /// //////////////// Constructors and destructors /////////////
     /**
      * Main constructor.
+     *
+     * @param const EventQueueBackendType::EN_EventQueueBackendType&
+     *        Type of the storage backend of the event queue.
      */
-    SEVMGR_ServiceContext();
+    SEVMGR_ServiceContext (const EventQueueBackendType::EN_EventQueueBackendType&);
     /**
      * Copy constructor (not to be used).
      */
@@ -123,16 +159,38 @@ namespace SEVMGR {
      * That method is invoked from the constructors. It triggers, in
      * turn, the initialisation of the BOM tree root and of the event
      * queue.
+     *
+     * @param const EventQueueBackendType::EN_EventQueueBackendType&
+     *        Type of the storage backend of the event queue.
      */
-    void init();
+    void init (const EventQueueBackendType::EN_EventQueueBackendType&);
    
     /**
      * Initialisation.
      *
-     * The EventQueue object is created by that method, and then
-     * stored within the service context.
+     * The EventQueue object is created by that method, on top of the
+     * given storage backend, and then stored within the service context.
+     *
+     * @param const EventQueueBackendType::EN_EventQueueBackendType&
+     *        Type of the storage backend of the event queue.
+     */
+    void initEventQueue (const EventQueueBackendType::EN_EventQueueBackendType&);
+
+    /**
+     * Create an EventQueue object, for the given key, on top of the
+     * given storage backend, and store it within the service context.
+     * The selected event queue is left unchanged.
+     *
+     * \note An EventQueueException exception is thrown when there is
+     *       already an event queue for that key.
+     *
+     * @param const EventQueueKey& Key of the event queue.
+     * @param const EventQueueBackendType::EN_EventQueueBackendType&
+     *        Type of the storage backend of the event queue.
+     * @return EventQueue& The newly created event queue.
      */
-    void initEventQueue();
+    EventQueue& addEventQueue (const EventQueueKey&,
+                               const EventQueueBackendType::EN_EventQueueBackendType&);
 
     
   private:
@@ -151,7 +209,20 @@ namespace SEVMGR {
   private:
     // ////////////// Attributes ////////////////
     /**
-     * @brief EventQueue.
+     * @brief Factory of the event queues, which owns them. It is
+     * specific to that service context, so that several services may
+     * live in parallel (e.g., one per thread), without sharing any state.
+     */
+    FacEventQueue _eventQueueFactory;
+
+    /**
+     * @brief Event queues, indexed by the (string version of their) key.
+     */
+    EventQueueMap_T _eventQueueMap;
+
+    /**
+     * @brief Selected EventQueue, i.e., the one the service methods
+     * work on.
      */
     EventQueue* _eventQueue;
   };
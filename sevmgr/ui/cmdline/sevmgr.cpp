@@ -58,6 +58,7 @@ struct Command_T {
     DISPLAY,
     SELECT,
     NEXT,
+    PEEK,
     RUN,
     JSON_LIST,
     JSON_DISPLAY,
@@ -162,6 +163,7 @@ void initReadline (swift::SReadline& ioInputReader) {
   Completers.push_back ("select %date %time");
   Completers.push_back ("display");
   Completers.push_back ("next");
+  Completers.push_back ("peek %hours");
   Completers.push_back ("run");
   Completers.push_back ("json_list");
   Completers.push_back ("json_display");
@@ -405,6 +407,9 @@ Command_T::Type_T extractCommand (TokenList_T& ioTokenList) {
     } else if (lCommand == "next") {
       oCommandType = Command_T::NEXT;
 
+    } else if (lCommand == "peek") {
+      oCommandType = Command_T::PEEK;
+
     } else if (lCommand == "run") {
       oCommandType = Command_T::RUN;
 
@@ -613,6 +618,12 @@ int main (int argc, char* argv[]) {
       std::cout << " next" << "\t\t"
                 << "Play the current event and pop the next one from the queue"
                 << std::endl;
+      std::cout << " peek" << "\t\t"
+                << "Display the next event, without popping it. It is "
+                << "possible to display all the events coming within a "
+                << "given number of hours from it" << std::endl
+                << "\t\t  'peek 24' "
+                << "display the events of the next 24 hours" << std::endl;
       std::cout << " run" << "\t\t"
                 << "Play all the events until the next break-point, if any"
                 << std::endl;
@@ -752,6 +763,61 @@ int main (int argc, char* argv[]) {
       break;
     }     
 
+      // ////////////////////////////// Peek ////////////////////////
+    case Command_T::PEEK: {
+      //
+      std::cout << "Peek" << std::endl;
+
+      std::ostringstream oEventListStr;
+      const stdair::EventStruct* lNextEventStruct_ptr =
+        sevmgrService.peekNextEvent();
+      if (lNextEventStruct_ptr == NULL) {
+        oEventListStr << "The event queue is empty: there is no next event.";
+
+      } else if (lTokenListByReadline.empty() == true) {
+
+        // If no parameter is given, display the next event only
+        oEventListStr << "Next event: '" << lNextEventStruct_ptr->describe()
+                      << "'.";
+
+      } else {
+
+        // Otherwise, the parameter gives the number of hours, from the
+        // next event, up to which the events are displayed
+        try {
+
+          const long lNbOfHours =
+            boost::lexical_cast<long> (lTokenListByReadline[0]);
+          const stdair::DateTime_T lHorizonDateTime =
+            sevmgrService.getNextEventDateTime()
+            + boost::posix_time::hours (lNbOfHours);
+          SEVMGR::EventBrowserPtr_T lEventBrowserPtr =
+            sevmgrService.browseEvents (lHorizonDateTime);
+          assert (lEventBrowserPtr != NULL);
+
+          unsigned int lNbOfEvents = 0;
+          for (const stdair::EventStruct* lEventStruct_ptr =
+                 lEventBrowserPtr->next(); lEventStruct_ptr != NULL;
+               lEventStruct_ptr = lEventBrowserPtr->next()) {
+            oEventListStr << ++lNbOfEvents << ". "
+                          << lEventStruct_ptr->describe();
+          }
+          oEventListStr << lNbOfEvents << " event(s) up to "
+                        << lHorizonDateTime << ".";
+
+        } catch (boost::bad_lexical_cast& eCast) {
+          oEventListStr << "The number of hours '" << lTokenListByReadline[0]
+                        << "' is not understood: try 'help' for "
+                        << "more information on the 'peek' command.";
+        }
+      }
+      std::cout << oEventListStr.str() << std::endl;
+      STDAIR_LOG_DEBUG (oEventListStr.str());
+
+      //
+      break;
+    }
+
       // ////////////////////////////// Run ////////////////////////
     case Command_T::RUN: {
       //
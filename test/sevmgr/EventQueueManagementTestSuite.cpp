@@ -9,16 +9,23 @@
 #include <sstream>
 #include <fstream>
 #include <map>
+#include <vector>
 #include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <thread>
 // Boost Unit Test Framework (UTF)
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MAIN
 #define BOOST_TEST_MODULE EventQueueManagementTest
 #include <boost/test/unit_test.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/weak_ptr.hpp>
 // StdAir
 #include <stdair/stdair_basic_types.hpp>
 #include <stdair/stdair_date_time_types.hpp>
+#include <stdair/STDAIR_Service.hpp>
 #include <stdair/basic/BasLogParams.hpp>
 #include <stdair/basic/BasDBParams.hpp>
 #include <stdair/basic/BasFileMgr.hpp>
@@ -26,9 +33,18 @@
 #include <stdair/bom/EventStruct.hpp>
 #include <stdair/bom/BookingRequestStruct.hpp>
 #include <stdair/bom/BookingRequestTypes.hpp>
+#include <stdair/bom/BreakPointStruct.hpp>
 #include <stdair/service/Logger.hpp>
 // SEvMgr
+#include <sevmgr/SEVMGR_Exceptions.hpp>
 #include <sevmgr/SEVMGR_Service.hpp>
+#include <sevmgr/bom/EventQueue.hpp>
+#include <sevmgr/bom/MapEventQueueBackend.hpp>
+#include <sevmgr/bom/CompactHeapEventQueueBackend.hpp>
+#include <sevmgr/bom/EventPayloadStore.hpp>
+#if defined(__cpp_impl_coroutine)
+#include <sevmgr/SEVMGR_Coroutine.hpp>
+#endif
 #include <sevmgr/config/sevmgr-paths.hpp>
 
 namespace boost_utf = boost::unit_test;
@@ -231,6 +247,3000 @@ BOOST_AUTO_TEST_CASE (sevmgr_simple_simulation_test) {
   logOutputFile.close();
 }
 
+/**
+ * Test that the d-ary heap backend pops the events in the same
+ * (chronological) order as the reference map backend
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_dary_heap_backend_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Pop all the events of the sample queue with the reference backend
+  BOOST_CHECK (sevmgrService.getQueueBackendType()
+               == SEVMGR::EventQueueBackendType::MAP);
+  sevmgrService.buildSampleQueue ();
+  std::vector<stdair::DateTime_T> lMapDateTimeList;
+  while (sevmgrService.isQueueDone() == false) {
+    stdair::EventStruct lEventStruct;
+    sevmgrService.popEvent (lEventStruct);
+    lMapDateTimeList.push_back (lEventStruct.getEventTime());
+  }
+
+  // Switch to the d-ary heap backend, and replay the same sample queue
+  sevmgrService.reset();
+  sevmgrService.setQueueBackendType (SEVMGR::EventQueueBackendType::DARY_HEAP);
+  BOOST_CHECK (sevmgrService.getQueueBackendType()
+               == SEVMGR::EventQueueBackendType::DARY_HEAP);
+  sevmgrService.buildSampleQueue ();
+  BOOST_REQUIRE_MESSAGE (sevmgrService.getQueueSize()
+                         == static_cast<stdair::Count_T> (lMapDateTimeList.size()),
+                         "The d-ary heap backend should hold "
+                         << lMapDateTimeList.size() << " events, but holds "
+                         << sevmgrService.getQueueSize());
+
+  std::vector<stdair::DateTime_T> lHeapDateTimeList;
+  while (sevmgrService.isQueueDone() == false) {
+    stdair::EventStruct lEventStruct;
+    sevmgrService.popEvent (lEventStruct);
+    lHeapDateTimeList.push_back (lEventStruct.getEventTime());
+  }
+
+  /** Are the events popped in the same order? */
+  BOOST_CHECK (lHeapDateTimeList == lMapDateTimeList);
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test the calendar queue backend, chosen when the service is created,
+ * on enough events for the calendar to resize itself several times
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_calendar_backend_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object, on top of a calendar queue
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams,
+                                        SEVMGR::EventQueueBackendType::CALENDAR);
+  BOOST_CHECK (sevmgrService.getQueueBackendType()
+               == SEVMGR::EventQueueBackendType::CALENDAR);
+
+  // Add break points, spread (pseudo-randomly) over one year
+  const stdair::Count_T lNbOfEvents (5000);
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  unsigned long lSeed = 12345;
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (0, 0, lSeed % (365 * 24 * 3600));
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    stdair::EventStruct lEventStruct (stdair::EventType::BRK_PT,
+                                      lBreakPoint_ptr);
+    sevmgrService.addEvent (lEventStruct);
+  }
+  BOOST_REQUIRE (sevmgrService.getQueueSize() == lNbOfEvents);
+
+  // Pop all the events, which must come in chronological order
+  stdair::Count_T lNbOfPoppedEvents (0);
+  bool areEventsSorted = true;
+  stdair::DateTime_T lPreviousDateTime (lStartDateTime);
+  while (sevmgrService.isQueueDone() == false) {
+    stdair::EventStruct lEventStruct;
+    sevmgrService.popEvent (lEventStruct);
+    const stdair::DateTime_T lDateTime = lEventStruct.getEventTime();
+    if (lDateTime < lPreviousDateTime) {
+      areEventsSorted = false;
+    }
+    lPreviousDateTime = lDateTime;
+    ++lNbOfPoppedEvents;
+  }
+
+  /** Are all the events popped, in chronological order? */
+  BOOST_CHECK_EQUAL (lNbOfPoppedEvents, lNbOfEvents);
+  BOOST_CHECK (areEventsSorted);
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test that events sharing the same date-time are popped in insertion
+ * order, with their date-time left untouched, whatever the backend
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_same_date_time_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::DEBUG, logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  const stdair::DateTime_T lDateTime (stdair::Date_T (2011, 5, 14),
+                                      stdair::Duration_T (8, 0, 0));
+  const stdair::Count_T lNbOfEvents (100);
+
+  for (unsigned short idx = 0;
+       idx != SEVMGR::EventQueueBackendType::LAST_VALUE; ++idx) {
+    const SEVMGR::EventQueueBackendType::EN_EventQueueBackendType lBackend =
+      static_cast<SEVMGR::EventQueueBackendType::EN_EventQueueBackendType> (idx);
+    sevmgrService.reset();
+    sevmgrService.setQueueBackendType (lBackend);
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+
+    // Add break points, all at the same date-time
+    std::vector<stdair::BreakPointPtr_T> lBreakPointList;
+    for (stdair::Count_T lEventIdx = 0; lEventIdx != lNbOfEvents;
+         ++lEventIdx) {
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+      stdair::EventStruct lEventStruct (stdair::EventType::BRK_PT,
+                                        lBreakPoint_ptr);
+      sevmgrService.addEvent (lEventStruct);
+      lBreakPointList.push_back (lBreakPoint_ptr);
+    }
+    BOOST_REQUIRE (sevmgrService.getQueueSize() == lNbOfEvents);
+
+    // Pop them all
+    bool isOrderKept = true;
+    bool isDateTimeKept = true;
+    for (std::vector<stdair::BreakPointPtr_T>::const_iterator itBreakPoint =
+           lBreakPointList.begin(); itBreakPoint != lBreakPointList.end();
+         ++itBreakPoint) {
+      stdair::EventStruct lEventStruct;
+      sevmgrService.popEvent (lEventStruct);
+      if (&lEventStruct.getBreakPoint() != itBreakPoint->get()) {
+        isOrderKept = false;
+      }
+      if (lEventStruct.getEventTime() != lDateTime) {
+        isDateTimeKept = false;
+      }
+    }
+
+    /** Are the events popped in insertion order, at their date-time? */
+    BOOST_CHECK_MESSAGE (isOrderKept,
+                         "The events having the same date-time are not "
+                         "popped in insertion order with the "
+                         << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                         << " backend");
+    BOOST_CHECK_MESSAGE (isDateTimeKept,
+                         "The date-time of the events has been altered by "
+                         "the "
+                         << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                         << " backend");
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test the sharded backend, with events of several types: the events
+ * of each type are counted on their own, and all the events are popped
+ * in chronological order
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_sharded_backend_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+  sevmgrService.setQueueBackendType (SEVMGR::EventQueueBackendType::SHARDED);
+
+  // The sample queue holds two booking requests and two break points,
+  // to which a few break points are added
+  sevmgrService.buildSampleQueue();
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 5, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfBreakPoints (50);
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfBreakPoints);
+  for (stdair::Count_T idx = 0; idx != lNbOfBreakPoints; ++idx) {
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct>
+      (lStartDateTime + stdair::Duration_T (24 * (idx % 40), 0, 0));
+    sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+  }
+  BOOST_CHECK_EQUAL (sevmgrService.getQueueSize (stdair::EventType::BKG_REQ),
+                     2);
+  BOOST_CHECK_EQUAL (sevmgrService.getQueueSize (stdair::EventType::BRK_PT),
+                     lNbOfBreakPoints + 2);
+  BOOST_CHECK_EQUAL (sevmgrService.getQueueSize (stdair::EventType::RM), 0);
+
+  // Pop all the events, merged across the types
+  bool areEventsSorted = true;
+  stdair::Count_T lNbOfBookingRequests = 0;
+  stdair::DateTime_T lPreviousDateTime (stdair::Date_T (2000, 1, 1),
+                                        stdair::Duration_T (0, 0, 0));
+  while (sevmgrService.isQueueDone() == false) {
+    stdair::EventStruct lEventStruct;
+    sevmgrService.popEvent (lEventStruct);
+    if (lEventStruct.getEventTime() < lPreviousDateTime) {
+      areEventsSorted = false;
+    }
+    lPreviousDateTime = lEventStruct.getEventTime();
+    if (lEventStruct.getEventType() == stdair::EventType::BKG_REQ) {
+      ++lNbOfBookingRequests;
+    }
+  }
+  BOOST_CHECK (areEventsSorted == true);
+  BOOST_CHECK_EQUAL (lNbOfBookingRequests, 2);
+  BOOST_CHECK_EQUAL (sevmgrService.getQueueSize (stdair::EventType::BKG_REQ),
+                     0);
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Compare two break point events by date-time only, so that a stable
+ * sort keeps the insertion order of the events at the same date-time.
+ */
+struct EventDateTimeLess {
+  bool operator() (const stdair::EventStruct& iLHS,
+                   const stdair::EventStruct& iRHS) const {
+    return (iLHS.getEventTimeStamp() < iRHS.getEventTimeStamp());
+  }
+};
+
+/**
+ * Test the bulk insertion of events (addEvents()), mixed with single
+ * insertions, whatever the backend
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_bulk_insertion_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Build the events: a few single ones, a large batch and a small
+  // batch. Many of them share the same date-time (one-hour grid).
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const unsigned int lBatchSizes[3] = { 10, 2000, 50 };
+  std::vector<SEVMGR::EventStructList_T> lEventListList (3);
+  unsigned long lSeed = 54321;
+  for (unsigned short lListIdx = 0; lListIdx != 3; ++lListIdx) {
+    for (unsigned int idx = 0; idx != lBatchSizes[lListIdx]; ++idx) {
+      lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+      const stdair::DateTime_T lDateTime =
+        lStartDateTime + stdair::Duration_T (lSeed % (24 * 90), 0, 0);
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+      lEventListList[lListIdx].
+        push_back (stdair::EventStruct (stdair::EventType::BRK_PT,
+                                        lBreakPoint_ptr));
+    }
+  }
+
+  // Expected order: by date-time, then by insertion order
+  SEVMGR::EventStructList_T lExpectedEventList;
+  for (unsigned short lListIdx = 0; lListIdx != 3; ++lListIdx) {
+    lExpectedEventList.insert (lExpectedEventList.end(),
+                               lEventListList[lListIdx].begin(),
+                               lEventListList[lListIdx].end());
+  }
+  std::stable_sort (lExpectedEventList.begin(), lExpectedEventList.end(),
+                    EventDateTimeLess());
+  const stdair::Count_T lNbOfEvents = lExpectedEventList.size();
+
+  for (unsigned short idx = 0;
+       idx != SEVMGR::EventQueueBackendType::LAST_VALUE; ++idx) {
+    const SEVMGR::EventQueueBackendType::EN_EventQueueBackendType lBackend =
+      static_cast<SEVMGR::EventQueueBackendType::EN_EventQueueBackendType> (idx);
+    sevmgrService.reset();
+    sevmgrService.setQueueBackendType (lBackend);
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+
+    // Single insertions, then the two batches
+    const SEVMGR::EventStructList_T& lSingleEventList = lEventListList[0];
+    for (SEVMGR::EventStructList_T::const_iterator itEvent =
+           lSingleEventList.begin(); itEvent != lSingleEventList.end();
+         ++itEvent) {
+      sevmgrService.addEvent (*itEvent);
+    }
+    sevmgrService.addEvents (lEventListList[1]);
+    sevmgrService.addEvents (lEventListList[2]);
+    BOOST_REQUIRE (sevmgrService.getQueueSize() == lNbOfEvents);
+
+    // Pop all the events
+    bool isOrderKept = true;
+    for (SEVMGR::EventStructList_T::const_iterator itEvent =
+           lExpectedEventList.begin(); itEvent != lExpectedEventList.end();
+         ++itEvent) {
+      stdair::EventStruct lEventStruct;
+      sevmgrService.popEvent (lEventStruct);
+      if (&lEventStruct.getBreakPoint() != &itEvent->getBreakPoint()) {
+        isOrderKept = false;
+      }
+    }
+
+    /** Are the events popped by date-time, then in insertion order? */
+    BOOST_CHECK_MESSAGE (isOrderKept,
+                         "The events added in bulk are not popped in the "
+                         "expected order with the "
+                         << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                         << " backend");
+    BOOST_CHECK (sevmgrService.isQueueDone());
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test the batch extraction of events (popEvents() and popEventsUntil()),
+ * whatever the backend
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_batch_pop_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Build break points, spread (pseudo-randomly) over 30 days, on a
+  // one-hour grid
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfEvents (1000);
+  SEVMGR::EventStructList_T lEventList;
+  unsigned long lSeed = 24680;
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (lSeed % (24 * 30), 0, 0);
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    lEventList.push_back (stdair::EventStruct (stdair::EventType::BRK_PT,
+                                               lBreakPoint_ptr));
+  }
+  SEVMGR::EventStructList_T lExpectedEventList (lEventList);
+  std::stable_sort (lExpectedEventList.begin(), lExpectedEventList.end(),
+                    EventDateTimeLess());
+
+  const stdair::DateTime_T lUntilDateTime =
+    lStartDateTime + stdair::Duration_T (24 * 10, 0, 0);
+  const stdair::Count_T lMaxNbOfEvents (100);
+
+  for (unsigned short idx = 0;
+       idx != SEVMGR::EventQueueBackendType::LAST_VALUE; ++idx) {
+    const SEVMGR::EventQueueBackendType::EN_EventQueueBackendType lBackend =
+      static_cast<SEVMGR::EventQueueBackendType::EN_EventQueueBackendType> (idx);
+    sevmgrService.reset();
+    sevmgrService.setQueueBackendType (lBackend);
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+    sevmgrService.addEvents (lEventList);
+
+    // Pop the events of the first ten days
+    SEVMGR::EventStructList_T lPoppedEventList;
+    sevmgrService.popEventsUntil (lPoppedEventList, lUntilDateTime);
+    bool isUntilKept = true;
+    for (SEVMGR::EventStructList_T::const_iterator itEvent =
+           lPoppedEventList.begin(); itEvent != lPoppedEventList.end();
+         ++itEvent) {
+      if (itEvent->getEventTime() > lUntilDateTime) {
+        isUntilKept = false;
+      }
+    }
+    const stdair::Count_T lNbOfEventsUntil = lPoppedEventList.size();
+
+    // Pop a fixed number of events
+    const stdair::ProgressStatusSet lProgressStatusSet =
+      sevmgrService.popEvents (lPoppedEventList, lMaxNbOfEvents);
+    BOOST_CHECK_EQUAL (lPoppedEventList.size(),
+                       lNbOfEventsUntil + lMaxNbOfEvents);
+    BOOST_CHECK_EQUAL (lProgressStatusSet.getTypeSpecificStatus().getCurrentNb(),
+                       lNbOfEventsUntil + lMaxNbOfEvents);
+
+    // Pop the remaining events, then try and pop from the empty queue
+    sevmgrService.popEvents (lPoppedEventList, lNbOfEvents);
+    sevmgrService.popEvents (lPoppedEventList, lNbOfEvents);
+    BOOST_CHECK (sevmgrService.isQueueDone());
+
+    /** Are all the events popped, in the same order as one by one? */
+    bool isOrderKept = (lPoppedEventList.size() == lExpectedEventList.size());
+    for (SEVMGR::EventStructList_T::size_type lEventIdx = 0;
+         isOrderKept && lEventIdx != lPoppedEventList.size(); ++lEventIdx) {
+      if (&lPoppedEventList[lEventIdx].getBreakPoint()
+          != &lExpectedEventList[lEventIdx].getBreakPoint()) {
+        isOrderKept = false;
+      }
+    }
+    BOOST_CHECK_MESSAGE (isOrderKept && isUntilKept,
+                         "The events popped by batch are not the expected "
+                         "ones with the "
+                         << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                         << " backend");
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Insert break points, spread (pseudo-randomly) over 30 days on a
+ * one-hour grid, hence with many ties, into the given backend.
+ */
+void fillBackend (SEVMGR::EventQueueBackend& ioBackend,
+                  const stdair::Count_T& iNbOfEvents,
+                  const SEVMGR::EventSequence_T& iFirstSequence) {
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  unsigned long lSeed = 13579 + iFirstSequence;
+  for (stdair::Count_T idx = 0; idx != iNbOfEvents; ++idx) {
+    lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (lSeed % (24 * 30), 0, 0);
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    const stdair::EventStruct lEventStruct (stdair::EventType::BRK_PT,
+                                            lBreakPoint_ptr);
+    ioBackend.insert (lEventStruct, iFirstSequence + idx);
+  }
+}
+
+/**
+ * Pop all the events of the given backend, and state whether they come
+ * in (date-time stamp, insertion sequence) order.
+ */
+bool drainBackend (SEVMGR::EventQueueBackend& ioBackend) {
+  bool areEventsSorted = true;
+  stdair::LongDuration_T lPreviousTimeStamp = 0;
+  SEVMGR::EventSequence_T lPreviousSequence = 0;
+  bool isFirstEvent = true;
+  while (ioBackend.empty() == false) {
+    const SEVMGR::EventSequence_T lSequence = ioBackend.getTopSequence();
+    stdair::EventStruct lEventStruct;
+    ioBackend.pop (lEventStruct);
+    const stdair::LongDuration_T lTimeStamp = lEventStruct.getEventTimeStamp();
+    if (isFirstEvent == false
+        && (lTimeStamp < lPreviousTimeStamp
+            || (lTimeStamp == lPreviousTimeStamp
+                && lSequence <= lPreviousSequence))) {
+      areEventsSorted = false;
+    }
+    isFirstEvent = false;
+    lPreviousTimeStamp = lTimeStamp;
+    lPreviousSequence = lSequence;
+  }
+  return areEventsSorted;
+}
+
+/**
+ * Test the pooled map backend: once the node pool has reached its
+ * working size, the slabs are reused, whether the backend is drained or
+ * cleared, and the events still come in (date-time, insertion) order
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_pooled_map_backend_test) {
+
+  SEVMGR::MapEventQueueBackend lBackend (true);
+  BOOST_CHECK (lBackend.getType() == SEVMGR::EventQueueBackendType::POOLED_MAP);
+  BOOST_CHECK_EQUAL (lBackend.getNbOfSlabs(), static_cast<std::size_t> (0));
+
+  // Fill the backend over a few slabs, and drain it
+  const stdair::Count_T lNbOfEvents (3000);
+  fillBackend (lBackend, lNbOfEvents, 0);
+  BOOST_CHECK_EQUAL (lBackend.size(), lNbOfEvents);
+  const std::size_t lNbOfSlabs = lBackend.getNbOfSlabs();
+  BOOST_CHECK (lNbOfSlabs >= 3);
+  BOOST_CHECK (drainBackend (lBackend) == true);
+  BOOST_CHECK_EQUAL (lBackend.getNbOfSlabs(), lNbOfSlabs);
+
+  // Refill it: the released nodes are recycled
+  fillBackend (lBackend, lNbOfEvents, lNbOfEvents);
+  BOOST_CHECK_EQUAL (lBackend.getNbOfSlabs(), lNbOfSlabs);
+  BOOST_CHECK (drainBackend (lBackend) == true);
+
+  // Refill it after a reset (clear): the slabs are rewound
+  fillBackend (lBackend, lNbOfEvents, 2 * lNbOfEvents);
+  lBackend.clear();
+  BOOST_CHECK (lBackend.empty() == true);
+  fillBackend (lBackend, lNbOfEvents, 3 * lNbOfEvents);
+  BOOST_CHECK_EQUAL (lBackend.size(), lNbOfEvents);
+  BOOST_CHECK_EQUAL (lBackend.getNbOfSlabs(), lNbOfSlabs);
+  BOOST_CHECK (drainBackend (lBackend) == true);
+  BOOST_CHECK_EQUAL (lBackend.getNbOfSlabs(), lNbOfSlabs);
+}
+
+/**
+ * Test the compact heap backend, along with its per event type payload
+ * arenas: the indexes of the released payloads are recycled, the
+ * payloads are released as soon as their events are popped, and the
+ * events of several types come in (date-time, insertion) order
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_compact_heap_backend_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object, for the sample booking requests
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+  const stdair::BookingRequestStruct lBookingRequest =
+    sevmgrService.buildSampleBookingRequest();
+  const stdair::DateTime_T lStartDateTime =
+    lBookingRequest.getRequestDateTime();
+
+  // Store, and release, payloads of two types in turn: the arena of
+  // each type never holds more than two payloads, at indexes 0 and 1
+  SEVMGR::EventPayloadStore lPayloadStore;
+  bool areIndexesRecycled = true;
+  bool arePayloadsReleased = true;
+  for (unsigned short lRoundIdx = 0; lRoundIdx != 100; ++lRoundIdx) {
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct>
+      (lStartDateTime + stdair::Duration_T (lRoundIdx, 0, 0));
+    const stdair::BookingRequestPtr_T lBookingRequest_ptr =
+      boost::make_shared<stdair::BookingRequestStruct> (lBookingRequest);
+    const SEVMGR::EventPayloadIndex_T lBreakPointIndex =
+      lPayloadStore.store (stdair::EventStruct (stdair::EventType::BRK_PT,
+                                                lBreakPoint_ptr));
+    const SEVMGR::EventPayloadIndex_T lBookingRequestIndex =
+      lPayloadStore.store (stdair::EventStruct (stdair::EventType::BKG_REQ,
+                                                lBookingRequest_ptr));
+    const SEVMGR::EventPayloadIndex_T lOtherBreakPointIndex =
+      lPayloadStore.store (stdair::EventStruct (stdair::EventType::BRK_PT,
+                                                lBreakPoint_ptr));
+    if (lBreakPointIndex > 1 || lOtherBreakPointIndex > 1
+        || lBreakPointIndex == lOtherBreakPointIndex
+        || lBookingRequestIndex != 0
+        || lPayloadStore.size (stdair::EventType::BRK_PT) != 2
+        || lPayloadStore.size (stdair::EventType::BKG_REQ) != 1
+        || lPayloadStore.size (stdair::EventType::RM) != 0) {
+      areIndexesRecycled = false;
+    }
+
+    // The store holds a reference on each of its payloads, until they
+    // are extracted or released
+    if (lBreakPoint_ptr.use_count() != 3
+        || lBookingRequest_ptr.use_count() != 2) {
+      arePayloadsReleased = false;
+    }
+    stdair::EventStruct lEventStruct;
+    lPayloadStore.extract (stdair::EventType::BRK_PT, lBreakPointIndex,
+                           lEventStruct);
+    if (&lEventStruct.getBreakPoint() != lBreakPoint_ptr.get()) {
+      arePayloadsReleased = false;
+    }
+    lEventStruct = stdair::EventStruct();
+    lPayloadStore.release (stdair::EventType::BRK_PT, lOtherBreakPointIndex);
+    lPayloadStore.release (stdair::EventType::BKG_REQ, lBookingRequestIndex);
+    if (lBreakPoint_ptr.use_count() != 1
+        || lBookingRequest_ptr.use_count() != 1
+        || lPayloadStore.size (stdair::EventType::BRK_PT) != 0
+        || lPayloadStore.size (stdair::EventType::BKG_REQ) != 0) {
+      arePayloadsReleased = false;
+    }
+  }
+  BOOST_CHECK (areIndexesRecycled == true);
+  BOOST_CHECK (arePayloadsReleased == true);
+
+  // Interleave the insertions and the pops of events of two types: the
+  // payloads of the popped events are no longer referred to by the
+  // backend, and the events come in (date-time, insertion) order. The
+  // break points come before the booking requests, so that the former
+  // are popped while the latter pile up.
+  const stdair::DateTime_T lBreakPointDateTime =
+    lStartDateTime - stdair::Duration_T (300, 0, 0);
+  SEVMGR::CompactHeapEventQueueBackend lBackend;
+  BOOST_CHECK (lBackend.getType()
+               == SEVMGR::EventQueueBackendType::COMPACT_HEAP);
+  std::vector<boost::weak_ptr<stdair::BreakPointStruct> > lBreakPointList;
+  SEVMGR::EventSequence_T lSequence = 0;
+  bool areEventsSorted = true;
+  stdair::LongDuration_T lPreviousTimeStamp = 0;
+  SEVMGR::EventSequence_T lPreviousSequence = 0;
+  for (unsigned short lRoundIdx = 0; lRoundIdx != 200; ++lRoundIdx) {
+    // Three break points (the last two being tied), and a booking
+    // request, all of them after the previously popped events
+    for (unsigned short idx = 0; idx != 3; ++idx) {
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct>
+        (lBreakPointDateTime
+         + stdair::Duration_T (lRoundIdx + (idx == 0 ? 0 : 1), 0, 0));
+      lBreakPointList.push_back (lBreakPoint_ptr);
+      lBackend.insert (stdair::EventStruct (stdair::EventType::BRK_PT,
+                                            lBreakPoint_ptr), lSequence++);
+    }
+    const stdair::BookingRequestPtr_T lBookingRequest_ptr =
+      boost::make_shared<stdair::BookingRequestStruct> (lBookingRequest);
+    lBackend.insert (stdair::EventStruct (stdair::EventType::BKG_REQ,
+                                          lBookingRequest_ptr), lSequence++);
+
+    // Pop two events
+    for (unsigned short idx = 0; idx != 2; ++idx) {
+      const SEVMGR::EventSequence_T lTopSequence = lBackend.getTopSequence();
+      stdair::EventStruct lEventStruct;
+      lBackend.pop (lEventStruct);
+      const stdair::LongDuration_T lTimeStamp =
+        lEventStruct.getEventTimeStamp();
+      if (lTimeStamp < lPreviousTimeStamp
+          || (lTimeStamp == lPreviousTimeStamp
+              && lTopSequence <= lPreviousSequence)) {
+        areEventsSorted = false;
+      }
+      lPreviousTimeStamp = lTimeStamp;
+      lPreviousSequence = lTopSequence;
+    }
+  }
+  BOOST_CHECK (areEventsSorted == true);
+  BOOST_CHECK_EQUAL (lBackend.size(), 400);
+
+  // Only the break points still queued are alive
+  stdair::Count_T lNbOfAliveBreakPoints = 0;
+  for (std::vector<boost::weak_ptr<stdair::BreakPointStruct> >::const_iterator
+         itBreakPoint = lBreakPointList.begin();
+       itBreakPoint != lBreakPointList.end(); ++itBreakPoint) {
+    if (itBreakPoint->expired() == false) {
+      ++lNbOfAliveBreakPoints;
+    }
+  }
+  stdair::Count_T lNbOfQueuedBreakPoints = 0;
+  while (lBackend.empty() == false) {
+    stdair::EventStruct lEventStruct;
+    lBackend.pop (lEventStruct);
+    if (lEventStruct.getEventType() == stdair::EventType::BRK_PT) {
+      ++lNbOfQueuedBreakPoints;
+    }
+  }
+  BOOST_CHECK_EQUAL (lNbOfAliveBreakPoints, lNbOfQueuedBreakPoints);
+  BOOST_CHECK_EQUAL (lNbOfQueuedBreakPoints, 200);
+  for (std::vector<boost::weak_ptr<stdair::BreakPointStruct> >::const_iterator
+         itBreakPoint = lBreakPointList.begin();
+       itBreakPoint != lBreakPointList.end(); ++itBreakPoint) {
+    BOOST_CHECK (itBreakPoint->expired() == true);
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test the seek operations (skipEventsBefore(), popEventsBefore(),
+ * select() and seek()), whatever the backend
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_seek_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Build break points, spread (pseudo-randomly) over 30 days, on a
+  // one-hour grid
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfEvents (1000);
+  SEVMGR::EventStructList_T lEventList;
+  unsigned long lSeed = 13579;
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (lSeed % (24 * 30), 0, 0);
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    lEventList.push_back (stdair::EventStruct (stdair::EventType::BRK_PT,
+                                               lBreakPoint_ptr));
+  }
+  SEVMGR::EventStructList_T lExpectedEventList (lEventList);
+  std::stable_sort (lExpectedEventList.begin(), lExpectedEventList.end(),
+                    EventDateTimeLess());
+
+  // Rank of the first expected event at, or after, the given date-time
+  const stdair::DateTime_T lPopDateTime =
+    lStartDateTime + stdair::Duration_T (24 * 5, 0, 0);
+  const stdair::DateTime_T lSelectDateTime =
+    lStartDateTime + stdair::Duration_T (24 * 10, 0, 0);
+  const stdair::DateTime_T lSeekDateTime =
+    lStartDateTime + stdair::Duration_T (24 * 20, 30, 0);
+  stdair::Count_T lNbOfEventsBeforePop = 0;
+  stdair::Count_T lSelectIdx = 0;
+  stdair::Count_T lSeekIdx = 0;
+  for (stdair::Count_T idx = lNbOfEvents; idx != 0; --idx) {
+    const stdair::DateTime_T& lDateTime =
+      lExpectedEventList[idx - 1].getEventTime();
+    if (lDateTime >= lPopDateTime) {
+      lNbOfEventsBeforePop = idx - 1;
+    }
+    if (lDateTime >= lSelectDateTime) {
+      lSelectIdx = idx - 1;
+    }
+    if (lDateTime >= lSeekDateTime) {
+      lSeekIdx = idx - 1;
+    }
+  }
+  const stdair::DateTime_T lExactDateTime =
+    lExpectedEventList[lSelectIdx].getEventTime();
+
+  for (unsigned short idx = 0;
+       idx != SEVMGR::EventQueueBackendType::LAST_VALUE; ++idx) {
+    const SEVMGR::EventQueueBackendType::EN_EventQueueBackendType lBackend =
+      static_cast<SEVMGR::EventQueueBackendType::EN_EventQueueBackendType> (idx);
+    sevmgrService.reset();
+    sevmgrService.setQueueBackendType (lBackend);
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+    sevmgrService.addEvents (lEventList);
+
+    // Pop the events before the fifth day, in one go
+    SEVMGR::EventStructList_T lPoppedEventList;
+    const stdair::Count_T lNbOfPoppedEvents =
+      sevmgrService.popEventsBefore (lPoppedEventList, lPopDateTime);
+    BOOST_CHECK_EQUAL (lNbOfPoppedEvents, lNbOfEventsBeforePop);
+    BOOST_CHECK_EQUAL (lPoppedEventList.size(), lNbOfEventsBeforePop);
+    bool isOrderKept = (lPoppedEventList.size() == lNbOfEventsBeforePop);
+    for (SEVMGR::EventStructList_T::size_type lEventIdx = 0;
+         isOrderKept && lEventIdx != lPoppedEventList.size(); ++lEventIdx) {
+      if (&lPoppedEventList[lEventIdx].getBreakPoint()
+          != &lExpectedEventList[lEventIdx].getBreakPoint()) {
+        isOrderKept = false;
+      }
+    }
+    BOOST_CHECK (sevmgrService.getStatus().getCurrentNb()
+                 == lNbOfEventsBeforePop);
+
+    // Select the event having an exact date-time; there is no event at
+    // a half hour
+    stdair::EventStruct lEventStruct;
+    const bool hasBeenSelected =
+      sevmgrService.select (lEventStruct, lExactDateTime);
+    BOOST_CHECK (hasBeenSelected == true);
+    const bool isSelectedKept = (hasBeenSelected == true
+                                 && &lEventStruct.getBreakPoint()
+                                 == &lExpectedEventList[lSelectIdx].getBreakPoint());
+    BOOST_CHECK (sevmgrService.select (lEventStruct, lSeekDateTime) == false);
+    BOOST_CHECK (sevmgrService.getStatus().getCurrentNb() == lSelectIdx + 1);
+
+    // Seek the first event at, or after, a half hour
+    const bool hasBeenSought = sevmgrService.seek (lEventStruct, lSeekDateTime);
+    BOOST_CHECK (hasBeenSought == true);
+    const bool isSoughtKept = (hasBeenSought == true
+                               && &lEventStruct.getBreakPoint()
+                               == &lExpectedEventList[lSeekIdx].getBreakPoint());
+    BOOST_CHECK (sevmgrService.getStatus (stdair::EventType::BRK_PT).
+                 getCurrentNb() == lSeekIdx + 1);
+    BOOST_CHECK_MESSAGE (isOrderKept && isSelectedKept && isSoughtKept,
+                         "The events sought are not the expected ones with "
+                         "the " << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                         << " backend");
+
+    // Skip all the remaining events; nothing is left to be sought
+    const stdair::DateTime_T lEndDateTime =
+      lStartDateTime + stdair::Duration_T (24 * 31, 0, 0);
+    BOOST_CHECK_EQUAL (sevmgrService.skipEventsBefore (lEndDateTime),
+                       lNbOfEvents - lSeekIdx - 1);
+    BOOST_CHECK (sevmgrService.isQueueDone());
+    BOOST_CHECK (sevmgrService.getStatus().getCurrentNb() == lNbOfEvents);
+    BOOST_CHECK (sevmgrService.seek (lEventStruct, lStartDateTime) == false);
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test the cancellation and the rescheduling of queued events, through
+ * the handles given when they are added, whatever the backend
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_event_cancellation_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Build break points, spread (pseudo-randomly) over 30 days, on a
+  // one-hour grid
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfEvents (1000);
+  SEVMGR::EventStructList_T lEventList;
+  unsigned long lSeed = 24680;
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (lSeed % (24 * 30), 0, 0);
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    lEventList.push_back (stdair::EventStruct (stdair::EventType::BRK_PT,
+                                               lBreakPoint_ptr));
+  }
+
+  // Number of events to be popped before the second wave of
+  // cancellations
+  const stdair::Count_T lNbOfFirstPoppedEvents (100);
+
+  for (unsigned short idx = 0;
+       idx != SEVMGR::EventQueueBackendType::LAST_VALUE; ++idx) {
+    const SEVMGR::EventQueueBackendType::EN_EventQueueBackendType lBackend =
+      static_cast<SEVMGR::EventQueueBackendType::EN_EventQueueBackendType> (idx);
+    sevmgrService.reset();
+    sevmgrService.setQueueBackendType (lBackend);
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+
+    // Add the events one by one, keeping their handles
+    std::vector<SEVMGR::EventHandle> lHandleList;
+    for (SEVMGR::EventStructList_T::const_iterator itEvent = lEventList.begin();
+         itEvent != lEventList.end(); ++itEvent) {
+      lHandleList.push_back (sevmgrService.addEvent (*itEvent));
+      BOOST_CHECK (lHandleList.back().isValid() == true);
+    }
+
+    // Cancel one event out of three (twice: the second time fails)
+    std::vector<bool> lIsLiveList (lNbOfEvents, true);
+    stdair::Count_T lNbOfLiveEvents = lNbOfEvents;
+    bool areCancelled = true;
+    for (stdair::Count_T lEventIdx = 0; lEventIdx < lNbOfEvents;
+         lEventIdx += 3) {
+      areCancelled = (areCancelled
+                      && sevmgrService.cancelEvent (lHandleList[lEventIdx])
+                      && !sevmgrService.cancelEvent (lHandleList[lEventIdx])
+                      && !sevmgrService.isEventQueued (lHandleList[lEventIdx]));
+      lIsLiveList[lEventIdx] = false;
+      --lNbOfLiveEvents;
+    }
+    BOOST_CHECK (areCancelled == true);
+    BOOST_CHECK_EQUAL (sevmgrService.getQueueSize(), lNbOfLiveEvents);
+    BOOST_CHECK_EQUAL (sevmgrService.getQueueSize (stdair::EventType::BRK_PT),
+                       lNbOfLiveEvents);
+
+    // Reschedule a few events, half a day later
+    SEVMGR::EventStructList_T lAddedEventList (lEventList);
+    for (stdair::Count_T lEventIdx = 1; lEventIdx < 60; lEventIdx += 3) {
+      const stdair::DateTime_T lDateTime =
+        lEventList[lEventIdx].getEventTime() + stdair::Duration_T (12, 0, 0);
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+      const stdair::EventStruct lEventStruct (stdair::EventType::BRK_PT,
+                                              lBreakPoint_ptr);
+      const SEVMGR::EventHandle lHandle =
+        sevmgrService.rescheduleEvent (lHandleList[lEventIdx], lEventStruct);
+      BOOST_CHECK (lHandle.isValid() == true);
+      BOOST_CHECK (sevmgrService.isEventQueued (lHandle) == true);
+      BOOST_CHECK (sevmgrService.isEventQueued (lHandleList[lEventIdx])
+                   == false);
+      BOOST_CHECK (sevmgrService.rescheduleEvent (lHandleList[lEventIdx],
+                                                  lEventStruct).isValid()
+                   == false);
+      lIsLiveList[lEventIdx] = false;
+      lHandleList.push_back (lHandle);
+      lAddedEventList.push_back (lEventStruct);
+      lIsLiveList.push_back (true);
+    }
+    BOOST_CHECK_EQUAL (sevmgrService.getQueueSize(), lNbOfLiveEvents);
+
+    // Expected order of the queued events
+    SEVMGR::EventStructList_T lExpectedEventList;
+    for (SEVMGR::EventStructList_T::size_type lEventIdx = 0;
+         lEventIdx != lAddedEventList.size(); ++lEventIdx) {
+      if (lIsLiveList[lEventIdx] == true) {
+        lExpectedEventList.push_back (lAddedEventList[lEventIdx]);
+      }
+    }
+    std::stable_sort (lExpectedEventList.begin(), lExpectedEventList.end(),
+                      EventDateTimeLess());
+
+    // Pop a first few events, one by one
+    SEVMGR::EventStructList_T lPoppedEventList;
+    for (stdair::Count_T lEventIdx = 0; lEventIdx != lNbOfFirstPoppedEvents;
+         ++lEventIdx) {
+      stdair::EventStruct lEventStruct;
+      sevmgrService.popEvent (lEventStruct);
+      lPoppedEventList.push_back (lEventStruct);
+    }
+
+    // Cancel most of the other events (enough for the backend to be
+    // compacted): the ones already popped cannot be cancelled anymore
+    std::vector<const stdair::BreakPointStruct*> lCancelledList;
+    for (SEVMGR::EventStructList_T::size_type lEventIdx = 0;
+         lEventIdx != lAddedEventList.size(); ++lEventIdx) {
+      if (lIsLiveList[lEventIdx] == false || lEventIdx % 3 == 1) {
+        continue;
+      }
+      const bool hasBeenPopped =
+        (std::find_if (lPoppedEventList.begin(), lPoppedEventList.end(),
+                       [&] (const stdair::EventStruct& iEventStruct) {
+                         return (&iEventStruct.getBreakPoint()
+                                 == &lAddedEventList[lEventIdx].getBreakPoint());
+                       }) != lPoppedEventList.end());
+      const bool hasBeenCancelled =
+        sevmgrService.cancelEvent (lHandleList[lEventIdx]);
+      BOOST_CHECK (hasBeenCancelled == !hasBeenPopped);
+      if (hasBeenCancelled == true) {
+        lCancelledList.push_back (&lAddedEventList[lEventIdx].getBreakPoint());
+      }
+    }
+
+    // Pop all the remaining events, in one go
+    sevmgrService.popEvents (lPoppedEventList, lNbOfEvents);
+    BOOST_CHECK (sevmgrService.isQueueDone() == true);
+    BOOST_CHECK_EQUAL (sevmgrService.getQueueSize(), 0);
+
+    // The popped events are the expected ones, but for the cancelled ones
+    SEVMGR::EventStructList_T::iterator itExpectedEnd =
+      std::remove_if (lExpectedEventList.begin() + lNbOfFirstPoppedEvents,
+                      lExpectedEventList.end(),
+                      [&] (const stdair::EventStruct& iEventStruct) {
+                        return (std::find (lCancelledList.begin(),
+                                           lCancelledList.end(),
+                                           &iEventStruct.getBreakPoint())
+                                != lCancelledList.end());
+                      });
+    lExpectedEventList.erase (itExpectedEnd, lExpectedEventList.end());
+    bool isOrderKept = (lPoppedEventList.size() == lExpectedEventList.size());
+    for (SEVMGR::EventStructList_T::size_type lEventIdx = 0;
+         isOrderKept && lEventIdx != lPoppedEventList.size(); ++lEventIdx) {
+      if (&lPoppedEventList[lEventIdx].getBreakPoint()
+          != &lExpectedEventList[lEventIdx].getBreakPoint()) {
+        isOrderKept = false;
+      }
+    }
+    BOOST_CHECK_MESSAGE (isOrderKept,
+                         "The popped events are not the expected ones with "
+                         "the " << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                         << " backend");
+    BOOST_CHECK (sevmgrService.getStatus().getCurrentNb()
+                 == lPoppedEventList.size());
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test the non-destructive access to the next events (peekNextEvent(),
+ * getNextEventDateTime() and browseEvents()), whatever the backend
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_event_browsing_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Build break points, spread (pseudo-randomly) over 20 days, on a
+  // one-hour grid (hence, many of them share their date-time)
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfEvents (500);
+  SEVMGR::EventStructList_T lEventList;
+  unsigned long lSeed = 13579;
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (lSeed % (24 * 20), 0, 0);
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    lEventList.push_back (stdair::EventStruct (stdair::EventType::BRK_PT,
+                                               lBreakPoint_ptr));
+  }
+
+  // Expected order of the events, but for the cancelled ones (one out
+  // of four)
+  SEVMGR::EventStructList_T lExpectedEventList;
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    if (idx % 4 != 0) {
+      lExpectedEventList.push_back (lEventList[idx]);
+    }
+  }
+  std::stable_sort (lExpectedEventList.begin(), lExpectedEventList.end(),
+                    EventDateTimeLess());
+
+  // Number of events popped before browsing
+  const stdair::Count_T lNbOfPoppedEvents (50);
+
+  for (unsigned short idx = 0;
+       idx != SEVMGR::EventQueueBackendType::LAST_VALUE; ++idx) {
+    const SEVMGR::EventQueueBackendType::EN_EventQueueBackendType lBackend =
+      static_cast<SEVMGR::EventQueueBackendType::EN_EventQueueBackendType> (idx);
+    sevmgrService.reset();
+    sevmgrService.setQueueBackendType (lBackend);
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+
+    // An empty queue has no next event
+    BOOST_CHECK (sevmgrService.peekNextEvent() == NULL);
+    BOOST_CHECK (sevmgrService.getNextEventDateTime().is_not_a_date_time());
+
+    // Add the events, cancel one out of four, and pop a first few
+    for (stdair::Count_T lEventIdx = 0; lEventIdx != lNbOfEvents;
+         ++lEventIdx) {
+      const SEVMGR::EventHandle lHandle =
+        sevmgrService.addEvent (lEventList[lEventIdx]);
+      if (lEventIdx % 4 == 0) {
+        sevmgrService.cancelEvent (lHandle);
+      }
+    }
+    for (stdair::Count_T lEventIdx = 0; lEventIdx != lNbOfPoppedEvents;
+         ++lEventIdx) {
+      stdair::EventStruct lEventStruct;
+      sevmgrService.popEvent (lEventStruct);
+    }
+    const stdair::Count_T lQueueSize = sevmgrService.getQueueSize();
+    const stdair::Count_T lCurrentNb =
+      sevmgrService.getStatus().getCurrentNb();
+
+    // The next event is given, without being removed
+    const stdair::EventStruct& lNextEventStruct =
+      lExpectedEventList[lNbOfPoppedEvents];
+    const stdair::EventStruct* lPeekedEventStruct_ptr =
+      sevmgrService.peekNextEvent();
+    BOOST_REQUIRE (lPeekedEventStruct_ptr != NULL);
+    BOOST_CHECK (&lPeekedEventStruct_ptr->getBreakPoint()
+                 == &lNextEventStruct.getBreakPoint());
+    BOOST_CHECK (sevmgrService.getNextEventDateTime()
+                 == lNextEventStruct.getEventTime());
+
+    // Browse the events of the next three days: they come in the order
+    // they would be popped, and stop at the horizon (included)
+    const stdair::DateTime_T lHorizonDateTime =
+      lNextEventStruct.getEventTime() + stdair::Duration_T (72, 0, 0);
+    SEVMGR::EventBrowserPtr_T lEventBrowserPtr =
+      sevmgrService.browseEvents (lHorizonDateTime);
+    BOOST_REQUIRE (lEventBrowserPtr != NULL);
+    SEVMGR::EventStructList_T::size_type lExpectedIdx = lNbOfPoppedEvents;
+    bool isOrderKept = true;
+    for (const stdair::EventStruct* lEventStruct_ptr = lEventBrowserPtr->next();
+         lEventStruct_ptr != NULL;
+         lEventStruct_ptr = lEventBrowserPtr->next(), ++lExpectedIdx) {
+      if (lExpectedIdx == lExpectedEventList.size()
+          || &lEventStruct_ptr->getBreakPoint()
+          != &lExpectedEventList[lExpectedIdx].getBreakPoint()) {
+        isOrderKept = false;
+        break;
+      }
+    }
+    BOOST_CHECK (lEventBrowserPtr->next() == NULL);
+    BOOST_CHECK_MESSAGE (isOrderKept,
+                         "The browsed events are not the expected ones with "
+                         "the " << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                         << " backend");
+    BOOST_CHECK (lExpectedIdx > lNbOfPoppedEvents);
+    BOOST_CHECK (lExpectedIdx == lExpectedEventList.size()
+                 || lExpectedEventList[lExpectedIdx].getEventTime()
+                 > lHorizonDateTime);
+    BOOST_CHECK (lExpectedEventList[lExpectedIdx - 1].getEventTime()
+                 <= lHorizonDateTime);
+
+    // Neither the queue nor the progress statuses have been altered
+    BOOST_CHECK_EQUAL (sevmgrService.getQueueSize(), lQueueSize);
+    BOOST_CHECK_EQUAL (sevmgrService.getStatus().getCurrentNb(), lCurrentNb);
+    stdair::EventStruct lEventStruct;
+    sevmgrService.popEvent (lEventStruct);
+    BOOST_CHECK (&lEventStruct.getBreakPoint()
+                 == &lNextEventStruct.getBreakPoint());
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Count, in a brute-force way, the events of the given list within the
+ * given date-time range [from, to), of the given type (or of any type,
+ * with stdair::EventType::LAST_VALUE).
+ */
+stdair::Count_T
+countEventsInRange (const SEVMGR::EventStructList_T& iEventList,
+                    const stdair::DateTime_T& iFromDateTime,
+                    const stdair::DateTime_T& iToDateTime,
+                    const stdair::EventType::EN_EventType& iType) {
+  stdair::Count_T oNbOfEvents = 0;
+  for (SEVMGR::EventStructList_T::const_iterator itEvent = iEventList.begin();
+       itEvent != iEventList.end(); ++itEvent) {
+    if (itEvent->getEventTime() >= iFromDateTime
+        && itEvent->getEventTime() < iToDateTime
+        && (iType == stdair::EventType::LAST_VALUE
+            || itEvent->getEventType() == iType)) {
+      ++oNbOfEvents;
+    }
+  }
+  return oNbOfEvents;
+}
+
+/**
+ * Test the time-range queries over the queued events (countEvents() and
+ * browseEvents() over a date-time range, by type), whatever the backend,
+ * with and without the date-time index
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_time_range_query_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Build break points, spread (pseudo-randomly) over 20 days, on a
+  // one-hour grid (hence, many of them share their date-time)
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfEvents (400);
+  SEVMGR::EventStructList_T lEventList;
+  unsigned long lSeed = 24680;
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (lSeed % (24 * 20), 0, 0);
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    lEventList.push_back (stdair::EventStruct (stdair::EventType::BRK_PT,
+                                               lBreakPoint_ptr));
+  }
+  const stdair::DateTime_T lFarDateTime (stdair::Date_T (2020, 1, 1),
+                                         stdair::Duration_T (0, 0, 0));
+  const stdair::DateTime_T lOldDateTime (stdair::Date_T (2000, 1, 1),
+                                         stdair::Duration_T (0, 0, 0));
+
+  // Date-time index: 0 = none; 1 = switched on before the events are
+  // added (in multi-producer mode); 2 = switched on once they are added
+  for (unsigned short lIndexMode = 0; lIndexMode != 3; ++lIndexMode) {
+    for (unsigned short idx = 0;
+         idx != SEVMGR::EventQueueBackendType::LAST_VALUE; ++idx) {
+      const SEVMGR::EventQueueBackendType::EN_EventQueueBackendType lBackend =
+        static_cast<SEVMGR::EventQueueBackendType::EN_EventQueueBackendType> (idx);
+      sevmgrService.reset();
+      sevmgrService.setQueueTimeIndexed (false);
+      sevmgrService.setQueueMultiProducer (lIndexMode == 1);
+      sevmgrService.setQueueBackendType (lBackend);
+      if (lIndexMode == 1) {
+        sevmgrService.setQueueTimeIndexed (true);
+      }
+
+      // The sample queue holds two booking requests and two break
+      // points. Add the break points, and cancel one out of five among
+      // the ones of the last ten days (so that the first days be
+      // skipped as one range).
+      sevmgrService.buildSampleQueue();
+      sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+      for (stdair::Count_T lEventIdx = 0; lEventIdx != lNbOfEvents;
+           ++lEventIdx) {
+        const SEVMGR::EventHandle lHandle =
+          sevmgrService.addEvent (lEventList[lEventIdx]);
+        if (lEventIdx % 5 == 0
+            && lEventList[lEventIdx].getEventTime()
+            >= lStartDateTime + stdair::Duration_T (24 * 10, 0, 0)) {
+          sevmgrService.cancelEvent (lHandle);
+        }
+      }
+      if (lIndexMode == 2) {
+        sevmgrService.setQueueTimeIndexed (true);
+      }
+
+      // Pop a few events, and skip the ones of the first two days
+      for (stdair::Count_T lEventIdx = 0; lEventIdx != 10; ++lEventIdx) {
+        stdair::EventStruct lEventStruct;
+        sevmgrService.popEvent (lEventStruct);
+      }
+      sevmgrService.skipEventsBefore (lStartDateTime
+                                      + stdair::Duration_T (48, 0, 0));
+
+      // Queued events, as browsed from the start
+      SEVMGR::EventStructList_T lQueuedEventList;
+      SEVMGR::EventBrowserPtr_T lEventBrowserPtr =
+        sevmgrService.browseEvents (lFarDateTime);
+      for (const stdair::EventStruct* lEventStruct_ptr =
+             lEventBrowserPtr->next(); lEventStruct_ptr != NULL;
+           lEventStruct_ptr = lEventBrowserPtr->next()) {
+        lQueuedEventList.push_back (*lEventStruct_ptr);
+      }
+      BOOST_REQUIRE_EQUAL (lQueuedEventList.size(),
+                           sevmgrService.getQueueSize());
+
+      // Count the events of a few ranges, in total and by type, and
+      // browse them
+      bool areCountsCorrect = true;
+      bool areRangesBrowsed = true;
+      for (unsigned short lRangeIdx = 0; lRangeIdx != 30; ++lRangeIdx) {
+        lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+        const stdair::DateTime_T lFromDateTime = (lRangeIdx == 0)
+          ? lOldDateTime
+          : lStartDateTime + stdair::Duration_T (lSeed % (24 * 21), 0, 0);
+        const stdair::DateTime_T lToDateTime = (lRangeIdx == 0)
+          ? lFarDateTime
+          : lFromDateTime + stdair::Duration_T (lSeed % 97, 0, 0);
+
+        if (sevmgrService.countEvents (lFromDateTime, lToDateTime)
+            != countEventsInRange (lQueuedEventList, lFromDateTime,
+                                   lToDateTime,
+                                   stdair::EventType::LAST_VALUE)
+            || sevmgrService.countEvents (lFromDateTime, lToDateTime,
+                                          stdair::EventType::BRK_PT)
+            != countEventsInRange (lQueuedEventList, lFromDateTime,
+                                   lToDateTime, stdair::EventType::BRK_PT)
+            || sevmgrService.countEvents (lFromDateTime, lToDateTime,
+                                          stdair::EventType::BKG_REQ)
+            != countEventsInRange (lQueuedEventList, lFromDateTime,
+                                   lToDateTime, stdair::EventType::BKG_REQ)) {
+          areCountsCorrect = false;
+        }
+
+        // The break points of the range come in chronological order
+        SEVMGR::EventStructList_T::const_iterator itQueuedEvent =
+          lQueuedEventList.begin();
+        SEVMGR::EventBrowserPtr_T lRangeBrowserPtr =
+          sevmgrService.browseEvents (lFromDateTime, lToDateTime,
+                                      stdair::EventType::BRK_PT);
+        for (const stdair::EventStruct* lEventStruct_ptr =
+               lRangeBrowserPtr->next(); lEventStruct_ptr != NULL;
+             lEventStruct_ptr = lRangeBrowserPtr->next(), ++itQueuedEvent) {
+          while (itQueuedEvent != lQueuedEventList.end()
+                 && (itQueuedEvent->getEventTime() < lFromDateTime
+                     || itQueuedEvent->getEventType()
+                     != stdair::EventType::BRK_PT)) {
+            ++itQueuedEvent;
+          }
+          if (itQueuedEvent == lQueuedEventList.end()
+              || itQueuedEvent->getEventTime() >= lToDateTime
+              || &itQueuedEvent->getBreakPoint()
+              != &lEventStruct_ptr->getBreakPoint()) {
+            areRangesBrowsed = false;
+            break;
+          }
+        }
+      }
+      BOOST_CHECK_MESSAGE (areCountsCorrect,
+                           "The event counts are not the expected ones with "
+                           "the " << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                           << " backend (index mode " << lIndexMode << ")");
+      BOOST_CHECK_MESSAGE (areRangesBrowsed,
+                           "The browsed events are not the expected ones with "
+                           "the " << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                           << " backend (index mode " << lIndexMode << ")");
+
+      // Empty and reversed ranges hold no event
+      BOOST_CHECK_EQUAL (sevmgrService.countEvents (lFarDateTime,
+                                                    lOldDateTime), 0);
+      BOOST_CHECK_EQUAL (sevmgrService.countEvents (lFarDateTime,
+                                                    lFarDateTime), 0);
+
+      // The counts follow the pops and the cancellations
+      const stdair::Count_T lQueueSize = sevmgrService.getQueueSize();
+      stdair::EventStruct lEventStruct;
+      sevmgrService.popEvent (lEventStruct);
+      const SEVMGR::EventHandle lHandle = sevmgrService.addEvent (lEventStruct);
+      BOOST_CHECK_EQUAL (sevmgrService.countEvents (lOldDateTime,
+                                                    lFarDateTime), lQueueSize);
+      sevmgrService.cancelEvent (lHandle);
+      BOOST_CHECK_EQUAL (sevmgrService.countEvents (lOldDateTime,
+                                                    lFarDateTime),
+                         lQueueSize - 1);
+      BOOST_CHECK_EQUAL (sevmgrService.countEvents (lOldDateTime,
+                                                    lFarDateTime,
+                                                    stdair::EventType::BRK_PT),
+                         sevmgrService.getQueueSize (stdair::EventType::BRK_PT));
+    }
+  }
+  sevmgrService.setQueueMultiProducer (false);
+  sevmgrService.setQueueTimeIndexed (false);
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test the extraction of events without copy (extractEvent()), along
+ * with the in-place building of events (emplaceEvent()), whatever the
+ * backend
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_extract_event_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Break points, spread (pseudo-randomly) over 10 days, on a one-hour
+  // grid, sorted by date-time then by creation order
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfEvents (500);
+  std::vector<stdair::BreakPointPtr_T> lBreakPointList;
+  unsigned long lSeed = 13579;
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (lSeed % (24 * 10), 0, 0);
+    lBreakPointList.
+      push_back (boost::make_shared<stdair::BreakPointStruct> (lDateTime));
+  }
+
+  for (unsigned short idx = 0;
+       idx != SEVMGR::EventQueueBackendType::LAST_VALUE; ++idx) {
+    const SEVMGR::EventQueueBackendType::EN_EventQueueBackendType lBackend =
+      static_cast<SEVMGR::EventQueueBackendType::EN_EventQueueBackendType> (idx);
+    sevmgrService.reset();
+    sevmgrService.setQueueBackendType (lBackend);
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+
+    for (std::vector<stdair::BreakPointPtr_T>::const_iterator itBreakPoint =
+           lBreakPointList.begin(); itBreakPoint != lBreakPointList.end();
+         ++itBreakPoint) {
+      sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, *itBreakPoint);
+    }
+    BOOST_REQUIRE (sevmgrService.getQueueSize() == lNbOfEvents);
+
+    // Extract all the events. The extracted event must still be shared
+    // by the queue only, while the previous one must have been released.
+    bool areEventsSorted = true;
+    bool areEventsShared = true;
+    stdair::DateTime_T lPreviousDateTime (lStartDateTime);
+    const stdair::BreakPointStruct* lPreviousBreakPoint_ptr = NULL;
+    while (sevmgrService.isQueueDone() == false) {
+      const stdair::EventStruct* lEventStruct_ptr = NULL;
+      const stdair::ProgressStatusSet lProgressStatusSet =
+        sevmgrService.extractEvent (lEventStruct_ptr);
+      BOOST_REQUIRE (lEventStruct_ptr != NULL);
+
+      const stdair::DateTime_T lDateTime = lEventStruct_ptr->getEventTime();
+      if (lDateTime < lPreviousDateTime) {
+        areEventsSorted = false;
+      }
+      lPreviousDateTime = lDateTime;
+
+      for (std::vector<stdair::BreakPointPtr_T>::const_iterator itBreakPoint =
+             lBreakPointList.begin(); itBreakPoint != lBreakPointList.end();
+           ++itBreakPoint) {
+        const long lExpectedUseCount =
+          (itBreakPoint->get() == &lEventStruct_ptr->getBreakPoint()) ? 2
+          : (itBreakPoint->get() == lPreviousBreakPoint_ptr) ? 1 : -1;
+        if (lExpectedUseCount != -1
+            && itBreakPoint->use_count() != lExpectedUseCount) {
+          areEventsShared = false;
+        }
+      }
+      lPreviousBreakPoint_ptr = &lEventStruct_ptr->getBreakPoint();
+    }
+
+    /** Are the events extracted in order, and released in due time? */
+    BOOST_CHECK_MESSAGE (areEventsSorted && areEventsShared,
+                         "The events are not extracted as expected with "
+                         "the "
+                         << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                         << " backend");
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+// //////////////////////////////////////////////////////////////////////
+/**
+ * Monitoring thread, reading the progress statuses of the queue while
+ * the events are popped by the main thread
+ */
+struct ProgressStatusReader {
+  ProgressStatusReader (const SEVMGR::SEVMGR_Service& iSEVMGR_Service,
+                        const std::atomic<bool>& iIsQueueDone)
+    : _sevmgrService (iSEVMGR_Service), _isQueueDone (iIsQueueDone),
+      _nbOfReads (0), _isViewConsistent (true) {
+  }
+
+  void operator() () {
+    stdair::Count_T lPreviousCurrentNb = 0;
+    while (_isQueueDone.load() == false) {
+      const stdair::ProgressStatusSet lProgressStatusSet =
+        _sevmgrService.getMonitoredStatus (stdair::EventType::BRK_PT);
+      const stdair::ProgressStatus& lTypeStatus =
+        lProgressStatusSet.getTypeSpecificStatus();
+      const stdair::ProgressStatus& lOverallStatus =
+        lProgressStatusSet.getOverallStatus();
+
+      // There are only break points: both statuses must match, and the
+      // number of popped events may only increase
+      const stdair::Count_T& lCurrentNb = lTypeStatus.getCurrentNb();
+      if (lCurrentNb != lOverallStatus.getCurrentNb()
+          || lCurrentNb < lPreviousCurrentNb) {
+        _isViewConsistent = false;
+      }
+      lPreviousCurrentNb = lCurrentNb;
+      ++_nbOfReads;
+    }
+  }
+
+  const SEVMGR::SEVMGR_Service& _sevmgrService;
+  const std::atomic<bool>& _isQueueDone;
+  stdair::Count_T _nbOfReads;
+  bool _isViewConsistent;
+};
+
+/**
+ * Test the progress statuses, per event type (including the last one)
+ * and overall, through their declarations, updates and the pops
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_progress_status_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+  const SEVMGR::EventQueue& lEventQueue = sevmgrService.getEventQueue();
+
+  // Declare the progress statuses of three event types, among which
+  // the one with the last enumeration value
+  const stdair::EventType::EN_EventType lLastType =
+    static_cast<stdair::EventType::EN_EventType>
+    (stdair::EventType::LAST_VALUE - 1);
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, 10);
+  sevmgrService.addStatus (stdair::EventType::BKG_REQ, 4);
+  sevmgrService.addStatus (lLastType, 6);
+  BOOST_CHECK (sevmgrService.hasProgressStatus (stdair::EventType::BRK_PT));
+  BOOST_CHECK (sevmgrService.hasProgressStatus (stdair::EventType::BKG_REQ));
+  BOOST_CHECK (sevmgrService.hasProgressStatus (lLastType));
+  BOOST_CHECK (sevmgrService.hasProgressStatus (stdair::EventType::RM)
+               == false);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus (lLastType).getExpectedNb(), 6);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus (lLastType).getActualNb(), 6);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getExpectedNb(), 20);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getActualNb(), 20);
+
+  // Update the actual numbers of events: the overall status follows
+  sevmgrService.updateStatus (stdair::EventType::BKG_REQ, 6);
+  sevmgrService.updateStatus (lLastType, 3);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus (stdair::EventType::BKG_REQ)
+                     .getExpectedNb(), 4);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus (stdair::EventType::BKG_REQ)
+                     .getActualNb(), 6);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus (lLastType).getActualNb(), 3);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getExpectedNb(), 20);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getActualNb(), 19);
+
+  // Declaring the progress status of a type again adds up
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, 5);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus (stdair::EventType::BRK_PT)
+                     .getExpectedNb(), 15);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus (stdair::EventType::BRK_PT)
+                     .getActualNb(), 15);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getExpectedNb(), 25);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getActualNb(), 24);
+
+  // Pop three break points: only their type, and the overall status,
+  // progress
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  for (unsigned short idx = 0; idx != 3; ++idx) {
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct>
+      (lStartDateTime + stdair::Duration_T (idx, 0, 0));
+    sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+  }
+  while (sevmgrService.isQueueDone() == false) {
+    stdair::EventStruct lEventStruct;
+    sevmgrService.popEvent (lEventStruct);
+  }
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus (stdair::EventType::BRK_PT)
+                     .getCurrentNb(), 3);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus (stdair::EventType::BKG_REQ)
+                     .getCurrentNb(), 0);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus (lLastType).getCurrentNb(), 0);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getCurrentNb(), 3);
+  BOOST_CHECK_CLOSE (lEventQueue.calculateProgress (stdair::EventType::BRK_PT),
+                     100.0 * 3 / 15, 1e-6);
+  BOOST_CHECK (lEventQueue.calculateProgress (lLastType) == 0);
+  BOOST_CHECK_CLOSE (lEventQueue.calculateProgress(), 100.0 * 3 / 24, 1e-6);
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test the reading of the progress statuses from another thread, while
+ * the events are popped
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_progress_monitor_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Break points, one per minute
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfEvents (20000);
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (0, idx, 0);
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+  }
+
+  // Pop all the events (alternatively one by one and by batch), while
+  // the monitoring thread reads the progress statuses
+  std::atomic<bool> isQueueDone (false);
+  ProgressStatusReader lProgressStatusReader (sevmgrService, isQueueDone);
+  std::thread lMonitoringThread (std::ref (lProgressStatusReader));
+
+  SEVMGR::EventStructList_T lEventStructList;
+  while (sevmgrService.isQueueDone() == false) {
+    stdair::EventStruct lEventStruct;
+    sevmgrService.popEvent (lEventStruct);
+    lEventStructList.clear();
+    sevmgrService.popEvents (lEventStructList, 10);
+  }
+  isQueueDone.store (true);
+  lMonitoringThread.join();
+
+  /** Have the progress statuses been read consistently? */
+  BOOST_CHECK_MESSAGE (lProgressStatusReader._isViewConsistent,
+                       "The progress statuses read by the monitoring thread "
+                       "are not consistent");
+
+  /** Once the events all popped, is the published status up to date? */
+  const stdair::ProgressStatus lOverallStatus =
+    sevmgrService.getMonitoredStatus();
+  BOOST_CHECK_MESSAGE (lOverallStatus.getCurrentNb() == lNbOfEvents,
+                       "The published number of popped events is "
+                       << lOverallStatus.getCurrentNb()
+                       << ", whereas it should be " << lNbOfEvents);
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+// //////////////////////////////////////////////////////////////////////
+/**
+ * Producer thread, adding break points to the queue, one per minute on
+ * a grid of its own
+ */
+struct BreakPointProducer {
+  BreakPointProducer (const SEVMGR::SEVMGR_Service& iSEVMGR_Service,
+                      const stdair::DateTime_T& iStartDateTime,
+                      const unsigned short& iProducerIdx,
+                      const unsigned short& iNbOfProducers,
+                      const stdair::Count_T& iNbOfEvents)
+    : _sevmgrService (iSEVMGR_Service), _startDateTime (iStartDateTime),
+      _producerIdx (iProducerIdx), _nbOfProducers (iNbOfProducers),
+      _nbOfEvents (iNbOfEvents) {
+  }
+
+  void operator() () const {
+    for (stdair::Count_T idx = 0; idx != _nbOfEvents; ++idx) {
+      const stdair::DateTime_T lDateTime = _startDateTime
+        + stdair::Duration_T (0, idx * _nbOfProducers + _producerIdx, 0);
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+      _sevmgrService.emplaceEvent (stdair::EventType::BRK_PT,
+                                   lBreakPoint_ptr);
+    }
+  }
+
+  const SEVMGR::SEVMGR_Service& _sevmgrService;
+  const stdair::DateTime_T _startDateTime;
+  const unsigned short _producerIdx;
+  const unsigned short _nbOfProducers;
+  const stdair::Count_T _nbOfEvents;
+};
+
+/**
+ * Test the addition of events from several threads (multi-producer
+ * mode), while the events are popped by the main thread
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_multi_producer_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const unsigned short lNbOfProducers (4);
+  const stdair::Count_T lNbOfEventsPerProducer (5000);
+  const stdair::Count_T lNbOfEvents (lNbOfProducers * lNbOfEventsPerProducer);
+
+  for (unsigned short idx = 0;
+       idx != SEVMGR::EventQueueBackendType::LAST_VALUE; ++idx) {
+    const SEVMGR::EventQueueBackendType::EN_EventQueueBackendType lBackend =
+      static_cast<SEVMGR::EventQueueBackendType::EN_EventQueueBackendType> (idx);
+    sevmgrService.reset();
+    sevmgrService.setQueueBackendType (lBackend);
+    sevmgrService.setQueueMultiProducer (true);
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+
+    // Start the producers
+    std::vector<std::thread> lProducerList;
+    for (unsigned short lProducerIdx = 0; lProducerIdx != lNbOfProducers;
+         ++lProducerIdx) {
+      const BreakPointProducer lProducer (sevmgrService, lStartDateTime,
+                                          lProducerIdx, lNbOfProducers,
+                                          lNbOfEventsPerProducer);
+      lProducerList.push_back (std::thread (lProducer));
+    }
+
+    // Pop the events while they are added. The events of a given
+    // producer must come out in the order that producer added them.
+    std::vector<long> lLastMinuteList (lNbOfProducers, -1);
+    bool areEventsOrdered = true;
+    stdair::Count_T lNbOfPoppedEvents = 0;
+    while (lNbOfPoppedEvents != lNbOfEvents) {
+      if (sevmgrService.isQueueDone() == true) {
+        std::this_thread::yield();
+        continue;
+      }
+      stdair::EventStruct lEventStruct;
+      sevmgrService.popEvent (lEventStruct);
+      ++lNbOfPoppedEvents;
+
+      const stdair::Duration_T lDuration =
+        lEventStruct.getEventTime() - lStartDateTime;
+      const long lMinute = lDuration.total_seconds() / 60;
+      long& lLastMinute = lLastMinuteList[lMinute % lNbOfProducers];
+      if (lMinute <= lLastMinute) {
+        areEventsOrdered = false;
+      }
+      lLastMinute = lMinute;
+    }
+
+    for (std::vector<std::thread>::iterator itProducer =
+           lProducerList.begin(); itProducer != lProducerList.end();
+         ++itProducer) {
+      itProducer->join();
+    }
+    sevmgrService.setQueueMultiProducer (false);
+
+    /** Have all the events been popped, in order for each producer? */
+    BOOST_CHECK_MESSAGE (areEventsOrdered
+                         && sevmgrService.isQueueDone() == true,
+                         "The events added from several threads are not "
+                         "popped as expected with the "
+                         << SEVMGR::EventQueueBackendType::getLabel (lBackend)
+                         << " backend");
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test several event queues within the same service
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_multiple_queues_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Add a queue per scenario, the default one (EQ01) being the first one
+  const SEVMGR::EventQueueID_T lScenarioList[] = { "EQ01", "EQ02", "EQ03" };
+  const unsigned short lNbOfScenarios (3);
+  sevmgrService.addEventQueue (lScenarioList[1],
+                               SEVMGR::EventQueueBackendType::DARY_HEAP);
+  sevmgrService.addEventQueue (lScenarioList[2],
+                               SEVMGR::EventQueueBackendType::COMPACT_HEAP);
+  BOOST_CHECK (sevmgrService.hasEventQueue (lScenarioList[2]) == true);
+  BOOST_CHECK (sevmgrService.hasEventQueue ("EQ04") == false);
+  BOOST_CHECK_THROW (sevmgrService.addEventQueue (lScenarioList[1]),
+                     SEVMGR::EventQueueException);
+  BOOST_CHECK_THROW (sevmgrService.selectEventQueue ("EQ04"),
+                     SEVMGR::EventQueueException);
+
+  // Fill each queue with a different number of break points
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  for (unsigned short idx = 0; idx != lNbOfScenarios; ++idx) {
+    sevmgrService.selectEventQueue (lScenarioList[idx]);
+    const stdair::Count_T lNbOfEvents = 10 * (idx + 1);
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+    for (stdair::Count_T lEventIdx = 0; lEventIdx != lNbOfEvents;
+         ++lEventIdx) {
+      const stdair::DateTime_T lDateTime =
+        lStartDateTime + stdair::Duration_T (lNbOfEvents - lEventIdx, 0, 0);
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+      sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+    }
+  }
+
+  // Drain each queue: the queues must not have interfered
+  for (unsigned short idx = 0; idx != lNbOfScenarios; ++idx) {
+    sevmgrService.selectEventQueue (lScenarioList[idx]);
+    const stdair::Count_T lNbOfEvents = 10 * (idx + 1);
+    BOOST_CHECK_EQUAL (sevmgrService.getQueueSize(), lNbOfEvents);
+
+    SEVMGR::EventStructList_T lEventStructList;
+    sevmgrService.popEvents (lEventStructList, 2 * lNbOfEvents);
+    BOOST_CHECK (sevmgrService.isQueueDone() == true);
+    BOOST_CHECK_EQUAL (lEventStructList.size(),
+                       static_cast<std::size_t> (lNbOfEvents));
+    BOOST_CHECK_EQUAL (sevmgrService.getStatus().getCurrentNb(), lNbOfEvents);
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Assignment of the break points to two partitions, according to the
+ * parity of their hour.
+ */
+struct HourParityPartitioner : public SEVMGR::EventPartitioner {
+  SEVMGR::PartitionIndex_T
+  getPartition (const stdair::EventStruct& iEventStruct) const {
+    return (iEventStruct.getEventTime().time_of_day().hours() % 2);
+  }
+};
+
+/**
+ * Handler of the break points of a partition. It checks that the break
+ * points come in date-time order and, for the ones flagged as such
+ * (on the hour), schedules a follow-up break point into the other
+ * partition, one hour (i.e., the lookahead) and a minute later.
+ */
+struct BreakPointCounter : public SEVMGR::PartitionEventHandler {
+  BreakPointCounter() : _nbOfHandledEvents (0), _isOrdered (true) {
+  }
+
+  void handle (const stdair::EventStruct& iEventStruct,
+               SEVMGR::PartitionEventScheduler& ioScheduler) {
+    const stdair::DateTime_T lDateTime = iEventStruct.getEventTime();
+    if (_nbOfHandledEvents != 0 && lDateTime < _lastDateTime) {
+      _isOrdered = false;
+    }
+    _lastDateTime = lDateTime;
+    ++_nbOfHandledEvents;
+
+    if (lDateTime.time_of_day().minutes() == 0) {
+      const stdair::DateTime_T lFollowUpDateTime =
+        lDateTime + stdair::Duration_T (1, 1, 0);
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct> (lFollowUpDateTime);
+      const stdair::EventStruct lEventStruct (stdair::EventType::BRK_PT,
+                                              lBreakPoint_ptr);
+      ioScheduler.scheduleEvent (lEventStruct);
+    }
+  }
+
+  stdair::Count_T _nbOfHandledEvents;
+  stdair::DateTime_T _lastDateTime;
+  bool _isOrdered;
+};
+
+/**
+ * Handler scheduling an event into another partition, without
+ * respecting the lookahead.
+ */
+struct LookaheadBreaker : public SEVMGR::PartitionEventHandler {
+  void handle (const stdair::EventStruct& iEventStruct,
+               SEVMGR::PartitionEventScheduler& ioScheduler) {
+    const stdair::DateTime_T lDateTime =
+      iEventStruct.getEventTime() + stdair::Duration_T (0, 59, 0);
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    const stdair::EventStruct lEventStruct (stdair::EventType::BRK_PT,
+                                            lBreakPoint_ptr);
+    ioScheduler.scheduleEvent (lEventStruct);
+  }
+};
+
+/**
+ * Assignment of the events to two partitions: the booking requests and
+ * the break points on the second go to the first partition, the other
+ * break points to the second one.
+ */
+struct SecondParityPartitioner : public SEVMGR::EventPartitioner {
+  SEVMGR::PartitionIndex_T
+  getPartition (const stdair::EventStruct& iEventStruct) const {
+    if (iEventStruct.getEventType() == stdair::EventType::BKG_REQ) {
+      return 0;
+    }
+    return (iEventStruct.getEventTime().time_of_day().seconds() % 2);
+  }
+};
+
+/**
+ * Handler chaining two event types, with different lookaheads: a
+ * booking request (long lookahead) schedules, into its own partition, a
+ * break point on the second one hour later; that break point (short
+ * lookahead) schedules, into the other partition, a break point one
+ * hour and a second later, i.e., respecting its own lookahead only.
+ */
+struct EventTypeChainer : public SEVMGR::PartitionEventHandler {
+  EventTypeChainer() : _nbOfHandledEvents (0) {
+  }
+
+  void handle (const stdair::EventStruct& iEventStruct,
+               SEVMGR::PartitionEventScheduler& ioScheduler) {
+    ++_nbOfHandledEvents;
+
+    const stdair::DateTime_T lDateTime = iEventStruct.getEventTime();
+    const stdair::Duration_T& lTime = lDateTime.time_of_day();
+    stdair::DateTime_T lNextDateTime;
+    if (iEventStruct.getEventType() == stdair::EventType::BKG_REQ) {
+      lNextDateTime =
+        stdair::DateTime_T (lDateTime.date(),
+                            stdair::Duration_T (lTime.hours() + 1,
+                                                lTime.minutes(), 0));
+    } else if (lTime.seconds() == 0) {
+      lNextDateTime = lDateTime + stdair::Duration_T (1, 0, 1);
+    } else {
+      return;
+    }
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lNextDateTime);
+    const stdair::EventStruct lEventStruct (stdair::EventType::BRK_PT,
+                                            lBreakPoint_ptr);
+    ioScheduler.scheduleEvent (lEventStruct);
+  }
+
+  stdair::Count_T _nbOfHandledEvents;
+};
+
+/**
+ * Test the conservative partitioned simulation: every partition gets
+ * its events in date-time order, including the ones scheduled by the
+ * other partitions, and the lookahead is enforced.
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_partitioned_run_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Add break points every 20 minutes over two days
+  const stdair::Count_T lNbOfEvents (144);
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+  for (stdair::Count_T idx = lNbOfEvents; idx != 0; --idx) {
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (0, 20 * (idx - 1), 0);
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+  }
+
+  // Simulate the break points over two partitions
+  const HourParityPartitioner lPartitioner;
+  BreakPointCounter lEvenHourCounter;
+  BreakPointCounter lOddHourCounter;
+  SEVMGR::PartitionEventHandlerList_T lHandlerList;
+  lHandlerList.push_back (&lEvenHourCounter);
+  lHandlerList.push_back (&lOddHourCounter);
+  SEVMGR::EventLookaheadMap_T lLookaheadMap;
+  lLookaheadMap.insert (SEVMGR::EventLookaheadMap_T::
+                        value_type (stdair::EventType::BRK_PT,
+                                    stdair::Duration_T (1, 0, 0)));
+  const stdair::Count_T lNbOfHandledEvents =
+    sevmgrService.runPartitioned (lPartitioner, lHandlerList, lLookaheadMap);
+
+  // Each of the 48 break points on the hour has a follow-up
+  const stdair::Count_T lNbOfFollowUps (48);
+  BOOST_CHECK_EQUAL (lNbOfHandledEvents, lNbOfEvents + lNbOfFollowUps);
+  BOOST_CHECK_EQUAL (lEvenHourCounter._nbOfHandledEvents
+                     + lOddHourCounter._nbOfHandledEvents,
+                     lNbOfHandledEvents);
+  BOOST_CHECK (lEvenHourCounter._isOrdered == true);
+  BOOST_CHECK (lOddHourCounter._isOrdered == true);
+  BOOST_CHECK (sevmgrService.isQueueDone() == true);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getCurrentNb(),
+                     lNbOfHandledEvents);
+
+  // A handler not respecting the lookahead makes the simulation fail,
+  // the events not handled yet being given back to the event queue
+  sevmgrService.reset();
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, 2);
+  const stdair::BreakPointPtr_T lBreakPoint_ptr =
+    boost::make_shared<stdair::BreakPointStruct> (lStartDateTime);
+  sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+  LookaheadBreaker lLookaheadBreaker;
+  lHandlerList.clear();
+  lHandlerList.push_back (&lLookaheadBreaker);
+  lHandlerList.push_back (&lLookaheadBreaker);
+  BOOST_CHECK_THROW (sevmgrService.runPartitioned (lPartitioner, lHandlerList,
+                                                   lLookaheadMap),
+                     SEVMGR::EventQueueException);
+
+  // The events scheduled locally, of a type with a shorter lookahead
+  // than the ones held by the partition, may send events to the other
+  // partition, provided that they respect their own lookahead
+  sevmgrService.reset();
+  sevmgrService.addStatus (stdair::EventType::BKG_REQ, 1);
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, 2);
+  const stdair::BookingRequestPtr_T lBookingRequest_ptr =
+    boost::make_shared<stdair::BookingRequestStruct>
+    (sevmgrService.buildSampleBookingRequest());
+  sevmgrService.emplaceEvent (stdair::EventType::BKG_REQ, lBookingRequest_ptr);
+  const SecondParityPartitioner lSecondParityPartitioner;
+  EventTypeChainer lFirstChainer;
+  EventTypeChainer lSecondChainer;
+  lHandlerList.clear();
+  lHandlerList.push_back (&lFirstChainer);
+  lHandlerList.push_back (&lSecondChainer);
+  lLookaheadMap.insert (SEVMGR::EventLookaheadMap_T::
+                        value_type (stdair::EventType::BKG_REQ,
+                                    stdair::Duration_T (10, 0, 0)));
+  BOOST_CHECK_EQUAL (sevmgrService.runPartitioned (lSecondParityPartitioner,
+                                                   lHandlerList,
+                                                   lLookaheadMap),
+                     3);
+  BOOST_CHECK_EQUAL (lFirstChainer._nbOfHandledEvents, 2);
+  BOOST_CHECK_EQUAL (lSecondChainer._nbOfHandledEvents, 1);
+  BOOST_CHECK (sevmgrService.isQueueDone() == true);
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Assignment of the break points to two partitions, according to the
+ * parity of their minute.
+ */
+struct MinuteParityPartitioner : public SEVMGR::EventPartitioner {
+  SEVMGR::PartitionIndex_T
+  getPartition (const stdair::EventStruct& iEventStruct) const {
+    return (iEventStruct.getEventTime().time_of_day().minutes() % 2);
+  }
+};
+
+/**
+ * Handler of the break points of a partition, the state of which is the
+ * list of the handled break points. The break points on the hour (resp.
+ * one minute past the hour) schedule a follow-up break point one minute
+ * later, hence into the other partition.
+ */
+struct BreakPointRecorder : public SEVMGR::PartitionEventHandler,
+                            public SEVMGR::PartitionStateHandler {
+  typedef std::vector<stdair::DateTime_T> DateTimeList_T;
+
+  void handle (const stdair::EventStruct& iEventStruct,
+               SEVMGR::PartitionEventScheduler& ioScheduler) {
+    const stdair::DateTime_T lDateTime = iEventStruct.getEventTime();
+    _dateTimeList.push_back (lDateTime);
+
+    if (lDateTime.time_of_day().minutes() <= 1) {
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct>
+        (lDateTime + stdair::Duration_T (0, 1, 0));
+      const stdair::EventStruct lEventStruct (stdair::EventType::BRK_PT,
+                                              lBreakPoint_ptr);
+      ioScheduler.scheduleEvent (lEventStruct);
+    }
+  }
+
+  void saveState (const SEVMGR::CheckpointID_T& iCheckpointID) {
+    _savedStateMap[iCheckpointID] = _dateTimeList;
+  }
+  void restoreState (const SEVMGR::CheckpointID_T& iCheckpointID) {
+    _dateTimeList = _savedStateMap[iCheckpointID];
+  }
+  void discardState (const SEVMGR::CheckpointID_T& iCheckpointID) {
+    _savedStateMap.erase (iCheckpointID);
+  }
+
+  DateTimeList_T _dateTimeList;
+  std::map<SEVMGR::CheckpointID_T, DateTimeList_T> _savedStateMap;
+};
+
+/**
+ * Handler failing on the break points of a given date-time.
+ */
+struct FailingBreakPointHandler : public SEVMGR::PartitionEventHandler {
+  FailingBreakPointHandler (const stdair::DateTime_T& iFailureDateTime)
+    : _failureDateTime (iFailureDateTime) {
+  }
+
+  void handle (const stdair::EventStruct& iEventStruct,
+               SEVMGR::PartitionEventScheduler& ioScheduler) {
+    if (iEventStruct.getEventTime() == _failureDateTime) {
+      throw SEVMGR::EventQueueException ("Failing break point");
+    }
+  }
+
+  const stdair::DateTime_T _failureDateTime;
+};
+
+/**
+ * Break point tagged with a label, which gives its partition: the 'A',
+ * 'D' and 'E' break points go to the first partition, the 'B' and 'C'
+ * ones to the second partition.
+ */
+struct TaggedBreakPoint : public stdair::BreakPointStruct {
+  TaggedBreakPoint (const stdair::DateTime_T& iDateTime, const char iTag)
+    : stdair::BreakPointStruct (iDateTime), _tag (iTag) {
+  }
+
+  const char _tag;
+};
+
+/**
+ * Assignment of the tagged break points to two partitions.
+ */
+struct TagPartitioner : public SEVMGR::EventPartitioner {
+  SEVMGR::PartitionIndex_T
+  getPartition (const stdair::EventStruct& iEventStruct) const {
+    const TaggedBreakPoint& lBreakPoint =
+      dynamic_cast<const TaggedBreakPoint&> (iEventStruct.getBreakPoint());
+    return (lBreakPoint._tag == 'B' || lBreakPoint._tag == 'C' ? 1 : 0);
+  }
+};
+
+/**
+ * Handler of the tagged break points of a partition, the state of which
+ * is the trace of the handled break points. The break points schedule,
+ * at their own date-time, into the other partition, a break point of
+ * the next generation: 'A' schedules 'C', 'B' schedules 'D', and 'C'
+ * schedules 'E'.
+ */
+struct TieChainer : public SEVMGR::PartitionEventHandler,
+                    public SEVMGR::PartitionStateHandler {
+  typedef std::vector<std::string> TraceList_T;
+
+  void handle (const stdair::EventStruct& iEventStruct,
+               SEVMGR::PartitionEventScheduler& ioScheduler) {
+    const TaggedBreakPoint& lBreakPoint =
+      dynamic_cast<const TaggedBreakPoint&> (iEventStruct.getBreakPoint());
+    std::ostringstream oStr;
+    oStr << lBreakPoint._tag << " " << iEventStruct.getEventTime();
+    _traceList.push_back (oStr.str());
+
+    char lNextTag = '\0';
+    switch (lBreakPoint._tag) {
+    case 'A': lNextTag = 'C'; break;
+    case 'B': lNextTag = 'D'; break;
+    case 'C': lNextTag = 'E'; break;
+    default: return;
+    }
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<TaggedBreakPoint> (iEventStruct.getEventTime(),
+                                            lNextTag);
+    const stdair::EventStruct lEventStruct (stdair::EventType::BRK_PT,
+                                            lBreakPoint_ptr);
+    ioScheduler.scheduleEvent (lEventStruct);
+  }
+
+  void saveState (const SEVMGR::CheckpointID_T& iCheckpointID) {
+    _savedStateMap[iCheckpointID] = _traceList;
+  }
+  void restoreState (const SEVMGR::CheckpointID_T& iCheckpointID) {
+    _traceList = _savedStateMap[iCheckpointID];
+  }
+  void discardState (const SEVMGR::CheckpointID_T& iCheckpointID) {
+    _savedStateMap.erase (iCheckpointID);
+  }
+
+  TraceList_T _traceList;
+  std::map<SEVMGR::CheckpointID_T, TraceList_T> _savedStateMap;
+};
+
+/**
+ * Scheduler of a sequential simulation, adding the scheduled events
+ * straight to the event queue.
+ */
+struct SequentialScheduler : public SEVMGR::PartitionEventScheduler {
+  SequentialScheduler (const SEVMGR::SEVMGR_Service& iSevmgrService)
+    : _sevmgrService (iSevmgrService), _partition (0) {
+  }
+
+  const SEVMGR::PartitionIndex_T& getPartitionIndex() const {
+    return _partition;
+  }
+  stdair::DateTime_T getCurrentTime() const {
+    return _currentTime;
+  }
+  void scheduleEvent (const stdair::EventStruct& iEventStruct) {
+    _sevmgrService.addEvent (iEventStruct);
+  }
+
+  const SEVMGR::SEVMGR_Service& _sevmgrService;
+  SEVMGR::PartitionIndex_T _partition;
+  stdair::DateTime_T _currentTime;
+};
+
+/**
+ * Add, at every minute, an 'A' and a 'B' tagged break points, hence
+ * tied events in both partitions, and their follow-ups.
+ */
+void addTiedBreakPoints (const SEVMGR::SEVMGR_Service& iSevmgrService,
+                         const stdair::DateTime_T& iStartDateTime,
+                         const stdair::Count_T& iNbOfMinutes) {
+  // Each 'A' break point leads to a 'C' and an 'E' ones, each 'B' one
+  // to a 'D' one
+  iSevmgrService.addStatus (stdair::EventType::BRK_PT, 5 * iNbOfMinutes);
+  for (stdair::Count_T idx = 0; idx != iNbOfMinutes; ++idx) {
+    const stdair::DateTime_T lDateTime =
+      iStartDateTime + stdair::Duration_T (0, idx, 0);
+    const stdair::BreakPointPtr_T lBreakPointA_ptr =
+      boost::make_shared<TaggedBreakPoint> (lDateTime, 'A');
+    iSevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPointA_ptr);
+    const stdair::BreakPointPtr_T lBreakPointB_ptr =
+      boost::make_shared<TaggedBreakPoint> (lDateTime, 'B');
+    iSevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPointB_ptr);
+  }
+}
+
+/**
+ * Test the optimistic partitioned simulation: in spite of the rollbacks,
+ * every partition ends up with its events handled once, in date-time
+ * order, and all the checkpoints are discarded.
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_optimistic_run_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Add break points every 20 minutes over two days, all of them on
+  // even minutes
+  const stdair::Count_T lNbOfEvents (144);
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    const stdair::DateTime_T lDateTime =
+      lStartDateTime + stdair::Duration_T (0, 20 * idx, 0);
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (lDateTime);
+    sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+  }
+
+  // Simulate the break points over two partitions
+  const MinuteParityPartitioner lPartitioner;
+  BreakPointRecorder lEvenMinuteRecorder;
+  BreakPointRecorder lOddMinuteRecorder;
+  SEVMGR::PartitionEventHandlerList_T lHandlerList;
+  lHandlerList.push_back (&lEvenMinuteRecorder);
+  lHandlerList.push_back (&lOddMinuteRecorder);
+  SEVMGR::PartitionStateHandlerList_T lStateHandlerList;
+  lStateHandlerList.push_back (&lEvenMinuteRecorder);
+  lStateHandlerList.push_back (&lOddMinuteRecorder);
+  const stdair::Count_T lNbOfHandledEvents =
+    sevmgrService.runOptimistic (lPartitioner, lHandlerList,
+                                 lStateHandlerList, 4, 1000);
+
+  // Each of the 48 break points on the hour has a follow-up one minute
+  // past the hour, which has itself a follow-up two minutes past the hour
+  const stdair::Count_T lNbOfFollowUps (48);
+  BOOST_CHECK_EQUAL (lNbOfHandledEvents, lNbOfEvents + 2 * lNbOfFollowUps);
+  BOOST_CHECK_EQUAL (lEvenMinuteRecorder._dateTimeList.size(),
+                     static_cast<std::size_t> (lNbOfEvents + lNbOfFollowUps));
+  BOOST_CHECK_EQUAL (lOddMinuteRecorder._dateTimeList.size(),
+                     static_cast<std::size_t> (lNbOfFollowUps));
+  BOOST_CHECK (std::is_sorted (lEvenMinuteRecorder._dateTimeList.begin(),
+                               lEvenMinuteRecorder._dateTimeList.end()));
+  BOOST_CHECK (std::is_sorted (lOddMinuteRecorder._dateTimeList.begin(),
+                               lOddMinuteRecorder._dateTimeList.end()));
+  BOOST_CHECK (lEvenMinuteRecorder._savedStateMap.empty() == true);
+  BOOST_CHECK (lOddMinuteRecorder._savedStateMap.empty() == true);
+  BOOST_CHECK (sevmgrService.isQueueDone() == true);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getCurrentNb(),
+                     lNbOfHandledEvents);
+
+  // A failing handler stops the simulation, the events not handled yet
+  // being given back to the event queue
+  sevmgrService.reset();
+  const stdair::Count_T lNbOfFailureEvents (10);
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfFailureEvents);
+  for (stdair::Count_T idx = 0; idx != lNbOfFailureEvents; ++idx) {
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct>
+      (lStartDateTime + stdair::Duration_T (0, idx, 0));
+    sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+  }
+  FailingBreakPointHandler
+    lFailingHandler (lStartDateTime + stdair::Duration_T (0, 5, 0));
+  lHandlerList.clear();
+  lHandlerList.push_back (&lFailingHandler);
+  lHandlerList.push_back (&lFailingHandler);
+  lStateHandlerList.clear();
+  BOOST_CHECK_THROW (sevmgrService.runOptimistic (lPartitioner, lHandlerList,
+                                                  lStateHandlerList, 1, 1),
+                     SEVMGR::EventQueueException);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getCurrentNb()
+                     + sevmgrService.getQueueSize(), lNbOfFailureEvents);
+  BOOST_CHECK (sevmgrService.getQueueSize() > 0);
+
+  // The events scheduled at the date-time of the handled event, across
+  // the partitions, are handled in the same order as with a sequential
+  // simulation, whatever the timing of the workers
+  const stdair::Count_T lNbOfMinutes (50);
+  sevmgrService.reset();
+  addTiedBreakPoints (sevmgrService, lStartDateTime, lNbOfMinutes);
+  const TagPartitioner lTagPartitioner;
+  TieChainer lFirstSequentialChainer;
+  TieChainer lSecondSequentialChainer;
+  SEVMGR::PartitionEventHandlerList_T lSequentialHandlerList;
+  lSequentialHandlerList.push_back (&lFirstSequentialChainer);
+  lSequentialHandlerList.push_back (&lSecondSequentialChainer);
+  SequentialScheduler lSequentialScheduler (sevmgrService);
+  while (sevmgrService.isQueueDone() == false) {
+    stdair::EventStruct lEventStruct;
+    sevmgrService.popEvent (lEventStruct);
+    lSequentialScheduler._partition =
+      lTagPartitioner.getPartition (lEventStruct);
+    lSequentialScheduler._currentTime = lEventStruct.getEventTime();
+    lSequentialHandlerList[lSequentialScheduler._partition]->
+      handle (lEventStruct, lSequentialScheduler);
+  }
+  BOOST_CHECK_EQUAL (lFirstSequentialChainer._traceList.size(),
+                     static_cast<std::size_t> (3 * lNbOfMinutes));
+  BOOST_CHECK_EQUAL (lSecondSequentialChainer._traceList.size(),
+                     static_cast<std::size_t> (2 * lNbOfMinutes));
+
+  for (unsigned short lRunIdx = 0; lRunIdx != 10; ++lRunIdx) {
+    sevmgrService.reset();
+    addTiedBreakPoints (sevmgrService, lStartDateTime, lNbOfMinutes);
+    TieChainer lFirstChainer;
+    TieChainer lSecondChainer;
+    lHandlerList.clear();
+    lHandlerList.push_back (&lFirstChainer);
+    lHandlerList.push_back (&lSecondChainer);
+    lStateHandlerList.clear();
+    lStateHandlerList.push_back (&lFirstChainer);
+    lStateHandlerList.push_back (&lSecondChainer);
+    BOOST_CHECK_EQUAL (sevmgrService.runOptimistic (lTagPartitioner,
+                                                    lHandlerList,
+                                                    lStateHandlerList, 1, 3),
+                       5 * lNbOfMinutes);
+    BOOST_CHECK (lFirstChainer._traceList
+                 == lFirstSequentialChainer._traceList);
+    BOOST_CHECK (lSecondChainer._traceList
+                 == lSecondSequentialChainer._traceList);
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Conflict key of the break points: one of four flight-dates, according
+ * to their second.
+ */
+struct FlightDateConflictKeyExtractor
+  : public SEVMGR::EventConflictKeyExtractor {
+  SEVMGR::ConflictKey_T
+  getConflictKey (const stdair::EventStruct& iEventStruct) const {
+    std::ostringstream oStr;
+    oStr << "BA" << (iEventStruct.getEventTime().time_of_day().seconds() % 4);
+    return oStr.str();
+  }
+};
+
+/**
+ * Handler recording the break points of each flight-date. As the
+ * break points of a given flight-date are never handled concurrently,
+ * the list of each flight-date needs no synchronisation.
+ */
+struct FlightDateBreakPointRecorder : public SEVMGR::ConcurrentEventHandler {
+  typedef std::vector<stdair::DateTime_T> DateTimeList_T;
+  typedef std::map<SEVMGR::ConflictKey_T, DateTimeList_T> DateTimeListMap_T;
+
+  FlightDateBreakPointRecorder() {
+    for (unsigned short idx = 0; idx != 4; ++idx) {
+      std::ostringstream oStr;
+      oStr << "BA" << idx;
+      _dateTimeListMap[oStr.str()];
+    }
+  }
+
+  void handle (const stdair::EventStruct& iEventStruct) {
+    const stdair::DateTime_T lDateTime = iEventStruct.getEventTime();
+    if (lDateTime == _failureDateTime) {
+      throw SEVMGR::EventQueueException ("Failing break point");
+    }
+    const FlightDateConflictKeyExtractor lExtractor;
+    DateTimeListMap_T::iterator itDateTimeList =
+      _dateTimeListMap.find (lExtractor.getConflictKey (iEventStruct));
+    // The Boost.Test assertions are not thread-safe
+    if (itDateTimeList != _dateTimeListMap.end()) {
+      itDateTimeList->second.push_back (lDateTime);
+    }
+  }
+
+  DateTimeListMap_T _dateTimeListMap;
+  stdair::DateTime_T _failureDateTime;
+};
+
+/**
+ * Test the simulation by time windows: the break points of each conflict
+ * key are handled in date-time order, whatever the number of threads.
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_windowed_run_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  const stdair::Count_T lNbOfEvents (400);
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const FlightDateConflictKeyExtractor lConflictKeyExtractor;
+  const unsigned int lNbOfThreadsList[] = { 1, 4 };
+  for (unsigned short idx = 0; idx != 2; ++idx) {
+    // Add a break point every 7 seconds
+    sevmgrService.reset();
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+    for (stdair::Count_T lEventIdx = 0; lEventIdx != lNbOfEvents;
+         ++lEventIdx) {
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct>
+        (lStartDateTime + stdair::Duration_T (0, 0, 7 * lEventIdx));
+      sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+    }
+
+    // Simulate the break points, minute by minute
+    FlightDateBreakPointRecorder lRecorder;
+    const stdair::Count_T lNbOfHandledEvents =
+      sevmgrService.runWindowed (stdair::Duration_T (0, 1, 0),
+                                 lConflictKeyExtractor, lRecorder,
+                                 lNbOfThreadsList[idx]);
+    BOOST_CHECK_EQUAL (lNbOfHandledEvents, lNbOfEvents);
+    BOOST_CHECK (sevmgrService.isQueueDone() == true);
+    BOOST_CHECK_EQUAL (sevmgrService.getStatus().getCurrentNb(), lNbOfEvents);
+
+    std::size_t lNbOfRecordedEvents = 0;
+    for (FlightDateBreakPointRecorder::DateTimeListMap_T::const_iterator
+           itDateTimeList = lRecorder._dateTimeListMap.begin();
+         itDateTimeList != lRecorder._dateTimeListMap.end(); ++itDateTimeList) {
+      const FlightDateBreakPointRecorder::DateTimeList_T& lDateTimeList =
+        itDateTimeList->second;
+      BOOST_CHECK (std::is_sorted (lDateTimeList.begin(),
+                                   lDateTimeList.end()));
+      lNbOfRecordedEvents += lDateTimeList.size();
+    }
+    BOOST_CHECK_EQUAL (lNbOfRecordedEvents,
+                       static_cast<std::size_t> (lNbOfEvents));
+  }
+
+  // A failing handler stops the simulation, the events of the window
+  // which have not been handled being given back to the event queue
+  sevmgrService.reset();
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+  for (stdair::Count_T lEventIdx = 0; lEventIdx != lNbOfEvents; ++lEventIdx) {
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct>
+      (lStartDateTime + stdair::Duration_T (0, 0, 7 * lEventIdx));
+    sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+  }
+  FlightDateBreakPointRecorder lFailingRecorder;
+  lFailingRecorder._failureDateTime =
+    lStartDateTime + stdair::Duration_T (0, 0, 7 * 100);
+  BOOST_CHECK_THROW (sevmgrService.runWindowed (stdair::Duration_T (0, 1, 0),
+                                                lConflictKeyExtractor,
+                                                lFailingRecorder, 4),
+                     SEVMGR::EventQueueException);
+  BOOST_CHECK_EQUAL (sevmgrService.getStatus().getCurrentNb()
+                     + sevmgrService.getQueueSize(), lNbOfEvents);
+  // The break points of the window of the failing one (at most 9 of
+  // them) may or may not have been handled, according to their group
+  BOOST_CHECK (sevmgrService.getQueueSize() <= lNbOfEvents - 100 + 9);
+  BOOST_CHECK (sevmgrService.getQueueSize() >= lNbOfEvents - 100 - 9);
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Replication of a simulation, with its own SEvMgr service, on its own
+ * thread. The StdAir service is shared by all the replications.
+ */
+struct SimulationReplication {
+  SimulationReplication (stdair::STDAIR_ServicePtr_T ioSTDAIR_Service_ptr,
+                         const stdair::Count_T& iNbOfEvents,
+                         stdair::Count_T& oNbOfPoppedEvents)
+    : _stdairService (ioSTDAIR_Service_ptr), _nbOfEvents (iNbOfEvents),
+      _nbOfPoppedEvents (oNbOfPoppedEvents) {
+  }
+
+  void operator()() const {
+    SEVMGR::SEVMGR_Service sevmgrService (_stdairService);
+    sevmgrService.addEventQueue ("EQ02");
+
+    const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                             stdair::Duration_T (0, 0, 0));
+    sevmgrService.addStatus (stdair::EventType::BRK_PT, _nbOfEvents);
+    for (stdair::Count_T idx = 0; idx != _nbOfEvents; ++idx) {
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct>
+        (lStartDateTime + stdair::Duration_T (0, idx, 0));
+      sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+    }
+
+    SEVMGR::EventStructList_T lEventStructList;
+    sevmgrService.popEvents (lEventStructList, 2 * _nbOfEvents);
+    _nbOfPoppedEvents = sevmgrService.getStatus().getCurrentNb();
+  }
+
+  stdair::STDAIR_ServicePtr_T _stdairService;
+  const stdair::Count_T _nbOfEvents;
+  stdair::Count_T& _nbOfPoppedEvents;
+};
+
+/**
+ * Test that several SEvMgr services may be created, used and destroyed
+ * in parallel, e.g., for the replications of a Monte-Carlo simulation.
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_parallel_services_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the StdAir service object, shared by the replications
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  stdair::STDAIR_ServicePtr_T lSTDAIR_Service_ptr =
+    boost::make_shared<stdair::STDAIR_Service> (lLogParams);
+
+  // Run the replications, by waves of threads
+  const unsigned short lNbOfWaves (4);
+  const unsigned short lNbOfThreads (8);
+  for (unsigned short lWaveIdx = 0; lWaveIdx != lNbOfWaves; ++lWaveIdx) {
+    std::vector<stdair::Count_T> lNbOfPoppedEventsList (lNbOfThreads, 0);
+    std::vector<std::thread> lThreadList;
+    for (unsigned short idx = 0; idx != lNbOfThreads; ++idx) {
+      const SimulationReplication lReplication (lSTDAIR_Service_ptr,
+                                                50 + idx,
+                                                lNbOfPoppedEventsList[idx]);
+      lThreadList.push_back (std::thread (lReplication));
+    }
+    for (unsigned short idx = 0; idx != lNbOfThreads; ++idx) {
+      lThreadList[idx].join();
+      BOOST_CHECK_EQUAL (lNbOfPoppedEventsList[idx], 50 + idx);
+    }
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+// //////////////////////////////////////////////////////////////////////
+/**
+ * Handler of the break points, dispatched by the registry: it checks
+ * that the break points come in chronological order and, for the first
+ * ones, schedules a follow-up break point, half an hour later.
+ */
+struct FollowUpBreakPointHandler {
+  FollowUpBreakPointHandler (const SEVMGR::SEVMGR_Service& iSEVMGR_Service,
+                             const stdair::Count_T& iNbOfFollowUps)
+    : _sevmgrService (iSEVMGR_Service), _nbOfFollowUps (iNbOfFollowUps),
+      _nbOfHandledEvents (0), _areEventsSorted (true) {
+  }
+
+  void operator() (const stdair::EventStruct& iEventStruct) {
+    const stdair::DateTime_T& lDateTime = iEventStruct.getEventTime();
+    if (_nbOfHandledEvents != 0 && lDateTime < _lastDateTime) {
+      _areEventsSorted = false;
+    }
+    _lastDateTime = lDateTime;
+    ++_nbOfHandledEvents;
+
+    if (_nbOfFollowUps != 0) {
+      --_nbOfFollowUps;
+      const stdair::BreakPointPtr_T lBreakPoint_ptr =
+        boost::make_shared<stdair::BreakPointStruct>
+        (lDateTime + stdair::Duration_T (0, 30, 0));
+      _sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+    }
+  }
+
+  const SEVMGR::SEVMGR_Service& _sevmgrService;
+  stdair::Count_T _nbOfFollowUps;
+  stdair::Count_T _nbOfHandledEvents;
+  stdair::DateTime_T _lastDateTime;
+  bool _areEventsSorted;
+};
+
+/**
+ * Test the run dispatching the events to the handlers registered by
+ * event type, the handlers adding events while the run goes on
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_dispatched_run_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Break points, one per hour
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfEvents (200);
+  const stdair::Count_T lNbOfFollowUps (150);
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct>
+      (lStartDateTime + stdair::Duration_T (idx, 0, 0));
+    sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+  }
+
+  // Without any handler, the run stops at the first break point
+  SEVMGR::EventHandlerRegistry lRegistry;
+  BOOST_CHECK_EQUAL (sevmgrService.run (lRegistry), 0);
+  BOOST_CHECK_EQUAL (sevmgrService.getQueueSize(), lNbOfEvents - 1);
+
+  // With a handler, all the break points are played, including the
+  // follow-up ones
+  FollowUpBreakPointHandler lHandler (sevmgrService, lNbOfFollowUps);
+  lRegistry.registerHandler (stdair::EventType::BRK_PT, lHandler);
+  const stdair::Count_T lNbOfHandledEvents = sevmgrService.run (lRegistry);
+  BOOST_CHECK_EQUAL (lNbOfHandledEvents, lNbOfEvents - 1 + lNbOfFollowUps);
+  BOOST_CHECK_EQUAL (lHandler._nbOfHandledEvents, lNbOfHandledEvents);
+  BOOST_CHECK (lHandler._areEventsSorted == true);
+  BOOST_CHECK (sevmgrService.isQueueDone() == true);
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+/**
+ * Test the runs stopping on a date-time, a number of events, an event
+ * type or a predicate, without any break point having to be added
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_run_until_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Break points, one per hour
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfEvents (100);
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, lNbOfEvents);
+  for (stdair::Count_T idx = 0; idx != lNbOfEvents; ++idx) {
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct>
+      (lStartDateTime + stdair::Duration_T (idx, 0, 0));
+    sevmgrService.emplaceEvent (stdair::EventType::BRK_PT, lBreakPoint_ptr);
+  }
+  SEVMGR::EventHandlerRegistry lRegistry;
+  FollowUpBreakPointHandler lHandler (sevmgrService, 0);
+  lRegistry.registerHandler (stdair::EventType::BRK_PT, lHandler);
+
+  // Play the first ten hours (the events at the given date-time included)
+  const SEVMGR::RunReport lUntilReport =
+    sevmgrService.runUntil (lStartDateTime + stdair::Duration_T (9, 0, 0),
+                            lRegistry);
+  BOOST_CHECK_EQUAL (lUntilReport.getNbOfEvents(), 10);
+  BOOST_CHECK_EQUAL (lUntilReport.getNbOfHandledEvents(), 10);
+  BOOST_CHECK (lUntilReport.getStopReason()
+               == SEVMGR::RunStopReason::DATE_TIME);
+  BOOST_CHECK (lUntilReport.getElapsedTime() >= 0.0);
+  BOOST_CHECK_EQUAL (sevmgrService.getQueueSize(), lNbOfEvents - 10);
+
+  // Play a given number of events
+  const SEVMGR::RunReport lForReport = sevmgrService.runFor (15, lRegistry);
+  BOOST_CHECK_EQUAL (lForReport.getNbOfEvents(), 15);
+  BOOST_CHECK (lForReport.getStopReason()
+               == SEVMGR::RunStopReason::EVENT_COUNT);
+
+  // Play until the break point of the fiftieth hour
+  const stdair::DateTime_T lPredicateDateTime =
+    lStartDateTime + stdair::Duration_T (50, 0, 0);
+  auto lPredicate = [&lPredicateDateTime] (const stdair::EventStruct& iEvent) {
+    return (iEvent.getEventTime() >= lPredicateDateTime);
+  };
+  const SEVMGR::RunReport lPredicateReport =
+    sevmgrService.runUntilPredicate (lPredicate, lRegistry);
+  BOOST_CHECK_EQUAL (lPredicateReport.getNbOfEvents(), 26);
+  BOOST_CHECK (lPredicateReport.getStopReason()
+               == SEVMGR::RunStopReason::PREDICATE);
+  BOOST_CHECK (lHandler._lastDateTime == lPredicateDateTime);
+
+  // Play the remaining events
+  const SEVMGR::RunReport lFullReport =
+    sevmgrService.run (lRegistry, SEVMGR::RunStopCondition());
+  BOOST_CHECK_EQUAL (lFullReport.getNbOfEvents(), lNbOfEvents - 51);
+  BOOST_CHECK (lFullReport.getStopReason()
+               == SEVMGR::RunStopReason::QUEUE_DONE);
+  BOOST_CHECK_EQUAL (lHandler._nbOfHandledEvents, lNbOfEvents);
+  BOOST_CHECK (lHandler._areEventsSorted == true);
+  BOOST_CHECK (sevmgrService.isQueueDone() == true);
+
+  // Without any handler, play the sample events up to the first break
+  // point (that one included)
+  sevmgrService.reset();
+  sevmgrService.buildSampleQueue();
+  const stdair::Count_T lNbOfSampleEvents = sevmgrService.getQueueSize();
+  SEVMGR::EventTypeSet_T lEventTypeSet;
+  lEventTypeSet.set (stdair::EventType::BRK_PT);
+  const SEVMGR::RunReport lTypeReport =
+    sevmgrService.runUntil (lEventTypeSet, SEVMGR::EventHandlerRegistry());
+  BOOST_CHECK (lTypeReport.getStopReason()
+               == SEVMGR::RunStopReason::EVENT_TYPE);
+  BOOST_CHECK_EQUAL (lTypeReport.getNbOfHandledEvents(), 0);
+  BOOST_CHECK_EQUAL (lTypeReport.getNbOfEvents(),
+                     lNbOfSampleEvents - sevmgrService.getQueueSize());
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+// //////////////////////////////////////////////////////////////////////
+/**
+ * Generator of break points, one every given number of minutes
+ */
+struct PeriodicBreakPointGenerator : public SEVMGR::PipelineEventGenerator {
+  PeriodicBreakPointGenerator (const stdair::DateTime_T& iStartDateTime,
+                               const unsigned short iPeriod,
+                               const stdair::Count_T& iNbOfEvents)
+    : _nextDateTime (iStartDateTime), _period (0, iPeriod, 0),
+      _nbOfEvents (iNbOfEvents) {
+  }
+
+  bool generateNextEvent (stdair::EventStruct& oEventStruct) {
+    if (_nbOfEvents == 0) {
+      return false;
+    }
+    --_nbOfEvents;
+    const stdair::BreakPointPtr_T lBreakPoint_ptr =
+      boost::make_shared<stdair::BreakPointStruct> (_nextDateTime);
+    oEventStruct = stdair::EventStruct (stdair::EventType::BRK_PT,
+                                        lBreakPoint_ptr);
+    _nextDateTime += _period;
+    return true;
+  }
+
+  stdair::DateTime_T _nextDateTime;
+  stdair::Duration_T _period;
+  stdair::Count_T _nbOfEvents;
+};
+
+/**
+ * Test the pipelined run, the events being generated by a background
+ * thread while they are handled
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_pipelined_run_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+  sevmgrService.addStatus (stdair::EventType::BRK_PT, 0);
+
+  // Generators of break points, with different periods
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  const stdair::Count_T lNbOfEventsPerGenerator (5000);
+  std::vector<PeriodicBreakPointGenerator*> lGeneratorList;
+  SEVMGR::PipelineEventGeneratorList_T lPipelineGeneratorList;
+  for (unsigned short idx = 0; idx != 4; ++idx) {
+    lGeneratorList.push_back (new PeriodicBreakPointGenerator
+                              (lStartDateTime, 1 + 2 * idx,
+                               lNbOfEventsPerGenerator));
+    lPipelineGeneratorList.push_back (lGeneratorList.back());
+  }
+
+  // The handler also schedules follow-up break points, which are played
+  // within the same run
+  const stdair::Count_T lNbOfFollowUps (100);
+  FollowUpBreakPointHandler lHandler (sevmgrService, lNbOfFollowUps);
+  SEVMGR::EventHandlerRegistry lRegistry;
+  lRegistry.registerHandler (stdair::EventType::BRK_PT, lHandler);
+  const stdair::Count_T lNbOfHandledEvents =
+    sevmgrService.runPipelined (lPipelineGeneratorList,
+                                stdair::Duration_T (2, 0, 0), lRegistry);
+
+  BOOST_CHECK_EQUAL (lNbOfHandledEvents,
+                     4 * lNbOfEventsPerGenerator + lNbOfFollowUps);
+  BOOST_CHECK_EQUAL (lHandler._nbOfHandledEvents, lNbOfHandledEvents);
+  BOOST_CHECK (lHandler._areEventsSorted == true);
+  BOOST_CHECK (sevmgrService.isQueueDone() == true);
+
+  // A generator going back in time makes the run fail
+  lGeneratorList[0]->_nbOfEvents = 10;
+  lGeneratorList[0]->_period = stdair::Duration_T (0, -1, 0);
+  SEVMGR::PipelineEventGeneratorList_T lFailingGeneratorList;
+  lFailingGeneratorList.push_back (lGeneratorList[0]);
+  BOOST_CHECK_THROW (sevmgrService.runPipelined (lFailingGeneratorList,
+                                                 stdair::Duration_T (2, 0, 0),
+                                                 lRegistry),
+                     SEVMGR::EventQueueException);
+
+  for (std::vector<PeriodicBreakPointGenerator*>::iterator itGenerator =
+         lGeneratorList.begin(); itGenerator != lGeneratorList.end();
+       ++itGenerator) {
+    delete *itGenerator;
+  }
+
+  // Close the log file
+  logOutputFile.close();
+}
+
+#if defined(__cpp_impl_coroutine)
+// //////////////////////////////////////////////////////////////////////
+/**
+ * Activity log of the simulated customers: the number of bookings and
+ * cancellations, and whether they came in chronological order.
+ */
+struct CustomerActivityLog {
+  CustomerActivityLog()
+    : _nbOfBookings (0), _nbOfCancellations (0), _isChronological (true) {
+  }
+
+  void record (const stdair::DateTime_T& iDateTime) {
+    if (_nbOfBookings + _nbOfCancellations != 0 && iDateTime < _lastDateTime) {
+      _isChronological = false;
+    }
+    _lastDateTime = iDateTime;
+  }
+
+  stdair::Count_T _nbOfBookings;
+  stdair::Count_T _nbOfCancellations;
+  stdair::DateTime_T _lastDateTime;
+  bool _isChronological;
+};
+
+/**
+ * Customer booking, then waiting for the given number of hours before
+ * cancelling
+ */
+SEVMGR::SimulationProcess
+bookThenCancel (SEVMGR::ProcessScheduler& ioScheduler,
+                CustomerActivityLog& ioActivityLog,
+                const unsigned short iNbOfWaitingHours) {
+  ioActivityLog.record (ioScheduler.getCurrentDateTime());
+  ++ioActivityLog._nbOfBookings;
+
+  co_await ioScheduler.sleepFor (stdair::Duration_T (iNbOfWaitingHours, 0, 0));
+
+  ioActivityLog.record (ioScheduler.getCurrentDateTime());
+  ++ioActivityLog._nbOfCancellations;
+}
+
+/**
+ * Test the simulation processes written as coroutines, resumed by the
+ * scheduler at the simulated date-times they wait for
+ */
+BOOST_AUTO_TEST_CASE (sevmgr_coroutine_process_test) {
+
+  // Output log File
+  const stdair::Filename_T lLogFilename ("EventQueueManagementTestSuite.log");
+
+  // Set the log parameters
+  std::ofstream logOutputFile;
+  // open and clean the log outputfile
+  logOutputFile.open (lLogFilename.c_str());
+  logOutputFile.clear();
+
+  // Initialise the Sevmgr service object
+  const stdair::BasLogParams lLogParams (stdair::LOG::NOTIFICATION,
+                                         logOutputFile);
+  SEVMGR::SEVMGR_Service sevmgrService (lLogParams);
+
+  // Customers, arriving (pseudo-randomly) over 10 days
+  const stdair::DateTime_T lStartDateTime (stdair::Date_T (2011, 1, 1),
+                                           stdair::Duration_T (0, 0, 0));
+  SEVMGR::ProcessScheduler lScheduler (sevmgrService, lStartDateTime);
+  CustomerActivityLog lActivityLog;
+  const stdair::Count_T lNbOfCustomers (10000);
+  unsigned long lSeed = 24680;
+  for (stdair::Count_T idx = 0; idx != lNbOfCustomers; ++idx) {
+    lSeed = (1103515245 * lSeed + 12345) % 2147483648UL;
+    const stdair::DateTime_T lArrivalDateTime =
+      lStartDateTime + stdair::Duration_T (0, lSeed % (60 * 24 * 10), 0);
+    lScheduler.spawn (bookThenCancel (lScheduler, lActivityLog, 1 + idx % 48),
+                      lArrivalDateTime);
+  }
+  BOOST_CHECK_EQUAL (lScheduler.getNbOfProcesses(), lNbOfCustomers);
+
+  // Play the simulation, the scheduler handling the break points
+  SEVMGR::EventHandlerRegistry lRegistry;
+  lRegistry.registerHandler (stdair::EventType::BRK_PT, lScheduler);
+  const stdair::Count_T lNbOfHandledEvents = sevmgrService.run (lRegistry);
+
+  BOOST_CHECK_EQUAL (lNbOfHandledEvents, 2 * lNbOfCustomers);
+  BOOST_CHECK_EQUAL (lActivityLog._nbOfBookings, lNbOfCustomers);
+  BOOST_CHECK_EQUAL (lActivityLog._nbOfCancellations, lNbOfCustomers);
+  BOOST_CHECK (lActivityLog._isChronological == true);
+  BOOST_CHECK_EQUAL (lScheduler.getNbOfProcesses(), 0);
+
+  // Close the log file
+  logOutputFile.close();
+}
+#endif
+
 // End the test suite
 BOOST_AUTO_TEST_SUITE_END()
 